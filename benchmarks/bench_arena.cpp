@@ -6,12 +6,14 @@
 ///   - Arena reuse (parse + reset loop) vs fresh allocation
 ///   - Multi-threaded parsing with per-thread arenas
 ///   - Throughput in messages/sec for network-like workloads
+///   - NDJSON log processing with per-record arena reuse
 
 #include <json/json.hpp>
 
 #include <benchmark/benchmark.h>
 
 #include <atomic>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -183,6 +185,59 @@ static void BM_ArenaReuse_NetworkMsg(benchmark::State& state) {
 }
 BENCHMARK(BM_ArenaReuse_NetworkMsg);
 
+// A frame of state.range(0) messages: one parse() per message vs one
+// parse_batch() per frame, both into a single arena reset per frame.
+static void BM_ArenaReuse_NetworkMsg_Loop(benchmark::State& state) {
+    const std::string msg = gen_network_msg();
+    const std::vector<std::string_view> frame(static_cast<size_t>(state.range(0)), msg);
+    std::vector<result<JsonValue>> out(frame.size());
+    MonotonicArena arena(64 * 1024);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < frame.size(); ++i) out[i] = try_parse(frame[i], arena);
+        benchmark::DoNotOptimize(out.data());
+        for (auto& r : out) r.value = JsonValue();
+        arena.reset();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<int64_t>(msg.size()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArenaReuse_NetworkMsg_Loop)->Arg(100)->Arg(1000);
+
+static void BM_ArenaReuse_NetworkMsg_Batch(benchmark::State& state) {
+    const std::string msg = gen_network_msg();
+    const std::vector<std::string_view> frame(static_cast<size_t>(state.range(0)), msg);
+    std::vector<result<JsonValue>> out(frame.size());
+    MonotonicArena arena(64 * 1024);
+
+    for (auto _ : state) {
+        parse_batch(frame.data(), frame.size(), arena, out.data());
+        benchmark::DoNotOptimize(out.data());
+        for (auto& r : out) r.value = JsonValue();
+        arena.reset();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<int64_t>(msg.size()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArenaReuse_NetworkMsg_Batch)->Arg(100)->Arg(1000);
+
+static void BM_ArenaReuse_NetworkMsg_ParallelBatch(benchmark::State& state) {
+    const std::string msg = gen_network_msg();
+    const std::vector<std::string_view> frame(static_cast<size_t>(state.range(0)), msg);
+    ParallelBatch batch;
+
+    for (auto _ : state) {
+        batch.parse(frame);
+        benchmark::DoNotOptimize(batch.results().data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<int64_t>(msg.size()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArenaReuse_NetworkMsg_ParallelBatch)->Arg(1000)->UseRealTime();
+
 static void BM_HeapAlloc_NetworkMsg(benchmark::State& state) {
     auto input = gen_network_msg();
 
@@ -196,6 +251,85 @@ static void BM_HeapAlloc_NetworkMsg(benchmark::State& state) {
 }
 BENCHMARK(BM_HeapAlloc_NetworkMsg);
 
+static void BM_HeapAlloc_NetworkMsg_NoDupKeys(benchmark::State& state) {
+    auto input = gen_network_msg();
+    ParseOptions opts;
+    opts.allow_duplicate_keys = false;
+
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeapAlloc_NetworkMsg_NoDupKeys);
+
+// Warm ParserContext: scratch reused across messages.
+// Arg 0 = default options, 1 = duplicate-key detection.
+static void BM_ParserContext_NetworkMsg(benchmark::State& state) {
+    auto input = gen_network_msg();
+    ParseOptions opts;
+    opts.allow_duplicate_keys = state.range(0) == 0;
+    ParserContext ctx;
+
+    for (auto _ : state) {
+        auto v = ctx.parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParserContext_NetworkMsg)->Arg(0)->Arg(1);
+
+// =============================================================================
+// NDJSON log processing: getline + parse vs ndjson::Reader
+// =============================================================================
+
+static std::string gen_ndjson_log(int lines) {
+    std::string s;
+    const std::string msg = gen_network_msg();
+    for (int i = 0; i < lines; ++i) {
+        s += msg;
+        s += '\n';
+    }
+    return s;
+}
+
+static void BM_Ndjson_GetlineParse(benchmark::State& state) {
+    auto input = gen_ndjson_log(1000);
+    for (auto _ : state) {
+        std::istringstream is(input);
+        std::string line;
+        size_t n = 0;
+        while (std::getline(is, line)) {
+            auto v = parse(line);
+            n += v.size();
+        }
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_Ndjson_GetlineParse);
+
+static void BM_Ndjson_Reader(benchmark::State& state) {
+    auto input = gen_ndjson_log(1000);
+    for (auto _ : state) {
+        ndjson::Reader reader(input);
+        size_t n = 0;
+        for (const auto& rec : reader) n += rec.value.size();
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_Ndjson_Reader);
+
 // =============================================================================
 // Multi-threaded parsing benchmarks
 // =============================================================================
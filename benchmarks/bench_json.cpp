@@ -12,6 +12,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <optional>
 #include <random>
 #include <sstream>
@@ -78,6 +82,43 @@ static std::string generate_int_array(int count) {
     return s;
 }
 
+/// Generate an array of 10-19 digit IDs and nanosecond timestamps.
+static std::string generate_id_array(int count) {
+    std::mt19937_64 rng(11);
+    std::string s = "[";
+    for (int i = 0; i < count; ++i) {
+        if (i > 0) s += ",";
+        const uint64_t v = i % 2 ? 1700000000000000000ull + rng() % 100000000000000000ull
+                                 : 1000000000ull + rng() % 9000000000000000ull;
+        s += std::to_string(v);
+    }
+    s += "]";
+    return s;
+}
+
+/// Generate a float array. scientific == false: canada.json-style
+/// [lon, lat] pairs with 16-17 significant digits (mantissas above 2^53).
+/// scientific == true: telemetry-style values with exponents far outside
+/// the exact-power-of-ten range [-22, 22].
+static std::string generate_float_array(int count, bool scientific) {
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> lon(-141.0, -52.0), lat(41.0, 83.0);
+    std::uniform_int_distribution<int> exp10(-200, 200);
+    std::string s = "[";
+    char buf[64];
+    for (int i = 0; i < count; ++i) {
+        if (i > 0) s += ",";
+        if (scientific) {
+            std::snprintf(buf, sizeof(buf), "%.15ge%d", lat(rng) / 10, exp10(rng));
+        } else {
+            std::snprintf(buf, sizeof(buf), "[%.17g,%.16g]", lon(rng), lat(rng));
+        }
+        s += buf;
+    }
+    s += "]";
+    return s;
+}
+
 /// Generate deeply nested structure.
 static std::string generate_deeply_nested(int depth) {
     std::string s;
@@ -128,6 +169,285 @@ static void BM_ParseLarge(benchmark::State& state) {
 }
 BENCHMARK(BM_ParseLarge);
 
+static void BM_ParseLarge_Padded(benchmark::State& state) {
+    PaddedString input(generate_large_json());
+    for (auto _ : state) {
+        auto v = parse_padded(input);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_Padded);
+
+static void BM_ParseLarge_BorrowStrings(benchmark::State& state) {
+    auto input = generate_large_json();
+    ParseOptions opts;
+    opts.borrow_strings = true;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_BorrowStrings);
+
+static void BM_ParseMedium_StructuralIndex(benchmark::State& state) {
+    auto input = generate_medium_json();
+    ParseOptions opts;
+    opts.structural_index = true;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseMedium_StructuralIndex);
+
+static void BM_ParseLarge_StructuralIndex(benchmark::State& state) {
+    auto input = generate_large_json();
+    ParseOptions opts;
+    opts.structural_index = true;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_StructuralIndex);
+
+static void BM_ParseMedium_Tape(benchmark::State& state) {
+    auto input = generate_medium_json();
+    TapeDocument doc;
+    for (auto _ : state) {
+        doc.parse(input);
+        benchmark::DoNotOptimize(doc.root());
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseMedium_Tape);
+
+static void BM_ParseLarge_Tape(benchmark::State& state) {
+    auto input = generate_large_json();
+    TapeDocument doc;
+    for (auto _ : state) {
+        doc.parse(input);
+        benchmark::DoNotOptimize(doc.root());
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_Tape);
+
+// SAX: same document delivered as events, nothing materialized.
+namespace {
+struct CountingSaxHandler : SaxHandler {
+    size_t scalars = 0;
+    void on_null() { ++scalars; }
+    void on_bool(bool) { ++scalars; }
+    void on_int64(int64_t) { ++scalars; }
+    void on_uint64(uint64_t) { ++scalars; }
+    void on_double(double) { ++scalars; }
+    void on_string(std::string_view) { ++scalars; }
+};
+} // namespace
+
+static void BM_ParseLarge_Sax(benchmark::State& state) {
+    auto input = generate_large_json();
+    for (auto _ : state) {
+        CountingSaxHandler h;
+        parse_sax(input, h);
+        benchmark::DoNotOptimize(h.scalars);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_Sax);
+
+// Syntax check only: no values, no string decoding, no allocation.
+// Arg: 1 = also ParseOptions::validate_utf8.
+static void BM_ValidateLarge(benchmark::State& state) {
+    auto input = generate_large_json();
+    ParseOptions opts;
+    opts.validate_utf8 = state.range(0) != 0;
+    for (auto _ : state) {
+        auto r = validate(input, opts);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ValidateLarge)->Arg(0)->Arg(1);
+
+// UTF-8 pre-pass alone. Arg: 0 = the (ASCII) large document,
+// 1 = mixed Latin/Cyrillic/CJK/emoji text.
+static void BM_ValidateUtf8(benchmark::State& state) {
+    std::string input = generate_large_json();
+    if (state.range(0) != 0) {
+        const std::string text = "caf\xC3\xA9 \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 "
+                                 "\xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80 plain ascii words ";
+        std::string mixed;
+        while (mixed.size() < input.size()) mixed += text;
+        input = std::move(mixed);
+    }
+    const char* end = input.data() + input.size();
+    for (auto _ : state) {
+        const char* bad = detail::simd::validate_utf8(input.data(), end);
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ValidateUtf8)->Arg(0)->Arg(1);
+
+// Push parser fed in MTU-sized segments, as from a TCP socket.
+static void BM_ParseLarge_Incremental(benchmark::State& state) {
+    auto input = generate_large_json();
+    const size_t segment = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        IncrementalParser p;
+        for (size_t off = 0; off < input.size(); off += segment) {
+            p.feed(std::string_view(input).substr(off, segment));
+        }
+        p.finish();
+        auto v = p.next();
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_Incremental)->Arg(1460)->Arg(64 * 1024);
+
+// ~32 MB root array of records, split across threads (1 = serial parse()).
+static const std::string& huge_record_array() {
+    static const std::string s = [] {
+        std::string out = "[";
+        for (int i = 0; i < 200000; ++i) {
+            if (i > 0) out += ",";
+            out += R"({"id":)" + std::to_string(i) +
+                   R"(,"name":"record )" + std::to_string(i) +
+                   R"( with a [bracketed], \"quoted\" title","values":[1,2.5,-3,true,null],)" +
+                   R"("nested":{"a":{"b":[)" + std::to_string(i % 97) + "]}}}";
+        }
+        out += "]";
+        return out;
+    }();
+    return s;
+}
+
+static void BM_ParseParallel(benchmark::State& state) {
+    const std::string& input = huge_record_array();
+    const size_t threads = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        auto v = threads == 1 ? parse(input) : parse_parallel(input, threads);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseParallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_ParseParallel_Arenas(benchmark::State& state) {
+    const std::string& input = huge_record_array();
+    ParallelDocument doc;
+    for (auto _ : state) {
+        doc.parse(input, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(doc.root());
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseParallel_Arenas)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Read three fields out of the medium document: full DOM vs on-demand.
+static void BM_ReadFields_Dom(benchmark::State& state) {
+    auto input = generate_medium_json();
+    for (auto _ : state) {
+        auto v = parse(input);
+        int64_t total = v["total"].as_integer();
+        auto version = v["version"].as_string_view();
+        auto name = v["users"][5]["name"].as_string_view();
+        benchmark::DoNotOptimize(total);
+        benchmark::DoNotOptimize(version);
+        benchmark::DoNotOptimize(name);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ReadFields_Dom);
+
+static void BM_ReadFields_OnDemand(benchmark::State& state) {
+    auto input = generate_medium_json();
+    for (auto _ : state) {
+        ondemand::Document doc(input);
+        int64_t total = doc["total"].as_integer();
+        auto version = doc["version"].as_string_view();
+        auto name = doc["users"][5]["name"].as_string_view();
+        benchmark::DoNotOptimize(total);
+        benchmark::DoNotOptimize(version);
+        benchmark::DoNotOptimize(name);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ReadFields_OnDemand);
+
+static void BM_ReadFields_Extract(benchmark::State& state) {
+    auto input = generate_medium_json();
+    Extractor ex({JsonPointer("/total"), JsonPointer("/version"),
+                  JsonPointer("/users/5/name")});
+    std::vector<std::optional<JsonValue>> out;
+    for (auto _ : state) {
+        ex.extract(input, out);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ReadFields_Extract);
+
+// A few paths out of the ~100KB document: full DOM + resolve vs extract.
+static void BM_ExtractLarge(benchmark::State& state) {
+    auto input = generate_large_json();
+    const std::vector<JsonPointer> paths = {
+        JsonPointer("/data/10/price"), JsonPointer("/data/999/tags"),
+        JsonPointer("/meta/total")};
+    Extractor ex(paths);
+    std::vector<std::optional<JsonValue>> out;
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            auto v = parse(input);
+            for (const auto& p : paths) {
+                const JsonValue* r = p.try_resolve(v);
+                benchmark::DoNotOptimize(r);
+            }
+        } else {
+            ex.extract(input, out);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ExtractLarge)->Arg(0)->Arg(1);
+
+static void BM_SkipValueLarge(benchmark::State& state) {
+    auto input = generate_large_json();
+    for (auto _ : state) {
+        const char* end = skip_value(input.data(), input.data() + input.size());
+        benchmark::DoNotOptimize(end);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_SkipValueLarge);
+
 static void BM_ParseIntArray(benchmark::State& state) {
     auto count = state.range(0);
     auto input = generate_int_array(static_cast<int>(count));
@@ -140,6 +460,61 @@ static void BM_ParseIntArray(benchmark::State& state) {
 }
 BENCHMARK(BM_ParseIntArray)->Arg(100)->Arg(1000)->Arg(10000);
 
+static void BM_ParseIdArray(benchmark::State& state) {
+    auto input = generate_id_array(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto v = parse(input);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseIdArray)->Arg(10000);
+
+static void BM_ParseFloatArray(benchmark::State& state) {
+    auto input = generate_float_array(10000, state.range(0) != 0);
+    for (auto _ : state) {
+        auto v = parse(input);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseFloatArray)->Arg(0)->Arg(1);
+
+/// Numeric arrays, {0: ids, 1: floats} x {0: regular Array,
+/// 1: ParseOptions::packed_arrays}.
+static std::string generate_numeric_array(int64_t kind) {
+    return kind == 0 ? generate_id_array(100000) : generate_float_array(100000, true);
+}
+
+static void BM_ParsePackedArray(benchmark::State& state) {
+    auto input = generate_numeric_array(state.range(0));
+    ParseOptions opts;
+    opts.packed_arrays = state.range(1) != 0;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParsePackedArray)->Args({0, 0})->Args({0, 1})->Args({1, 0})->Args({1, 1});
+
+static void BM_DumpPackedArray(benchmark::State& state) {
+    auto input = generate_numeric_array(state.range(0));
+    ParseOptions opts;
+    opts.packed_arrays = state.range(1) != 0;
+    const JsonValue v = parse(input, opts);
+    for (auto _ : state) {
+        auto s = v.dump();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_DumpPackedArray)->Args({0, 0})->Args({0, 1})->Args({1, 0})->Args({1, 1});
+
 static void BM_ParseDeeplyNested(benchmark::State& state) {
     auto depth = state.range(0);
     auto input = generate_deeply_nested(static_cast<int>(depth));
@@ -152,6 +527,65 @@ static void BM_ParseDeeplyNested(benchmark::State& state) {
 }
 BENCHMARK(BM_ParseDeeplyNested)->Arg(10)->Arg(50)->Arg(200);
 
+static void BM_ParseDeeplyNested_Iterative(benchmark::State& state) {
+    auto depth = state.range(0);
+    auto input = generate_deeply_nested(static_cast<int>(depth));
+    ParseOptions opts;
+    opts.iterative = true;
+    opts.max_depth = static_cast<size_t>(depth) + 1;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseDeeplyNested_Iterative)->Arg(10)->Arg(50)->Arg(200)->Arg(5000);
+
+/// GraphQL-gateway style response: connections of edges of small nested
+/// objects (~6 levels, few members per object).
+static std::string generate_graphql_response() {
+    std::string s = R"({"data":{"viewer":{"repositories":{"edges":[)";
+    for (int i = 0; i < 300; ++i) {
+        if (i > 0) s += ",";
+        s += R"({"node":{"id":"R_)" + std::to_string(i) +
+             R"(","owner":{"login":"user)" + std::to_string(i % 17) +
+             R"("},"stats":{"stars":{"totalCount":)" + std::to_string(i * 7) +
+             R"(},"issues":{"open":{"totalCount":)" + std::to_string(i % 13) +
+             R"(}}},"languages":{"nodes":[{"name":"C++"},{"name":"CMake"}]}},"cursor":"c)" +
+             std::to_string(i) + R"("})";
+    }
+    s += R"(],"pageInfo":{"hasNextPage":false}}}}})";
+    return s;
+}
+
+// Arg 0 = recursive core, 1 = iterative core.
+static void BM_ParseGraphQL(benchmark::State& state) {
+    auto input = generate_graphql_response();
+    ParseOptions opts;
+    opts.iterative = state.range(0) != 0;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseGraphQL)->Arg(0)->Arg(1);
+
+static void BM_ParseLarge_Iterative(benchmark::State& state) {
+    auto input = generate_large_json();
+    ParseOptions opts;
+    opts.iterative = true;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseLarge_Iterative);
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Serialization benchmarks
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -201,6 +635,36 @@ static void BM_SerializeLargePretty(benchmark::State& state) {
 }
 BENCHMARK(BM_SerializeLargePretty);
 
+/// Double formatting, {0: 7-decimal coordinates, 1: random 17-digit values,
+/// 2: scientific telemetry} x {0: detail::fast_dtoa (Dragonbox),
+/// 1: std::to_chars, the previous general case}.
+static void BM_FormatDouble(benchmark::State& state) {
+    std::mt19937_64 rng(3);
+    std::uniform_real_distribution<double> lon(-180.0, 180.0), unit(0.0, 1.0);
+    std::uniform_int_distribution<int> exp10(-200, 200);
+    std::vector<double> values(4096);
+    for (double& d : values) {
+        if (state.range(0) == 0) d = std::round(lon(rng) * 1e7) / 1e7;
+        else if (state.range(0) == 1) d = lon(rng);
+        else d = unit(rng) * std::pow(10.0, exp10(rng));
+    }
+    char buf[64];
+    for (auto _ : state) {
+        for (const double d : values) {
+            size_t len;
+            if (state.range(1) == 0) {
+                len = detail::fast_dtoa(buf, d);
+            } else {
+                len = static_cast<size_t>(std::to_chars(buf, buf + sizeof(buf), d).ptr - buf);
+            }
+            benchmark::DoNotOptimize(len);
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FormatDouble)->ArgsProduct({{0, 1, 2}, {0, 1}});
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Data access benchmarks
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -307,6 +771,24 @@ static void BM_RoundtripLarge(benchmark::State& state) {
 }
 BENCHMARK(BM_RoundtripLarge);
 
+/// Pass-through of a float-heavy document: Arg(0) converts every number,
+/// Arg(1) keeps the text (ParseOptions::number_mode = NumberMode::raw),
+/// Arg(2) also borrows the tokens longer than SSO from the input.
+static void BM_RoundtripFloats(benchmark::State& state) {
+    auto input = generate_float_array(10000, true);
+    ParseOptions opts;
+    if (state.range(0) >= 1) opts.number_mode = NumberMode::raw;
+    if (state.range(0) >= 2) opts.borrow_strings = true;
+    for (auto _ : state) {
+        auto v = parse(input, opts);
+        auto s = v.dump();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_RoundtripFloats)->Arg(0)->Arg(1)->Arg(2);
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Thread safety benchmarks
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -430,6 +912,60 @@ static void BM_ParseUnicodeEscape(benchmark::State& state) {
 }
 BENCHMARK(BM_ParseUnicodeEscape);
 
+/// Generate JSON-in-JSON and HTML payloads (escape-heavy strings).
+static std::string generate_escaped_payload_json() {
+    std::string s = R"({"events":[)";
+    for (int i = 0; i < 200; ++i) {
+        if (i > 0) s += ",";
+        s += R"({"body":"{\"id\":)" + std::to_string(i) +
+             R"(,\"msg\":\"hello \\\"world\\\"\",\"tags\":[\"a\",\"b\"]}",)"
+             R"("html":"<div class=\"item\">\n  <a href=\"/p?id=)" + std::to_string(i) +
+             R"(\">link<\/a>\n<\/div>"})";
+    }
+    s += "]}";
+    return s;
+}
+
+static void BM_ParseEscapedPayload(benchmark::State& state) {
+    auto input = generate_escaped_payload_json();
+    for (auto _ : state) {
+        auto v = parse(input);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseEscapedPayload);
+
+/// Includes restoring the buffer each iteration (parse_insitu overwrites it).
+static void BM_ParseEscapedPayload_Insitu(benchmark::State& state) {
+    const auto input = generate_escaped_payload_json();
+    std::string buf = input;
+    for (auto _ : state) {
+        std::memcpy(buf.data(), input.data(), input.size());
+        auto v = parse_insitu(buf.data(), buf.size());
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_ParseEscapedPayload_Insitu);
+
+/// Parse and re-serialize without reading the strings; Arg(1) = lazy_unescape.
+static void BM_PassThroughEscapedPayload(benchmark::State& state) {
+    const auto input = generate_escaped_payload_json();
+    ParseOptions opts;
+    opts.borrow_strings = true;
+    opts.lazy_unescape = state.range(0) != 0;
+    for (auto _ : state) {
+        auto out = parse(input, opts).dump();
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_PassThroughEscapedPayload)->Arg(0)->Arg(1);
+
 static void BM_ParseUtf8Direct(benchmark::State& state) {
     auto input = generate_utf8_direct_json();
     for (auto _ : state) {
@@ -35,6 +35,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <memory_resource>
 #include <new>
 #include <utility>
@@ -127,6 +128,9 @@ public:
             ptr_ = initial_buf_;
             end_ = initial_buf_ + initial_size_;
             total_allocated_ = initial_size_;
+            // Restart geometric growth: otherwise every overflowing use
+            // doubles the block size again, without bound.
+            next_block_size_ = initial_size_ < 4096 ? 4096 : initial_size_ * 2;
         } else {
             // Heap-only arena: allocate a fresh block
             total_allocated_ = 0;
@@ -267,6 +271,31 @@ inline std::pmr::memory_resource* current_resource() noexcept {
     return std::pmr::new_delete_resource();
 }
 
+/// @brief MonotonicArena over an owned initial buffer.
+///
+/// reset() is O(1) and allocation-free as long as the contents fit in the
+/// buffer. rewind_or_grow() keeps it that way in steady state: a use that
+/// overflowed into heap blocks gets a larger buffer for the next one.
+struct BufferedArena {
+    std::unique_ptr<char[]> buf;
+    size_t size;
+    MonotonicArena arena;
+
+    explicit BufferedArena(size_t n)
+        : buf(new char[n]), size(n), arena(buf.get(), n) {}
+};
+
+/// @brief Prepare @p storage for its next use (see BufferedArena).
+inline void rewind_or_grow(std::unique_ptr<BufferedArena>& storage) {
+    MonotonicArena& arena = storage->arena;
+    if (JSON_UNLIKELY(arena.block_count() != 0)) {
+        const size_t used = arena.bytes_used();
+        storage = std::make_unique<BufferedArena>((used > storage->size ? used : storage->size) * 2);
+    } else {
+        arena.reset();
+    }
+}
+
 } // namespace detail
 
 /// @brief RAII guard that activates a MonotonicArena for the current thread.
@@ -0,0 +1,442 @@
+#pragma once
+
+/// @file array_stream.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Pull reader for the elements of a huge root array on a stream.
+///
+/// parse(std::istream&) reads the whole stream before parsing, so a 5 GB
+/// export needs more than 5 GB of memory. ArrayStreamReader reads the
+/// stream through a sliding window and parses one element of the root
+/// array at a time into an arena that is reset between elements:
+///
+/// @code
+///   std::ifstream in("export.json", std::ios::binary);
+///   yajson::ArrayStreamReader reader(in);
+///   while (reader.next()) {
+///       handle(reader.value());              // valid until the next next()
+///   }
+///
+///   for (const auto& v : yajson::ArrayStreamReader::open("export.json")) ...
+/// @endcode
+///
+/// Peak memory is the window, which holds at least one whole element, plus
+/// the arena of the current element: it is bounded by the largest element,
+/// not by the stream. Element boundaries are found by a byte scanner that
+/// tracks strings, brackets and (when enabled) comments; each element is
+/// then parsed by the regular parser, so grammar, options and error codes
+/// are those of parse(). Error locations are relative to the whole stream.
+///
+/// A malformed element throws ParseError from next() after the reader has
+/// moved past it, so reading may continue with the next element. Errors in
+/// the array itself (not an array, unterminated, trailing content) end the
+/// stream. String values are always copied out of the window
+/// (ParseOptions::borrow_strings does not apply).
+
+#include "arena.hpp"
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace yajson {
+
+/// @brief Single-pass reader over the elements of a root-level JSON array.
+///
+/// Movable, not copyable; iterators refer to the reader and are
+/// invalidated by moving it. The stream must outlive the reader (open()
+/// readers own their file).
+class ArrayStreamReader {
+public:
+    /// Default read size; the window grows only for elements larger than this.
+    static constexpr size_t kDefaultChunkSize = 64 * 1024;
+    /// Default per-element arena size; grows to fit the largest element seen.
+    static constexpr size_t kDefaultArenaSize = 64 * 1024;
+
+    explicit ArrayStreamReader(std::istream& is, const ParseOptions& opts = {},
+                               size_t chunk_size = kDefaultChunkSize)
+        : is_(&is), opts_(detail::copying_strings(opts))
+        , chunk_(chunk_size < 64 ? 64 : chunk_size)
+        , arena_(std::make_unique<detail::BufferedArena>(kDefaultArenaSize)) {
+        buf_.resize(chunk_);
+    }
+
+    /// @brief Read the array in a file.
+    /// @throws ParseError if the file cannot be opened.
+    [[nodiscard]] static ArrayStreamReader open(const char* path, const ParseOptions& opts = {},
+                                                size_t chunk_size = kDefaultChunkSize) {
+        auto file = std::make_unique<std::ifstream>(path, std::ios::binary);
+        if (!*file) {
+            throw ParseError("cannot open file", SourceLocation{},
+                             errc::unexpected_end_of_input);
+        }
+        ArrayStreamReader r(*file, opts, chunk_size);
+        r.file_ = std::move(file);
+        return r;
+    }
+
+    [[nodiscard]] static ArrayStreamReader open(const std::string& path,
+                                                const ParseOptions& opts = {},
+                                                size_t chunk_size = kDefaultChunkSize) {
+        return open(path.c_str(), opts, chunk_size);
+    }
+
+    ArrayStreamReader(ArrayStreamReader&&) noexcept = default;
+    ArrayStreamReader(const ArrayStreamReader&) = delete;
+    ArrayStreamReader& operator=(const ArrayStreamReader&) = delete;
+    ArrayStreamReader& operator=(ArrayStreamReader&&) = delete;
+
+    /// @brief Input iterator over elements; dereferences to the current value.
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = JsonValue;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const JsonValue*;
+        using reference = const JsonValue&;
+
+        iterator() = default;
+
+        reference operator*() const noexcept { return reader_->value_; }
+        pointer operator->() const noexcept { return &reader_->value_; }
+
+        iterator& operator++() {
+            if (!reader_->next()) reader_ = nullptr;
+            return *this;
+        }
+
+        bool operator==(const iterator& o) const noexcept { return reader_ == o.reader_; }
+        bool operator!=(const iterator& o) const noexcept { return reader_ != o.reader_; }
+
+    private:
+        friend class ArrayStreamReader;
+        explicit iterator(ArrayStreamReader* r) noexcept : reader_(r) {}
+        ArrayStreamReader* reader_ = nullptr;
+    };
+
+    /// @brief Read the next element and return an iterator to it (the
+    /// stream is read once: call begin() once).
+    [[nodiscard]] iterator begin() { return next() ? iterator(this) : iterator(); }
+
+    [[nodiscard]] iterator end() noexcept { return iterator(); }
+
+    /// @brief Advance to the next element; returns false after the last one.
+    /// The previous value is invalidated.
+    /// @throws ParseError on invalid JSON (see the file header).
+    bool next() {
+        value_ = JsonValue();
+        if (done_) return false;
+        if (close_pending_) {
+            finish_array();
+            return false;
+        }
+        if (!started_) {
+            open_array();
+            if (done_) return false;
+        }
+
+        const size_t stop = find_separator();
+        const char sep = buf_[stop];
+        const char* const first = buf_.data() + begin_;
+        const char* const last = buf_.data() + stop;
+        if (is_blank(first, last)) {
+            // "[]", "[1,]" (trailing comma) or a missing element
+            const bool close = sep == ']' &&
+                               (count_ == 0 || (after_comma_ && opts_.allow_trailing_commas));
+            if (close) {
+                consume(stop + 1);
+                finish_array();
+                return false;
+            }
+            fail(stop, std::string("unexpected character '") + sep + "'",
+                 errc::unexpected_character);
+        }
+        if (JSON_UNLIKELY(sep == '}')) {
+            fail(stop, "expected ',' or ']' in array", errc::unexpected_character);
+        }
+
+        const SourceLocation origin = loc_;
+        consume(stop + 1);
+        after_comma_ = sep == ',';
+        if (sep == ']') close_pending_ = true;
+        ++count_;
+
+        value_ = parse_element(first, last, origin);
+        return true;
+    }
+
+    /// @brief The current element (valid after a successful next()).
+    [[nodiscard]] const JsonValue& value() const noexcept { return value_; }
+
+    /// @brief Number of elements read so far.
+    [[nodiscard]] size_t count() const noexcept { return count_; }
+
+    /// @brief Bytes of the stream consumed so far.
+    [[nodiscard]] size_t offset() const noexcept { return loc_.offset; }
+
+    /// @brief Current size of the read window in bytes.
+    [[nodiscard]] size_t buffer_capacity() const noexcept { return buf_.size(); }
+
+private:
+    enum class Comment : uint8_t { None, Slash, Line, Block, BlockStar };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // value_ is declared after arena_ so it is destroyed first
+    std::istream* is_;
+    std::unique_ptr<std::ifstream> file_;
+    ParseOptions opts_;
+    size_t chunk_;
+    std::unique_ptr<detail::BufferedArena> arena_;
+    JsonValue value_;
+
+    std::string buf_;          ///< Window; [begin_, len_) is unconsumed input
+    size_t begin_ = 0;
+    size_t len_ = 0;
+    size_t scan_ = 0;          ///< Separator scan position in [begin_, len_]
+    SourceLocation loc_{};     ///< Stream location of buf_[begin_]
+    bool eof_ = false;
+
+    // Separator scanner state, kept across refills
+    size_t depth_ = 0;
+    char quote_ = 0;           ///< Open string delimiter, 0 outside strings
+    bool escape_ = false;
+    Comment comment_ = Comment::None;
+
+    bool started_ = false;
+    bool done_ = false;
+    bool after_comma_ = false;
+    bool close_pending_ = false;  ///< The root ']' was consumed with the last element
+    size_t count_ = 0;
+
+    /// True if [p, end) holds only whitespace and (when enabled) comments.
+    bool is_blank(const char* p, const char* end) const noexcept {
+        while (p < end) {
+            const char c = *p;
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                ++p;
+            } else if (c == '/' && opts_.allow_comments && end - p >= 2 && p[1] == '/') {
+                p = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+                if (!p) return true;
+            } else if (c == '/' && opts_.allow_comments && end - p >= 2 && p[1] == '*') {
+                for (p += 2; p < end && !(p[0] == '*' && p + 1 < end && p[1] == '/');) ++p;
+                p += 2;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[noreturn]] void fail(size_t pos, const std::string& msg, errc code) {
+        SourceLocation loc = loc_;
+        detail::ParserBase::advance_location(loc, buf_.data() + begin_, buf_.data() + pos);
+        done_ = true;
+        throw ParseError(msg, loc, code);
+    }
+
+    void consume(size_t to) noexcept {
+        detail::ParserBase::advance_location(loc_, buf_.data() + begin_, buf_.data() + to);
+        begin_ = to;
+        if (scan_ < to) scan_ = to;
+    }
+
+    /// Parse the element text [first, last), which starts at @p origin.
+    JsonValue parse_element(const char* first, const char* last, const SourceLocation& origin) {
+        detail::rewind_or_grow(arena_);
+        ArenaScope scope(arena_->arena);
+        const std::string_view text(first, static_cast<size_t>(last - first));
+        try {
+            return detail::Parser::parse_at(text, opts_, arena_->arena, origin);
+        } catch (const ParseError& e) {
+            // Content after a complete element: parse() reports the missing
+            // separator, not trailing content
+            if (e.code() != errc::trailing_content) throw;
+            throw ParseError("expected ',' or ']' in array", e.location(),
+                             errc::unexpected_character);
+        }
+    }
+
+    /// Move the unconsumed input to the front of the window and read more;
+    /// returns false at end of stream.
+    bool refill() {
+        if (eof_) return false;
+        if (begin_ > 0) {
+            std::memmove(buf_.data(), buf_.data() + begin_, len_ - begin_);
+            len_ -= begin_;
+            scan_ -= begin_;
+            begin_ = 0;
+        }
+        if (buf_.size() - len_ < chunk_ / 2) buf_.resize(buf_.size() * 2);
+        is_->read(buf_.data() + len_, static_cast<std::streamsize>(buf_.size() - len_));
+        const auto n = static_cast<size_t>(is_->gcount());
+        len_ += n;
+        if (n == 0) eof_ = true;
+        return n != 0;
+    }
+
+    /// Advance over comment bytes from @p p (comment_ != None).
+    size_t scan_comment(size_t p) noexcept {
+        const char* const base = buf_.data();
+        switch (comment_) {
+            case Comment::Slash:
+                if (base[p] == '/') comment_ = Comment::Line, ++p;
+                else if (base[p] == '*') comment_ = Comment::Block, ++p;
+                else comment_ = Comment::None;  // not a comment: the parser rejects the '/'
+                return p;
+            case Comment::Line: {
+                const void* nl = std::memchr(base + p, '\n', len_ - p);
+                if (!nl) return len_;
+                comment_ = Comment::None;
+                return static_cast<size_t>(static_cast<const char*>(nl) - base) + 1;
+            }
+            case Comment::Block: {
+                const void* star = std::memchr(base + p, '*', len_ - p);
+                if (!star) return len_;
+                comment_ = Comment::BlockStar;
+                return static_cast<size_t>(static_cast<const char*>(star) - base) + 1;
+            }
+            case Comment::BlockStar:
+                if (base[p] == '/') comment_ = Comment::None;
+                else if (base[p] != '*') comment_ = Comment::Block;
+                return p + 1;
+            default:
+                return p;
+        }
+    }
+
+    /// Position of the ',' or closing bracket at root-array depth that ends
+    /// the element starting at begin_, reading more input as needed.
+    size_t find_separator() {
+        for (;;) {
+            const size_t stop = scan_separator();
+            if (stop != npos) return stop;
+            if (!refill()) unterminated();
+        }
+    }
+
+    size_t scan_separator() noexcept {
+        const char* const base = buf_.data();
+        const char* const end = base + len_;
+        size_t i = scan_;
+        while (i < len_) {
+            if (comment_ != Comment::None) {
+                i = scan_comment(i);
+                continue;
+            }
+            if (quote_ != 0) {
+                if (escape_) {
+                    escape_ = false;
+                    ++i;
+                    continue;
+                }
+                if (quote_ == '"') {
+                    const char* d = detail::simd::find_string_delimiter(base + i, end);
+                    i = static_cast<size_t>(d - base);
+                    if (i >= len_) break;
+                }
+                const char c = base[i++];
+                if (c == '\\') escape_ = true;
+                else if (c == quote_) quote_ = 0;
+                continue;
+            }
+            switch (base[i]) {
+                case '"': quote_ = '"'; break;
+                case '\'':
+                    if (opts_.allow_single_quotes) quote_ = '\'';
+                    break;
+                case '/':
+                    if (opts_.allow_comments) comment_ = Comment::Slash;
+                    break;
+                case '[':
+                case '{': ++depth_; break;
+                case ']':
+                case '}':
+                    if (depth_ == 0) {
+                        scan_ = i;
+                        return i;
+                    }
+                    --depth_;
+                    break;
+                case ',':
+                    if (depth_ == 0) {
+                        scan_ = i;
+                        return i;
+                    }
+                    break;
+                default: break;
+            }
+            ++i;
+        }
+        scan_ = len_;
+        return npos;
+    }
+
+    /// Skip whitespace and comments from begin_; returns false at end of stream.
+    bool skip_blank() {
+        for (;;) {
+            size_t i = begin_;
+            while (i < len_) {
+                if (comment_ != Comment::None) {
+                    i = scan_comment(i);
+                    continue;
+                }
+                const char c = buf_[i];
+                if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                    ++i;
+                    continue;
+                }
+                if (c == '/' && opts_.allow_comments) {
+                    if (i + 1 >= len_) break;  // the next byte decides
+                    if (buf_[i + 1] == '/' || buf_[i + 1] == '*') {
+                        comment_ = buf_[i + 1] == '/' ? Comment::Line : Comment::Block;
+                        i += 2;
+                        continue;
+                    }
+                }
+                consume(i);
+                return true;
+            }
+            consume(i);
+            // A lone '/' at the very end is left for the caller to reject
+            if (!refill()) return begin_ < len_;
+        }
+    }
+
+    void open_array() {
+        started_ = true;
+        if (!skip_blank()) fail(len_, "unexpected end of input", errc::unexpected_end_of_input);
+        if (buf_[begin_] != '[') {
+            fail(begin_, std::string("expected '[', got '") + buf_[begin_] + "'",
+                 errc::unexpected_character);
+        }
+        consume(begin_ + 1);
+    }
+
+    /// After the root ']': only whitespace (and comments) may follow.
+    void finish_array() {
+        done_ = true;
+        if (skip_blank()) fail(begin_, "unexpected trailing content", errc::trailing_content);
+    }
+
+    /// End of stream inside the array: report what parse() would report
+    /// for the pending element, else the unterminated array.
+    [[noreturn]] void unterminated() {
+        const char* const first = buf_.data() + begin_;
+        const char* const last = buf_.data() + len_;
+        done_ = true;
+        if (!is_blank(first, last)) (void)parse_element(first, last, loc_);
+        fail(len_, "unterminated array", errc::unterminated_array);
+    }
+};
+
+} // namespace yajson
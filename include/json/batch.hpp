@@ -0,0 +1,145 @@
+#pragma once
+
+/// @file batch.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Parsing many small documents in one call.
+///
+/// A frame of RPC messages is typically hundreds of ~150-byte documents.
+/// At that size the fixed cost of a parse() call — setting up the stack
+/// scratch resource, the TLS arena lookup, the policy dispatch and the
+/// exception machinery on errors — is a large share of the work.
+/// parse_batch() pays it once per batch:
+///
+/// @code
+///   std::vector<std::string_view> msgs = split_frame(frame);
+///   std::vector<yajson::result<yajson::JsonValue>> out(msgs.size());
+///   yajson::MonotonicArena arena(64 * 1024);
+///   yajson::parse_batch(msgs.data(), msgs.size(), arena, out.data());
+///   for (const auto& r : out) if (r) handle(r.value);
+///   out.clear();                                 // before the arena is reset
+///   arena.reset();
+/// @endcode
+///
+/// All values of a batch live in the one arena and are valid until it is
+/// reset. A failed document gets a null value and its error code; it does
+/// not stop the batch. ParallelBatch spreads a large batch over threads,
+/// each with its own arena.
+
+#include "arena.hpp"
+#include "error.hpp"
+#include "parallel.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace yajson {
+
+/// @brief Parse inputs[0..count) into out[0..count), allocating every
+/// value from @p arena.
+///
+/// Equivalent to calling try_parse(inputs[i], arena, opts) for each i, with
+/// the per-call setup done once. A document whose allocation fails gets
+/// std::errc::not_enough_memory rather than a json errc.
+/// @return Number of documents that failed to parse.
+inline size_t parse_batch(const std::string_view* inputs, size_t count,
+                          MonotonicArena& arena, result<JsonValue>* out,
+                          const ParseOptions& opts = {}) noexcept {
+    ArenaScope scope(arena);
+    return detail::Parser::parse_batch(inputs, count, opts, out);
+}
+
+/// @brief parse_batch() over a vector; @p out is resized to match.
+inline size_t parse_batch(const std::vector<std::string_view>& inputs, MonotonicArena& arena,
+                          std::vector<result<JsonValue>>& out,
+                          const ParseOptions& opts = {}) {
+    out.resize(inputs.size());
+    return parse_batch(inputs.data(), inputs.size(), arena, out.data(), opts);
+}
+
+namespace detail {
+
+/// Smallest share of a batch worth a thread of its own.
+inline constexpr size_t kBatchMinPerThread = 64;
+
+} // namespace detail
+
+/// @brief Multi-threaded parse_batch() with per-thread arenas owned by the
+/// batch.
+///
+/// The batch is cut into contiguous runs of documents, one per thread, and
+/// each run is parsed with parse_batch() into its thread's arena. Results
+/// are valid until reset(), the next parse() or destruction.
+class ParallelBatch {
+public:
+    ParallelBatch() = default;
+    ~ParallelBatch() { reset(); }
+
+    ParallelBatch(const ParallelBatch&) = delete;
+    ParallelBatch& operator=(const ParallelBatch&) = delete;
+
+    /// @brief Parse inputs[0..count) with up to @p n_threads threads
+    /// (0 = std::thread::hardware_concurrency()); results() is updated.
+    /// @return Number of documents that failed to parse.
+    size_t parse(const std::string_view* inputs, size_t count, size_t n_threads = 0,
+                 const ParseOptions& opts = {}) {
+        if (n_threads == 0) n_threads = std::max(1u, std::thread::hardware_concurrency());
+        n_threads = std::max<size_t>(1, std::min(n_threads, count / detail::kBatchMinPerThread));
+        reset();
+        results_.resize(count);
+
+        size_t bytes = 0;
+        for (size_t i = 0; i < count; ++i) bytes += inputs[i].size();
+        const size_t per_thread = bytes / n_threads + 4096;
+        while (arenas_.size() < n_threads) {
+            arenas_.push_back(std::make_unique<MonotonicArena>(per_thread));
+        }
+
+        std::vector<size_t> failures(n_threads, 0);
+        detail::run_threads(n_threads, [&](size_t t) {
+            const size_t first = count * t / n_threads;
+            const size_t last = count * (t + 1) / n_threads;
+            failures[t] = parse_batch(inputs + first, last - first, *arenas_[t],
+                                      results_.data() + first, opts);
+        });
+        size_t total = 0;
+        for (size_t f : failures) total += f;
+        return total;
+    }
+
+    /// @brief parse() over a vector.
+    size_t parse(const std::vector<std::string_view>& inputs, size_t n_threads = 0,
+                 const ParseOptions& opts = {}) {
+        return parse(inputs.data(), inputs.size(), n_threads, opts);
+    }
+
+    /// @brief One result per input of the last parse(), in input order.
+    [[nodiscard]] const std::vector<result<JsonValue>>& results() const noexcept {
+        return results_;
+    }
+
+    /// @brief Release the results and rewind the arenas (kept for reuse).
+    void reset() noexcept {
+        results_.clear();
+        for (auto& a : arenas_) a->reset();
+    }
+
+    /// @brief Total bytes held by the per-thread arenas.
+    [[nodiscard]] size_t bytes_allocated() const noexcept {
+        size_t n = 0;
+        for (const auto& a : arenas_) n += a->bytes_allocated();
+        return n;
+    }
+
+private:
+    std::vector<std::unique_ptr<MonotonicArena>> arenas_;
+    std::vector<result<JsonValue>> results_;
+};
+
+} // namespace yajson
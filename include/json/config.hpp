@@ -90,6 +90,16 @@
     #define YAJSON_MAX_DEPTH 512
 #endif
 
+// =====================================================================
+// Input padding (parse_padded, PaddedString)
+// =====================================================================
+// Readable bytes required after a padded input; the first must be NUL.
+// At least one full 64-byte SIMD block.
+
+#if !defined(YAJSON_PADDING)
+    #define YAJSON_PADDING 64
+#endif
+
 // =====================================================================
 // Small object threshold for linear vs hash lookup
 // =====================================================================
@@ -125,8 +125,17 @@ inline void from_json(const JsonValue& j, JsonValue& v)    { v = j; }
 
 template <typename T>
 void from_json(const JsonValue& j, std::vector<T>& vec) {
-    const auto& arr = j.as_array();
     vec.clear();
+    if (j.is_packed()) {  // read element by element, without expanding it
+        vec.reserve(j.size());
+        for (size_t i = 0; i < j.size(); ++i) {
+            T val{};
+            from_json(j.element(i), val);
+            vec.push_back(std::move(val));
+        }
+        return;
+    }
+    const auto& arr = j.as_array();
     vec.reserve(arr.size());
     for (const auto& elem : arr) {
         T val{};
@@ -7,25 +7,19 @@
 /// Optimizations:
 ///   1. Integer fast path: ~40% of JSON numbers are exact integers.
 ///      Uses integer formatting + ".0" suffix (4-6x faster than to_chars(double)).
-///   2. Fixed-point fast path: numbers with <= 9 decimal places (e.g. 3.14, 37.7749295)
-///      are formatted via integer arithmetic without calling to_chars(double).
-///   3. General case: fallback to std::to_chars (Ryu implementation in libstdc++/libc++).
-///
-/// Note: on modern compilers (GCC 11+, Clang 14+, MSVC 19.24+)
-/// std::to_chars(double) already uses the Ryu algorithm internally, providing
-/// performance on par with a standalone implementation. Dragonbox gives
-/// an additional ~30-40%, but requires embedding ~800 lines of code with tables.
+///   2. General case: the shortest round-trip digits from Dragonbox
+///      (detail/dragonbox.hpp), formatted here. Same speed on every
+///      standard library, unlike std::to_chars(double).
 ///
 /// Additional micro-optimizations:
 ///   - Two-digit pair table "00".."99": halves the number of divisions in write_u64.
 ///   - Digit counting via __builtin_clzll: direct writing without buffer reversal.
 
 #include "../config.hpp"
+#include "dragonbox.hpp"
 
-#include <charconv>
 #include <cmath>
 #include <cstdint>
-#include <cstdio>
 #include <cstring>
 
 namespace yajson::detail {
@@ -46,12 +40,6 @@ inline constexpr char kDigitPairs[201] =
     "80818283848586878889"
     "90919293949596979899";
 
-/// Precomputed powers of 10 (double) for the fixed-point fast path.
-inline constexpr double kPow10[] = {
-    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
-    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15
-};
-
 /// Precomputed powers of 10 (uint64_t) for digit counting.
 /// kPow10U64[0] = 0 (sentinel); kPow10U64[i] = 10^i for i = 1..19.
 inline constexpr uint64_t kPow10U64[] = {
@@ -150,6 +138,73 @@ JSON_ALWAYS_INLINE char* write_u64(char* buf, uint64_t val) noexcept {
 
 // ─── Double to string conversion ───────────────────────────────────────────
 
+/// @brief Format significand * 10^exp10 (shortest digits) the way
+/// std::to_chars(double) does: fixed or scientific notation, whichever is
+/// shorter, fixed on a tie. Fixed notation always gets a '.' ("1e+21" has
+/// an 'e'), so the result reads back as a float. Large integers print their
+/// shortest digits followed by zeros, not their exact binary value.
+///
+/// @param buf Output buffer (>= 26 bytes).
+/// @return Pointer past the last written character.
+inline char* write_shortest(char* buf, uint64_t significand, int32_t exp10) noexcept {
+    char digits[20];
+    const int n = static_cast<int>(write_u64(digits, significand) - digits);
+    const int sci_exp = exp10 + n - 1;
+
+    const int abs_exp = sci_exp < 0 ? -sci_exp : sci_exp;
+    const int sci_len = n + (n > 1) + 2 + (abs_exp >= 100 ? 3 : 2);
+    int fixed_len;
+    if (exp10 >= 0)       fixed_len = n + exp10;
+    else if (sci_exp >= 0) fixed_len = n + 1;
+    else                  fixed_len = n + 1 - sci_exp;
+
+    if (fixed_len <= sci_len) {
+        if (exp10 >= 0) {
+            // 1.2345678901234566e17 -> "123456789012345660.0"
+            std::memcpy(buf, digits, static_cast<size_t>(n));
+            buf += n;
+            std::memset(buf, '0', static_cast<size_t>(exp10));
+            buf += exp10;
+            *buf++ = '.';
+            *buf++ = '0';
+        } else if (sci_exp >= 0) {
+            // 123.45
+            const int int_digits = sci_exp + 1;
+            std::memcpy(buf, digits, static_cast<size_t>(int_digits));
+            buf += int_digits;
+            *buf++ = '.';
+            std::memcpy(buf, digits + int_digits, static_cast<size_t>(n - int_digits));
+            buf += n - int_digits;
+        } else {
+            // 0.00123
+            *buf++ = '0';
+            *buf++ = '.';
+            std::memset(buf, '0', static_cast<size_t>(-sci_exp - 1));
+            buf += -sci_exp - 1;
+            std::memcpy(buf, digits, static_cast<size_t>(n));
+            buf += n;
+        }
+        return buf;
+    }
+
+    // 1.2345e-07, 1e+300
+    *buf++ = digits[0];
+    if (n > 1) {
+        *buf++ = '.';
+        std::memcpy(buf, digits + 1, static_cast<size_t>(n - 1));
+        buf += n - 1;
+    }
+    *buf++ = 'e';
+    *buf++ = sci_exp < 0 ? '-' : '+';
+    if (abs_exp >= 100) {
+        *buf++ = static_cast<char>('0' + abs_exp / 100);
+        std::memcpy(buf, kDigitPairs + (abs_exp % 100) * 2, 2);
+    } else {
+        std::memcpy(buf, kDigitPairs + abs_exp * 2, 2);
+    }
+    return buf + 2;
+}
+
 /// @brief Convert double to shortest decimal string representation.
 ///
 /// Guarantees:
@@ -175,7 +230,7 @@ inline size_t fast_dtoa(char* buf, double val) noexcept {
         val = -val;
     }
 
-    // ── Fast path 1: Exact integers ─────────────────────────────
+    // ── Fast path: Exact integers ───────────────────────────────
     // Covers ~40% of real-world JSON numbers (counters, IDs, timestamps, etc.)
     // Integer write_u64 is 4-6x faster than to_chars(double).
     if (val <= kMaxSafeInteger && val == std::floor(val)) {
@@ -186,89 +241,9 @@ inline size_t fast_dtoa(char* buf, double val) noexcept {
         return static_cast<size_t>(buf - start);
     }
 
-    // ── Fast path 2: Fixed point (k = 1..9) ─────────────────
-    // For numbers in a reasonable range, check: val * 10^k is an exact integer.
-    // Extending to k=9 (was k=6) covers:
-    //   - GPS coordinates (37.7749295)
-    //   - sensor readings (0.123456789)
-    //   - currency exchange rates (1.23456789)
-    // If FP multiplication introduces rounding error, the check correctly
-    // rejects — never produces incorrect output.
-    if (val < 1e15 && val > 1e-6) {
-        for (int k = 1; k <= 9; ++k) {
-            const double scaled = val * kPow10[k];
-            // Early exit: once scaled exceeds safe integer range,
-            // all subsequent k values will too (monotonically increasing).
-            if (scaled > kMaxSafeInteger) break;
-            if (scaled == std::floor(scaled)) {
-                const auto ival = static_cast<uint64_t>(scaled);
-
-                // Format as digits, then insert the decimal point.
-                char digits[24];
-                char* dend = write_u64(digits, ival);
-                const int total_digits = static_cast<int>(dend - digits);
-                const int int_digits = total_digits - k;
-
-                if (int_digits <= 0) {
-                    // Number < 1, e.g. 0.005 → "0.005"
-                    *buf++ = '0';
-                    *buf++ = '.';
-                    for (int i = 0; i < -int_digits; ++i) *buf++ = '0';
-                    std::memcpy(buf, digits, static_cast<size_t>(total_digits));
-                    buf += total_digits;
-                } else {
-                    // Number >= 1, e.g. 123.45 → "123.45"
-                    std::memcpy(buf, digits, static_cast<size_t>(int_digits));
-                    buf += int_digits;
-                    *buf++ = '.';
-                    std::memcpy(buf, digits + int_digits, static_cast<size_t>(k));
-                    buf += k;
-                }
-                return static_cast<size_t>(buf - start);
-            }
-        }
-    }
-
-    // ── General case: fallback to std::to_chars ────────────────────────────
-    // On GCC 11+ / Clang 14+ / MSVC 19.24+ internally uses the Ryu algorithm.
-#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
-    auto [ptr, ec] = std::to_chars(buf, buf + 24, val);
-    const auto len = static_cast<size_t>(ptr - buf);
-
-    // Ensure the output contains '.' or 'e' for a valid JSON literal.
-    bool has_dot = false;
-    for (size_t i = 0; i < len; ++i) {
-        const char c = buf[i];
-        if (c == '.' || c == 'e' || c == 'E') {
-            has_dot = true;
-            break;
-        }
-    }
-    buf = ptr;
-    if (!has_dot) {
-        *buf++ = '.';
-        *buf++ = '0';
-    }
-#else
-    // Fallback for compilers without to_chars(double).
-    const int n = std::snprintf(buf, 32, "%.17g", val);
-    if (n > 0) {
-        bool has_dot = false;
-        for (int i = 0; i < n; ++i) {
-            const char c = buf[i];
-            if (c == '.' || c == 'e' || c == 'E') {
-                has_dot = true;
-                break;
-            }
-        }
-        buf += n;
-        if (!has_dot) {
-            *buf++ = '.';
-            *buf++ = '0';
-        }
-    }
-#endif
-
+    // ── General case: shortest round-trip digits ──────────────────────
+    const ShortestDecimal d = to_shortest(val);
+    buf = write_shortest(buf, d.significand, d.exponent);
     return static_cast<size_t>(buf - start);
 }
 
@@ -9,8 +9,11 @@
 ///   - ARM/AArch64: NEON 16 bytes/iteration, AArch64 2×16 = 32 bytes/iteration
 /// Falls back to scalar implementation when SIMD is unavailable.
 
+#include "utf8.hpp"
+
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 // ─── Detection of available SIMD extensions ──────────────────────────────────
 #if defined(YAJSON_SIMD_ENABLED)
@@ -287,6 +290,78 @@ inline const char* find_string_delimiter(const char* ptr,
     return ptr;
 }
 
+// ═════════════════════════════════════════════════════════════════════════════
+//  find_newline — find the next '\n' (record separator for NDJSON)
+// ═════════════════════════════════════════════════════════════════════════════
+
+inline const char* find_newline(const char* ptr, const char* end) noexcept {
+#if defined(YAJSON_AVX2)
+    const __m256i nl = _mm256_set1_epi8('\n');
+
+    // 2×32 bytes per iteration: records are typically hundreds of bytes long
+    while (ptr + 64 <= end) {
+        __m256i chunk0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+        __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+        __m256i cmp0 = _mm256_cmpeq_epi8(chunk0, nl);
+        __m256i cmp1 = _mm256_cmpeq_epi8(chunk1, nl);
+        if (!_mm256_testz_si256(_mm256_or_si256(cmp0, cmp1), _mm256_or_si256(cmp0, cmp1))) {
+            uint32_t mask0 = static_cast<uint32_t>(_mm256_movemask_epi8(cmp0));
+            if (mask0 != 0) return ptr + ctz32(mask0);
+            return ptr + 32 + ctz32(static_cast<uint32_t>(_mm256_movemask_epi8(cmp1)));
+        }
+        ptr += 64;
+    }
+    while (ptr + 32 <= end) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, nl)));
+        if (mask != 0) return ptr + ctz32(mask);
+        ptr += 32;
+    }
+
+#elif defined(YAJSON_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+
+    while (ptr + 16 <= end) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, nl));
+        if (mask != 0) return ptr + ctz32(static_cast<uint32_t>(mask));
+        ptr += 16;
+    }
+
+#elif defined(YAJSON_NEON)
+    const uint8x16_t nl = vdupq_n_u8('\n');
+
+#if defined(YAJSON_NEON_64)
+    // AArch64: a horizontal max decides whether the 32-byte block has a hit
+    while (ptr + 32 <= end) {
+        uint8x16_t cmp0 = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(ptr)), nl);
+        uint8x16_t cmp1 = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(ptr + 16)), nl);
+        if (vmaxvq_u8(vorrq_u8(cmp0, cmp1)) != 0) {
+            uint16_t mask0 = neon_movemask(cmp0);
+            if (mask0 != 0) return ptr + ctz32(mask0);
+            return ptr + 16 + ctz32(neon_movemask(cmp1));
+        }
+        ptr += 32;
+    }
+#endif // YAJSON_NEON_64
+
+    while (ptr + 16 <= end) {
+        uint8x16_t cmp = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(ptr)), nl);
+        uint16_t mask = neon_movemask(cmp);
+        if (mask != 0) return ptr + ctz32(mask);
+        ptr += 16;
+    }
+#endif
+
+    // Scalar fallback
+    while (ptr < end) {
+        if (*ptr == '\n') return ptr;
+        ++ptr;
+    }
+    return ptr;
+}
+
 // ═════════════════════════════════════════════════════════════════════════════
 //  find_needs_escape — templated on EnsureAscii for branch elimination
 // ═════════════════════════════════════════════════════════════════════════════
@@ -428,4 +503,197 @@ inline const char* find_needs_escape(const char* ptr, const char* end,
         return find_needs_escape<false>(ptr, end);
 }
 
+// ═════════════════════════════════════════════════════════════════════════════
+//  validate_utf8 — find the first byte of malformed UTF-8
+// ═════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/// @brief Scalar re-scan of a range whose bytes before @p ptr were accepted
+/// block by block: restarts at the first sequence that may cross into
+/// @p ptr (the earliest non-continuation byte among the 3 before it).
+inline const char* validate_utf8_from(const char* begin, const char* ptr,
+                                      const char* end) noexcept {
+    const char* from = ptr;
+    for (ptrdiff_t k = 3; k >= 1; --k) {
+        if (ptr - begin >= k && (static_cast<unsigned char>(ptr[-k]) & 0xC0) != 0x80) {
+            from = ptr - k;
+            break;
+        }
+    }
+    return utf8::find_invalid(from, end);
+}
+
+} // anonymous namespace
+
+/// @brief Find the first byte that does not start a valid UTF-8 sequence.
+/// Same result as utf8::find_invalid().
+///
+/// AVX2 checks 32 bytes per iteration with the lookup algorithm of Keiser
+/// and Lemire ("Validating UTF-8 In Less Than One Instruction Per Byte"):
+/// three nibble-table lookups classify each pair of adjacent bytes, and the
+/// 3rd/4th bytes of long sequences are checked with saturating subtractions.
+/// Only the 0/1 outcome is vectorized; the block holding the first error,
+/// and the tail, are re-scanned with the scalar decoder for the exact
+/// position. Other targets skip ASCII runs 16 (SSE2/NEON) or 8 bytes at a
+/// time and decode the rest with the scalar decoder.
+inline const char* validate_utf8(const char* ptr, const char* end) noexcept {
+    const char* const begin = ptr;
+#if defined(YAJSON_AVX2)
+    // Error classes of a (previous byte, byte) pair; see the paper for the
+    // derivation of the three tables.
+    constexpr uint8_t kTooShort     = 1 << 0;  // 11______ 0_______ / 11______ 11______
+    constexpr uint8_t kTooLong      = 1 << 1;  // 0_______ 10______
+    constexpr uint8_t kOverlong3    = 1 << 2;  // 11100000 100_____
+    constexpr uint8_t kTooLarge     = 1 << 3;  // 11110100 1001____ and above
+    constexpr uint8_t kSurrogate    = 1 << 4;  // 11101101 101_____
+    constexpr uint8_t kOverlong2    = 1 << 5;  // 1100000_ 10______
+    constexpr uint8_t kTooLarge1000 = 1 << 6;  // 11110101+ 1000____
+    constexpr uint8_t kOverlong4    = 1 << 6;  // 11110000 1000____
+    constexpr uint8_t kTwoConts     = 1 << 7;  // 10______ 10______ (unless 3rd/4th byte)
+    constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+    auto table = [](auto... v) {  // the same 16 entries in both lanes
+        return _mm256_setr_epi8(static_cast<char>(v)..., static_cast<char>(v)...);
+    };
+    const __m256i byte1_high = table(
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+        kTooShort | kOverlong2,
+        kTooShort,
+        kTooShort | kOverlong3 | kSurrogate,
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4);
+    const __m256i byte1_low = table(
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+        kCarry | kOverlong2,
+        kCarry, kCarry,
+        kCarry | kTooLarge,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000);
+    const __m256i byte2_high = table(
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooShort, kTooShort, kTooShort, kTooShort);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i third_min = _mm256_set1_epi8(static_cast<char>(0xE0u - 0x80u));
+    const __m256i fourth_min = _mm256_set1_epi8(static_cast<char>(0xF0u - 0x80u));
+    const __m256i high_bit = _mm256_set1_epi8(static_cast<char>(0x80u));
+    // Non-zero where a block ends inside a sequence that the next must finish
+    __m256i incomplete_max = _mm256_set1_epi8(static_cast<char>(0xFFu));
+    incomplete_max = _mm256_insert_epi8(incomplete_max, static_cast<char>(0xF0u - 1), 29);
+    incomplete_max = _mm256_insert_epi8(incomplete_max, static_cast<char>(0xE0u - 1), 30);
+    incomplete_max = _mm256_insert_epi8(incomplete_max, static_cast<char>(0xC0u - 1), 31);
+
+    __m256i prev_in = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    while (ptr + 32 <= end) {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+        __m256i err;
+        if (_mm256_movemask_epi8(in) == 0) {
+            err = prev_incomplete;
+            prev_incomplete = _mm256_setzero_si256();
+        } else {
+            // prevN: the input shifted by N bytes, continuing from prev_in
+            const __m256i carry = _mm256_permute2x128_si256(prev_in, in, 0x21);
+            const __m256i prev1 = _mm256_alignr_epi8(in, carry, 15);
+            const __m256i prev2 = _mm256_alignr_epi8(in, carry, 14);
+            const __m256i prev3 = _mm256_alignr_epi8(in, carry, 13);
+            const __m256i special = _mm256_and_si256(
+                _mm256_and_si256(
+                    _mm256_shuffle_epi8(byte1_high,
+                                        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                    _mm256_shuffle_epi8(byte1_low, _mm256_and_si256(prev1, nibble))),
+                _mm256_shuffle_epi8(byte2_high,
+                                    _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+            const __m256i must23 = _mm256_and_si256(
+                _mm256_or_si256(_mm256_subs_epu8(prev2, third_min),
+                                _mm256_subs_epu8(prev3, fourth_min)),
+                high_bit);
+            err = _mm256_xor_si256(must23, special);
+            prev_incomplete = _mm256_subs_epu8(in, incomplete_max);
+        }
+        if (!_mm256_testz_si256(err, err)) return validate_utf8_from(begin, ptr, end);
+        prev_in = in;
+        ptr += 32;
+    }
+    return validate_utf8_from(begin, ptr, end);
+
+#else
+    while (ptr < end) {
+        // Skip whole ASCII blocks
+#if defined(YAJSON_SSE2)
+        while (ptr + 16 <= end &&
+               _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))) == 0) {
+            ptr += 16;
+        }
+#elif defined(YAJSON_NEON)
+        const uint8x16_t high_bit = vdupq_n_u8(0x80);
+        while (ptr + 16 <= end &&
+               neon_movemask(vtstq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(ptr)),
+                                      high_bit)) == 0) {
+            ptr += 16;
+        }
+#else
+        for (uint64_t w; ptr + 8 <= end; ptr += 8) {
+            std::memcpy(&w, ptr, 8);
+            if (w & 0x8080808080808080ull) break;
+        }
+#endif
+        // Decode up to the next block boundary
+        const char* block_end = (end - ptr > 16) ? ptr + 16 : end;
+        while (ptr < block_end) {
+            const unsigned len = utf8::valid_sequence_length(ptr, end);
+            if (len == 0) return ptr;
+            ptr += len;
+        }
+    }
+    (void)begin;
+    return end;
+#endif
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Eight-digit SWAR — number parsing eight digits per step
+// ═════════════════════════════════════════════════════════════════════════════
+
+/// @brief Load 8 bytes as a little-endian word (first byte in the low bits).
+inline uint64_t load_digits8(const char* p) noexcept {
+    uint64_t w;
+    std::memcpy(&w, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+#endif
+    return w;
+}
+
+/// @brief True if all 8 bytes of w are ASCII '0'..'9'.
+///
+/// A digit byte is 0x30..0x39: its high nibble is 3, and adding 6 keeps it
+/// 3 (0x39 + 6 = 0x3F); 0x3A..0x3F overflow to 4. A carry out of one lane
+/// needs a byte >= 0xFA, whose high nibble already fails the check.
+inline bool is_eight_digits(uint64_t w) noexcept {
+    return (((w & 0xF0F0F0F0F0F0F0F0ull) |
+             (((w + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+            0x3333333333333333ull);
+}
+
+/// @brief Value of 8 ASCII digits (first digit most significant).
+///
+/// Three multiply-shift rounds combine adjacent lanes: 1-digit pairs into
+/// 2-digit values, then 2 into 4, then 4 into 8.
+inline uint32_t parse_eight_digits(uint64_t w) noexcept {
+    w -= 0x3030303030303030ull;
+    w = (w * 10) + (w >> 8);  // each even byte: 2-digit value
+    w = (((w & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+         (((w >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+    return static_cast<uint32_t>(w);
+}
+
 } // namespace yajson::detail::simd
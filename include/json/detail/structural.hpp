@@ -0,0 +1,627 @@
+#pragma once
+
+/// @file detail/structural.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Stage-1 structural indexing: 64-byte block classification.
+///
+/// The input is processed in 64-byte blocks. Each block is classified with
+/// SIMD compares into bitmasks (quote, backslash, whitespace, operator,
+/// control). Escaped characters are resolved with carry-propagating bit
+/// arithmetic, and string regions are found with a prefix-XOR over the
+/// unescaped quotes (carry-less multiply when PCLMUL is available).
+///
+/// The resulting index is a flat array of byte offsets:
+///   - every operator outside strings:  { } [ ] : ,
+///   - every opening quote
+///   - every scalar start (first byte of a literal/number/identifier)
+///   - the closing quote of each *clean* string (no backslash, no control
+///     character inside), tagged with kClosingQuoteTag
+///
+/// The parser (stage 2) uses it to jump over whitespace runs and to find the
+/// end of clean strings in O(1) instead of rescanning them.
+
+#include "simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(YAJSON_SIMD_ENABLED) && defined(__PCLMUL__)
+    #define YAJSON_PCLMUL 1
+    #include <wmmintrin.h>
+#endif
+
+namespace yajson::detail::simd {
+
+// ─── Bit helpers ─────────────────────────────────────────────────────────────
+
+inline int ctz64(uint64_t v) noexcept {
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward64(&idx, v);
+    return static_cast<int>(idx);
+#else
+    return __builtin_ctzll(v);
+#endif
+}
+
+inline int popcount64(uint64_t v) noexcept {
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(v));
+#else
+    return __builtin_popcountll(v);
+#endif
+}
+
+/// @brief Prefix XOR: bit i of the result is the XOR of bits 0..i of @p v.
+/// Turns a mask of string delimiters into a mask of string interiors.
+inline uint64_t prefix_xor(uint64_t v) noexcept {
+#if defined(YAJSON_PCLMUL)
+    const __m128i all_ones = _mm_set1_epi8(static_cast<char>(0xFF));
+    const __m128i r = _mm_clmulepi64_si128(
+        _mm_set_epi64x(0, static_cast<long long>(v)), all_ones, 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(r));
+#else
+    v ^= v << 1;
+    v ^= v << 2;
+    v ^= v << 4;
+    v ^= v << 8;
+    v ^= v << 16;
+    v ^= v << 32;
+    return v;
+#endif
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  classify_block — 64 bytes → character-class bitmasks
+// ═════════════════════════════════════════════════════════════════════════════
+
+/// Character-class bitmasks for one 64-byte block (bit i ↔ byte i).
+struct BlockMasks {
+    uint64_t quote;       ///< '"'
+    uint64_t backslash;   ///< '\\'
+    uint64_t whitespace;  ///< ' ', '\t', '\n', '\r'
+    uint64_t op;          ///< '{', '}', '[', ']', ':', ','
+    uint64_t control;     ///< bytes < 0x20 (includes \t \n \r)
+};
+
+/// @brief Classify exactly 64 readable bytes starting at @p p.
+inline BlockMasks classify_block(const char* p) noexcept {
+    BlockMasks m;
+#if defined(YAJSON_AVX2)
+    const __m256i v_quote = _mm256_set1_epi8('"');
+    const __m256i v_bslash = _mm256_set1_epi8('\\');
+    const __m256i v_space = _mm256_set1_epi8(' ');
+    const __m256i v_tab = _mm256_set1_epi8('\t');
+    const __m256i v_nl = _mm256_set1_epi8('\n');
+    const __m256i v_cr = _mm256_set1_epi8('\r');
+    const __m256i v_colon = _mm256_set1_epi8(':');
+    const __m256i v_comma = _mm256_set1_epi8(',');
+    // '[' / ']' differ from '{' / '}' only in bit 5 (0x5B/0x7B, 0x5D/0x7D),
+    // so OR-ing 0x20 folds the brackets onto the braces.
+    const __m256i v_fold = _mm256_set1_epi8(0x20);
+    const __m256i v_lbrace = _mm256_set1_epi8('{');
+    const __m256i v_rbrace = _mm256_set1_epi8('}');
+    const __m256i v_bias = _mm256_set1_epi8(static_cast<char>(0x80u));
+    const __m256i v_thresh = _mm256_set1_epi8(static_cast<char>(0x80u + 0x20u));
+
+    auto half = [&](const char* q, uint32_t* out) {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+        out[0] = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(c, v_quote)));
+        out[1] = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(c, v_bslash)));
+        __m256i ws = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(c, v_space), _mm256_cmpeq_epi8(c, v_tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(c, v_nl), _mm256_cmpeq_epi8(c, v_cr)));
+        out[2] = static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+        __m256i folded = _mm256_or_si256(c, v_fold);
+        __m256i op = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(folded, v_lbrace),
+                            _mm256_cmpeq_epi8(folded, v_rbrace)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(c, v_colon), _mm256_cmpeq_epi8(c, v_comma)));
+        out[3] = static_cast<uint32_t>(_mm256_movemask_epi8(op));
+        __m256i ctrl = _mm256_cmpgt_epi8(v_thresh, _mm256_xor_si256(c, v_bias));
+        out[4] = static_cast<uint32_t>(_mm256_movemask_epi8(ctrl));
+    };
+    uint32_t lo[5], hi[5];
+    half(p, lo);
+    half(p + 32, hi);
+    m.quote      = lo[0] | (static_cast<uint64_t>(hi[0]) << 32);
+    m.backslash  = lo[1] | (static_cast<uint64_t>(hi[1]) << 32);
+    m.whitespace = lo[2] | (static_cast<uint64_t>(hi[2]) << 32);
+    m.op         = lo[3] | (static_cast<uint64_t>(hi[3]) << 32);
+    m.control    = lo[4] | (static_cast<uint64_t>(hi[4]) << 32);
+
+#elif defined(YAJSON_SSE2)
+    const __m128i v_quote = _mm_set1_epi8('"');
+    const __m128i v_bslash = _mm_set1_epi8('\\');
+    const __m128i v_space = _mm_set1_epi8(' ');
+    const __m128i v_tab = _mm_set1_epi8('\t');
+    const __m128i v_nl = _mm_set1_epi8('\n');
+    const __m128i v_cr = _mm_set1_epi8('\r');
+    const __m128i v_colon = _mm_set1_epi8(':');
+    const __m128i v_comma = _mm_set1_epi8(',');
+    const __m128i v_fold = _mm_set1_epi8(0x20);
+    const __m128i v_lbrace = _mm_set1_epi8('{');
+    const __m128i v_rbrace = _mm_set1_epi8('}');
+    const __m128i v_bias = _mm_set1_epi8(static_cast<char>(0x80u));
+    const __m128i v_thresh = _mm_set1_epi8(static_cast<char>(0x80u + 0x20u));
+
+    m = BlockMasks{0, 0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i * 16));
+        const int shift = i * 16;
+        auto bits = [&](__m128i cmp) {
+            return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(cmp))) << shift;
+        };
+        m.quote     |= bits(_mm_cmpeq_epi8(c, v_quote));
+        m.backslash |= bits(_mm_cmpeq_epi8(c, v_bslash));
+        m.whitespace |= bits(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(c, v_space), _mm_cmpeq_epi8(c, v_tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(c, v_nl), _mm_cmpeq_epi8(c, v_cr))));
+        __m128i folded = _mm_or_si128(c, v_fold);
+        m.op |= bits(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(folded, v_lbrace), _mm_cmpeq_epi8(folded, v_rbrace)),
+            _mm_or_si128(_mm_cmpeq_epi8(c, v_colon), _mm_cmpeq_epi8(c, v_comma))));
+        m.control |= bits(_mm_cmplt_epi8(_mm_xor_si128(c, v_bias), v_thresh));
+    }
+
+#elif defined(YAJSON_NEON)
+    const uint8x16_t v_quote = vdupq_n_u8('"');
+    const uint8x16_t v_bslash = vdupq_n_u8('\\');
+    const uint8x16_t v_space = vdupq_n_u8(' ');
+    const uint8x16_t v_tab = vdupq_n_u8('\t');
+    const uint8x16_t v_nl = vdupq_n_u8('\n');
+    const uint8x16_t v_cr = vdupq_n_u8('\r');
+    const uint8x16_t v_colon = vdupq_n_u8(':');
+    const uint8x16_t v_comma = vdupq_n_u8(',');
+    const uint8x16_t v_fold = vdupq_n_u8(0x20);
+    const uint8x16_t v_lbrace = vdupq_n_u8('{');
+    const uint8x16_t v_rbrace = vdupq_n_u8('}');
+    const uint8x16_t v_ctrl_max = vdupq_n_u8(0x1F);
+
+    m = BlockMasks{0, 0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+        uint8x16_t c = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i * 16));
+        const int shift = i * 16;
+        auto bits = [&](uint8x16_t cmp) {
+            return static_cast<uint64_t>(neon_movemask(cmp)) << shift;
+        };
+        m.quote     |= bits(vceqq_u8(c, v_quote));
+        m.backslash |= bits(vceqq_u8(c, v_bslash));
+        m.whitespace |= bits(vorrq_u8(
+            vorrq_u8(vceqq_u8(c, v_space), vceqq_u8(c, v_tab)),
+            vorrq_u8(vceqq_u8(c, v_nl), vceqq_u8(c, v_cr))));
+        uint8x16_t folded = vorrq_u8(c, v_fold);
+        m.op |= bits(vorrq_u8(vorrq_u8(vceqq_u8(folded, v_lbrace), vceqq_u8(folded, v_rbrace)),
+                              vorrq_u8(vceqq_u8(c, v_colon), vceqq_u8(c, v_comma))));
+        m.control |= bits(vcleq_u8(c, v_ctrl_max));
+    }
+
+#else
+    m = BlockMasks{0, 0, 0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+        const auto c = static_cast<unsigned char>(p[i]);
+        const uint64_t bit = uint64_t{1} << i;
+        if (c == '"') m.quote |= bit;
+        else if (c == '\\') m.backslash |= bit;
+        else if (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',')
+            m.op |= bit;
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') m.whitespace |= bit;
+        if (c < 0x20) m.control |= bit;
+    }
+#endif
+    return m;
+}
+
+/// Opening ('{', '[') and closing ('}', ']') bracket bitmasks of one block.
+struct BracketMasks {
+    uint64_t open;
+    uint64_t close;
+};
+
+/// @brief Classify the brackets of exactly 64 readable bytes at @p p.
+/// Used where only nesting depth matters (e.g. splitting a large array);
+/// string state is applied by the caller.
+inline BracketMasks classify_brackets(const char* p) noexcept {
+    BracketMasks m{0, 0};
+#if defined(YAJSON_AVX2)
+    const __m256i v_fold = _mm256_set1_epi8(0x20);
+    const __m256i v_lbrace = _mm256_set1_epi8('{');
+    const __m256i v_rbrace = _mm256_set1_epi8('}');
+    for (int i = 0; i < 2; ++i) {
+        __m256i c = _mm256_or_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i * 32)), v_fold);
+        const int shift = i * 32;
+        m.open |= static_cast<uint64_t>(static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(c, v_lbrace)))) << shift;
+        m.close |= static_cast<uint64_t>(static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(c, v_rbrace)))) << shift;
+    }
+#elif defined(YAJSON_SSE2)
+    const __m128i v_fold = _mm_set1_epi8(0x20);
+    const __m128i v_lbrace = _mm_set1_epi8('{');
+    const __m128i v_rbrace = _mm_set1_epi8('}');
+    for (int i = 0; i < 4; ++i) {
+        __m128i c = _mm_or_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i * 16)), v_fold);
+        const int shift = i * 16;
+        m.open |= static_cast<uint64_t>(static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(c, v_lbrace)))) << shift;
+        m.close |= static_cast<uint64_t>(static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(c, v_rbrace)))) << shift;
+    }
+#elif defined(YAJSON_NEON)
+    const uint8x16_t v_fold = vdupq_n_u8(0x20);
+    const uint8x16_t v_lbrace = vdupq_n_u8('{');
+    const uint8x16_t v_rbrace = vdupq_n_u8('}');
+    for (int i = 0; i < 4; ++i) {
+        uint8x16_t c = vorrq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p + i * 16)), v_fold);
+        const int shift = i * 16;
+        m.open |= static_cast<uint64_t>(neon_movemask(vceqq_u8(c, v_lbrace))) << shift;
+        m.close |= static_cast<uint64_t>(neon_movemask(vceqq_u8(c, v_rbrace))) << shift;
+    }
+#else
+    for (int i = 0; i < 64; ++i) {
+        const char c = static_cast<char>(p[i] | 0x20);
+        if (c == '{') m.open |= uint64_t{1} << i;
+        else if (c == '}') m.close |= uint64_t{1} << i;
+    }
+#endif
+    return m;
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Escape and string-region resolution (carried across blocks)
+// ═════════════════════════════════════════════════════════════════════════════
+
+/// @brief Mask of characters escaped by a preceding backslash.
+///
+/// A character is escaped when it follows an odd-length run of backslashes.
+/// Runs are resolved with a single subtraction: subtracting the run starts
+/// from (run << 1 | odd bits) makes the borrow ripple through each run and
+/// flip exactly the bit after every odd-length run.
+/// @param backslash   Backslash mask of the block.
+/// @param prev_escaped In: 1 if bit 0 of this block is escaped by the previous
+///                     block; out: same for the next block.
+inline uint64_t find_escaped(uint64_t backslash, uint64_t& prev_escaped) noexcept {
+    constexpr uint64_t kOddBits = 0xAAAAAAAAAAAAAAAAULL;
+    if (backslash == 0) {
+        const uint64_t escaped = prev_escaped;
+        prev_escaped = 0;
+        return escaped;
+    }
+    // A backslash that is itself escaped cannot start an escape.
+    const uint64_t potential = backslash & ~prev_escaped;
+    const uint64_t maybe_escaped = potential << 1;
+    const uint64_t codes = ((maybe_escaped | kOddBits) - potential) ^ kOddBits;
+    const uint64_t escaped = codes ^ (backslash | prev_escaped);
+    const uint64_t escape = codes & backslash;
+    prev_escaped = escape >> 63;
+    return escaped;
+}
+
+/// @brief Resolved masks for one block, shared by the index builder and the
+/// value skipper.
+struct BlockScan {
+    uint64_t quote;        ///< Unescaped quotes (string delimiters)
+    uint64_t in_string;    ///< String interiors incl. opening quote, excl. closing
+    BlockMasks raw;        ///< Raw character classes
+};
+
+/// @brief Streaming state carried between consecutive 64-byte blocks.
+struct BlockScanner {
+    uint64_t prev_escaped = 0;    ///< Bit 0 of next block is escaped
+    uint64_t prev_in_string = 0;  ///< All-ones while inside a string
+
+    BlockScan next(const char* p) noexcept {
+        BlockScan s;
+        s.raw = classify_block(p);
+        const uint64_t escaped = find_escaped(s.raw.backslash, prev_escaped);
+        s.quote = s.raw.quote & ~escaped;
+        s.in_string = prefix_xor(s.quote) ^ prev_in_string;
+        prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(s.in_string) >> 63);
+        return s;
+    }
+};
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  Container skipping and element counting
+// ═════════════════════════════════════════════════════════════════════════════
+
+/// Masks needed to track nesting: quotes, backslashes, brackets, commas.
+struct ContainerMasks {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t open;   ///< '{', '['
+    uint64_t close;  ///< '}', ']'
+    uint64_t comma;
+};
+
+/// @brief Classify exactly 64 readable bytes at @p p for nesting tracking.
+/// A slimmer classify_block: no whitespace or control-character classes.
+inline ContainerMasks classify_container(const char* p) noexcept {
+    ContainerMasks m{0, 0, 0, 0, 0};
+#if defined(YAJSON_AVX2)
+    const __m256i v_quote = _mm256_set1_epi8('"');
+    const __m256i v_bslash = _mm256_set1_epi8('\\');
+    const __m256i v_comma = _mm256_set1_epi8(',');
+    const __m256i v_fold = _mm256_set1_epi8(0x20);
+    const __m256i v_lbrace = _mm256_set1_epi8('{');
+    const __m256i v_rbrace = _mm256_set1_epi8('}');
+    for (int i = 0; i < 2; ++i) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i * 32));
+        const __m256i folded = _mm256_or_si256(c, v_fold);
+        const int shift = i * 32;
+        auto bits = [&](__m256i cmp) {
+            return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(cmp))) << shift;
+        };
+        m.quote |= bits(_mm256_cmpeq_epi8(c, v_quote));
+        m.backslash |= bits(_mm256_cmpeq_epi8(c, v_bslash));
+        m.open |= bits(_mm256_cmpeq_epi8(folded, v_lbrace));
+        m.close |= bits(_mm256_cmpeq_epi8(folded, v_rbrace));
+        m.comma |= bits(_mm256_cmpeq_epi8(c, v_comma));
+    }
+#elif defined(YAJSON_SSE2)
+    const __m128i v_quote = _mm_set1_epi8('"');
+    const __m128i v_bslash = _mm_set1_epi8('\\');
+    const __m128i v_comma = _mm_set1_epi8(',');
+    const __m128i v_fold = _mm_set1_epi8(0x20);
+    const __m128i v_lbrace = _mm_set1_epi8('{');
+    const __m128i v_rbrace = _mm_set1_epi8('}');
+    for (int i = 0; i < 4; ++i) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i * 16));
+        const __m128i folded = _mm_or_si128(c, v_fold);
+        const int shift = i * 16;
+        auto bits = [&](__m128i cmp) {
+            return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(cmp))) << shift;
+        };
+        m.quote |= bits(_mm_cmpeq_epi8(c, v_quote));
+        m.backslash |= bits(_mm_cmpeq_epi8(c, v_bslash));
+        m.open |= bits(_mm_cmpeq_epi8(folded, v_lbrace));
+        m.close |= bits(_mm_cmpeq_epi8(folded, v_rbrace));
+        m.comma |= bits(_mm_cmpeq_epi8(c, v_comma));
+    }
+#elif defined(YAJSON_NEON)
+    const uint8x16_t v_quote = vdupq_n_u8('"');
+    const uint8x16_t v_bslash = vdupq_n_u8('\\');
+    const uint8x16_t v_comma = vdupq_n_u8(',');
+    const uint8x16_t v_fold = vdupq_n_u8(0x20);
+    const uint8x16_t v_lbrace = vdupq_n_u8('{');
+    const uint8x16_t v_rbrace = vdupq_n_u8('}');
+    for (int i = 0; i < 4; ++i) {
+        const uint8x16_t c = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i * 16));
+        const uint8x16_t folded = vorrq_u8(c, v_fold);
+        const int shift = i * 16;
+        auto bits = [&](uint8x16_t cmp) {
+            return static_cast<uint64_t>(neon_movemask(cmp)) << shift;
+        };
+        m.quote |= bits(vceqq_u8(c, v_quote));
+        m.backslash |= bits(vceqq_u8(c, v_bslash));
+        m.open |= bits(vceqq_u8(folded, v_lbrace));
+        m.close |= bits(vceqq_u8(folded, v_rbrace));
+        m.comma |= bits(vceqq_u8(c, v_comma));
+    }
+#else
+    for (int i = 0; i < 64; ++i) {
+        const char c = p[i];
+        const uint64_t bit = uint64_t{1} << i;
+        if (c == '"') m.quote |= bit;
+        else if (c == '\\') m.backslash |= bit;
+        else if (c == ',') m.comma |= bit;
+        else if ((c | 0x20) == '{') m.open |= bit;
+        else if ((c | 0x20) == '}') m.close |= bit;
+    }
+#endif
+    return m;
+}
+
+/// Brackets and commas of one block that lie outside strings.
+struct ContainerScan {
+    uint64_t open;
+    uint64_t close;
+    uint64_t comma;
+};
+
+/// @brief BlockScanner counterpart over classify_container.
+struct ContainerScanner {
+    uint64_t prev_escaped = 0;
+    uint64_t prev_in_string = 0;
+
+    ContainerScan next(const char* p) noexcept {
+        const ContainerMasks m = classify_container(p);
+        const uint64_t escaped = find_escaped(m.backslash, prev_escaped);
+        const uint64_t in_string = prefix_xor(m.quote & ~escaped) ^ prev_in_string;
+        prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+        // Brackets and commas are never quotes: in_string masks them exactly
+        return {m.open & ~in_string, m.close & ~in_string, m.comma & ~in_string};
+    }
+};
+
+/// 64 readable bytes at @p p: @p p itself, or a space-padded copy in @p tail.
+inline const char* readable_block(const char* p, const char* end, char* tail) noexcept {
+    if (end - p >= 64) return p;
+    std::memset(tail, ' ', 64);
+    std::memcpy(tail, p, static_cast<size_t>(end - p));
+    return tail;
+}
+
+/// @brief One past the bracket that closes the container opening at @p p.
+///
+/// @p p must point at '{' or '['. Double-quoted strings and escapes are
+/// honored; bracket kinds are not paired and nothing else is validated.
+/// Blocks whose closing brackets cannot bring the depth to zero are passed
+/// with two popcounts. Returns nullptr if the input ends first.
+inline const char* skip_container(const char* p, const char* end) noexcept {
+    ContainerScanner scanner;
+    alignas(64) char tail[64];
+    const size_t size = static_cast<size_t>(end - p);
+    size_t depth = 0;
+    for (size_t pos = 0; pos < size; pos += 64) {
+        const ContainerScan s = scanner.next(readable_block(p + pos, end, tail));
+        const auto closes = static_cast<size_t>(popcount64(s.close));
+        if (depth > closes) {
+            depth += static_cast<size_t>(popcount64(s.open)) - closes;
+            continue;
+        }
+        for (uint64_t bits = s.open | s.close; bits != 0; bits &= bits - 1) {
+            const int i = ctz64(bits);
+            if ((s.open >> i) & 1) {
+                ++depth;
+            } else if (--depth == 0) {
+                return p + pos + static_cast<size_t>(i) + 1;
+            }
+        }
+    }
+    return nullptr;
+}
+
+/// @brief Element count of the container whose first element is at @p p:
+/// commas at its top level plus one, stopping at its closing bracket.
+///
+/// Scans about @p limit bytes (whole blocks); the count is a lower bound
+/// when the container continues past that. For capacity hints only.
+inline size_t count_elements(const char* p, const char* end, size_t limit) noexcept {
+    ContainerScanner scanner;
+    alignas(64) char tail[64];
+    const auto available = static_cast<size_t>(end - p);
+    const size_t size = available < limit ? available : limit;
+    size_t count = 1;
+    size_t depth = 0;
+    for (size_t pos = 0; pos < size; pos += 64) {
+        const ContainerScan s = scanner.next(readable_block(p + pos, end, tail));
+        const uint64_t brackets = s.open | s.close;
+        if (depth == 0 && brackets == 0) {
+            count += static_cast<size_t>(popcount64(s.comma));
+            continue;
+        }
+        const auto closes = static_cast<size_t>(popcount64(s.close));
+        if (depth > closes) {
+            depth += static_cast<size_t>(popcount64(s.open)) - closes;
+            continue;
+        }
+        for (uint64_t bits = brackets | s.comma; bits != 0; bits &= bits - 1) {
+            const int i = ctz64(bits);
+            if ((s.comma >> i) & 1) {
+                if (depth == 0) ++count;
+            } else if ((s.open >> i) & 1) {
+                ++depth;
+            } else if (depth-- == 0) {
+                return count;
+            }
+        }
+    }
+    return count;
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+//  StructuralIndexer — incremental index construction
+// ═════════════════════════════════════════════════════════════════════════════
+
+/// Tag bit marking the closing quote of a clean string in the index.
+inline constexpr uint32_t kClosingQuoteTag = 0x80000000u;
+
+/// Terminator of a partial index window: more input remains to be indexed.
+/// Its untagged value compares greater than any valid offset.
+inline constexpr uint32_t kIndexRefill = 0xFFFFFFFFu;
+
+/// Largest input that can be indexed (offsets must stay below kIndexRefill's
+/// untagged value).
+inline constexpr size_t kMaxIndexedInput = kClosingQuoteTag - 2;
+
+/// @brief Builds the structural index window by window.
+///
+/// Stage 2 consumes the index strictly left to right, so the index never
+/// has to exist in full: the parser refills a small, cache-resident buffer
+/// when it reaches a kIndexRefill terminator. All cross-block state (escape
+/// carry, string state, scalar runs, clean-string tracking) lives here.
+class StructuralIndexer {
+public:
+    /// @brief Index the next @p max_bytes bytes (rounded up to whole blocks).
+    ///
+    /// @param out Destination with room for (bytes indexed + 1) entries:
+    ///            every byte may produce one entry, plus the terminator.
+    ///            The terminator is the input length once the whole input
+    ///            has been indexed, kIndexRefill otherwise.
+    /// @return Number of entries written, including the terminator.
+    size_t fill(const char* begin, const char* end, uint32_t* out,
+                size_t max_bytes) noexcept {
+        const size_t len = static_cast<size_t>(end - begin);
+        const size_t stop = (len - pos_ <= max_bytes) ? len : pos_ + max_bytes;
+        uint32_t* dst = out;
+
+        alignas(64) char tail[64];
+        for (; pos_ < stop; pos_ += 64) {
+            const size_t base = pos_;
+            const char* block = begin + base;
+            const size_t n = len - base;
+            if (n < 64) {
+                // Pad the final partial block with spaces (neutral class).
+                std::memset(tail, ' ', sizeof(tail));
+                std::memcpy(tail, block, n);
+                block = tail;
+            }
+            const BlockScan s = scanner_.next(block);
+
+            const uint64_t opening = s.quote & s.in_string;
+            const uint64_t closing = s.quote & ~s.in_string;
+            const uint64_t outside = ~(s.in_string | closing);
+            const uint64_t op = s.raw.op & outside;
+            const uint64_t scalar = outside & ~(s.raw.op | s.raw.whitespace);
+            const uint64_t follows_scalar = (scalar << 1) | prev_scalar_;
+            prev_scalar_ = scalar >> 63;
+            const uint64_t scalar_start = scalar & ~follows_scalar;
+            const uint64_t dirty = s.raw.backslash | s.raw.control;
+
+            uint64_t bits = op | opening | closing | scalar_start;
+            while (bits != 0) {
+                const int i = ctz64(bits);
+                bits &= bits - 1;
+                const uint64_t bit = uint64_t{1} << i;
+                const auto off = static_cast<uint32_t>(base + static_cast<size_t>(i));
+                if (bit & closing) {
+                    // Emit closing quotes only for strings without escapes or
+                    // control characters: the parser can slice those directly.
+                    const uint64_t dirty_here =
+                        dirty_before_ + static_cast<uint64_t>(popcount64(dirty & (bit - 1)));
+                    if (dirty_here == open_dirty_) *dst++ = off | kClosingQuoteTag;
+                    continue;
+                }
+                if (bit & opening) {
+                    open_dirty_ =
+                        dirty_before_ + static_cast<uint64_t>(popcount64(dirty & (bit - 1)));
+                }
+                *dst++ = off;
+            }
+            dirty_before_ += static_cast<uint64_t>(popcount64(dirty));
+        }
+        if (pos_ >= len) {
+            pos_ = len;
+            *dst++ = static_cast<uint32_t>(len);
+        } else {
+            *dst++ = kIndexRefill;
+        }
+        return static_cast<size_t>(dst - out);
+    }
+
+private:
+    BlockScanner scanner_;
+    size_t pos_ = 0;              ///< Next byte to index (multiple of 64)
+    uint64_t prev_scalar_ = 0;    ///< Last byte of previous block was a scalar byte
+    uint64_t dirty_before_ = 0;   ///< Backslash/control bytes seen before this block
+    uint64_t open_dirty_ = 0;     ///< Dirty count at the last opening quote
+};
+
+/// @brief Build the complete structural index for [begin, end) in one pass.
+///
+/// @param out Destination with room for (end - begin + 1) entries.
+/// @return Number of entries written including the terminating input length,
+///         or 0 if the input is too large to index.
+inline size_t build_structural_index(const char* begin, const char* end,
+                                     uint32_t* out) noexcept {
+    const size_t len = static_cast<size_t>(end - begin);
+    if (len > kMaxIndexedInput) return 0;
+    StructuralIndexer indexer;
+    return indexer.fill(begin, end, out, len);
+}
+
+} // namespace yajson::detail::simd
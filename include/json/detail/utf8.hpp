@@ -9,8 +9,11 @@
 ///   - Decoding UTF-8 to a code point
 ///   - Encoding a code point as \uXXXX (with surrogate pairs for non-BMP)
 ///   - UTF-8 sequence validation
+///   - Decoding pre-validated JSON string escapes
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 namespace yajson::detail::utf8 {
@@ -164,49 +167,105 @@ inline void encode_escaped(uint32_t cp, std::string& out) {
 
 // ─── UTF-8 validation ────────────────────────────────────────────────────────
 
-/// @brief Checks whether a string is valid UTF-8.
-inline bool validate(const char* ptr, const char* end) noexcept {
-    while (ptr < end) {
-        auto lead = static_cast<unsigned char>(*ptr);
-
-        if (lead < 0x80) {
-            ++ptr;
-            continue;
-        }
+/// @brief Length of the valid UTF-8 sequence starting at @p ptr (< @p end).
+/// @return 1-4, or 0 for a bad lead byte, a missing continuation byte, an
+/// overlong form, a surrogate or a code point beyond U+10FFFF.
+inline unsigned valid_sequence_length(const char* ptr, const char* end) noexcept {
+    auto lead = static_cast<unsigned char>(*ptr);
+    if (lead < 0x80) return 1;
 
-        unsigned len = sequence_length(lead);
-        if (len == 0 || ptr + len > end) return false;
+    unsigned len = sequence_length(lead);
+    if (len == 0 || len > static_cast<size_t>(end - ptr)) return 0;
 
-        // Check continuation bytes
-        for (unsigned i = 1; i < len; ++i) {
-            if ((static_cast<unsigned char>(ptr[i]) & 0xC0) != 0x80) {
-                return false;
-            }
-        }
+    // Check continuation bytes
+    for (unsigned i = 1; i < len; ++i) {
+        if ((static_cast<unsigned char>(ptr[i]) & 0xC0) != 0x80) return 0;
+    }
 
-        // Decode and check for overlong encoding + range
-        uint32_t cp;
-        switch (len) {
-            case 2: cp = lead & 0x1F; break;
-            case 3: cp = lead & 0x0F; break;
-            case 4: cp = lead & 0x07; break;
-            default: return false;
-        }
-        for (unsigned i = 1; i < len; ++i) {
-            cp = (cp << 6) | (static_cast<unsigned char>(ptr[i]) & 0x3F);
-        }
+    // Decode and check for overlong encoding + range
+    uint32_t cp;
+    switch (len) {
+        case 2: cp = lead & 0x1F; break;
+        case 3: cp = lead & 0x0F; break;
+        case 4: cp = lead & 0x07; break;
+        default: return 0;
+    }
+    for (unsigned i = 1; i < len; ++i) {
+        cp = (cp << 6) | (static_cast<unsigned char>(ptr[i]) & 0x3F);
+    }
 
-        if ((len == 2 && cp < 0x80) ||
-            (len == 3 && cp < 0x800) ||
-            (len == 4 && cp < 0x10000)) {
-            return false; // Overlong encoding
-        }
-        if (cp >= 0xD800 && cp <= 0xDFFF) return false; // Surrogate
-        if (cp > 0x10FFFF) return false; // Beyond Unicode range
+    if ((len == 2 && cp < 0x80) ||
+        (len == 3 && cp < 0x800) ||
+        (len == 4 && cp < 0x10000)) {
+        return 0; // Overlong encoding
+    }
+    if (cp >= 0xD800 && cp <= 0xDFFF) return 0; // Surrogate
+    if (cp > 0x10FFFF) return 0; // Beyond Unicode range
+    return len;
+}
 
+/// @brief Finds the first byte that does not start a valid UTF-8 sequence.
+/// @return Pointer to that byte, or @p end if the whole range is valid.
+inline const char* find_invalid(const char* ptr, const char* end) noexcept {
+    while (ptr < end) {
+        const unsigned len = valid_sequence_length(ptr, end);
+        if (len == 0) return ptr;
         ptr += len;
     }
-    return true;
+    return end;
+}
+
+/// @brief Checks whether a string is valid UTF-8.
+inline bool validate(const char* ptr, const char* end) noexcept {
+    return find_invalid(ptr, end) == end;
+}
+
+// ─── JSON escapes ────────────────────────────────────────────────────────────
+
+/// @brief Decodes JSON string content whose escapes were validated when it
+/// was parsed (see ParseOptions::lazy_unescape).
+/// @param out  Room for @p len bytes: decoding never makes the text longer.
+/// @return Number of bytes written to @p out.
+inline size_t unescape(const char* src, size_t len, char* out) noexcept {
+    auto hex4 = [](const char* p) noexcept {
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) {
+            const auto c = static_cast<unsigned char>(p[i]);
+            v = (v << 4) | (c <= '9' ? c - '0' : (c | 0x20u) - 'a' + 10u);
+        }
+        return v;
+    };
+    const char* const end = src + len;
+    char* o = out;
+    while (src < end) {
+        const auto* bs = static_cast<const char*>(
+            std::memchr(src, '\\', static_cast<size_t>(end - src)));
+        const size_t run = static_cast<size_t>((bs ? bs : end) - src);
+        std::memcpy(o, src, run);
+        o += run;
+        if (!bs) break;
+        const char c = bs[1];
+        src = bs + 2;
+        switch (c) {
+            case 'b': *o++ = '\b'; break;
+            case 'f': *o++ = '\f'; break;
+            case 'n': *o++ = '\n'; break;
+            case 'r': *o++ = '\r'; break;
+            case 't': *o++ = '\t'; break;
+            case 'u': {
+                uint32_t cp = hex4(src);
+                src += 4;
+                if (cp >= 0xD800 && cp <= 0xDBFF) {  // validated: \uDC00-\uDFFF follows
+                    cp = 0x10000u + ((cp - 0xD800u) << 10) + (hex4(src + 2) - 0xDC00u);
+                    src += 6;
+                }
+                o += encode(cp, o);
+                break;
+            }
+            default: *o++ = c; break;  // '"', '\\', '/'
+        }
+    }
+    return static_cast<size_t>(o - out);
 }
 
 } // namespace yajson::detail::utf8
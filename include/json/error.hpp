@@ -52,6 +52,7 @@ enum class errc : int {
     duplicate_key           = 12,
     invalid_utf8            = 13,
     invalid_comment         = 14,
+    input_too_large         = 15,
 
     // Value access errors (50-79)
     type_mismatch           = 50,
@@ -92,6 +93,7 @@ public:
             case errc::duplicate_key:            return "duplicate key";
             case errc::invalid_utf8:             return "invalid UTF-8 encoding";
             case errc::invalid_comment:          return "invalid comment";
+            case errc::input_too_large:          return "input too large";
             case errc::type_mismatch:            return "type mismatch";
             case errc::out_of_range:             return "index out of range";
             case errc::key_not_found:            return "key not found";
@@ -201,6 +203,17 @@ struct result {
     bool has_value() const noexcept { return !ec; }
 };
 
+/// @brief Result of an operation with no value (e.g. validate()): the error
+/// code and, for parse errors, where it was detected.
+template <>
+struct result<void> {
+    std::error_code ec;
+    SourceLocation location;
+
+    explicit operator bool() const noexcept { return !ec; }
+    bool has_value() const noexcept { return !ec; }
+};
+
 } // namespace yajson
 
 // Register yajson::errc as an error_code enum
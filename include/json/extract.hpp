@@ -0,0 +1,230 @@
+#pragma once
+
+/// @file extract.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Selective extraction of a few JSON Pointer paths in one pass.
+///
+/// @code
+///   auto r = yajson::extract(input, {yajson::JsonPointer("/user/id"),
+///                                    yajson::JsonPointer("/items/0/price")});
+///   if (r[0]) use(r[0]->as_integer());
+///
+///   yajson::Extractor ex({yajson::JsonPointer("/status")});  // compile once
+///   std::vector<std::optional<yajson::JsonValue>> out;
+///   for (auto msg : messages) ex.extract(msg, out);           // reuse slots
+/// @endcode
+///
+/// The pointers are compiled into a trie. The parser walks the document
+/// once, follows only the object members and array elements that some
+/// pointer passes through, builds a JsonValue for each pointer's target and
+/// skips every other subtree without allocating.
+///
+/// Results are equal to parse() followed by JsonPointer::try_resolve():
+///   - a missing path leaves its slot empty;
+///   - with duplicate keys the last occurrence wins;
+///   - a pointer nested inside another one's target is resolved on the
+///     target's value.
+///
+/// Validation is narrower than parse(): skipped subtrees are only checked
+/// for balanced brackets and terminated strings, and allow_duplicate_keys =
+/// false is enforced only inside the extracted values. Extracted values are
+/// allocated from the current ArenaScope arena, if any.
+
+#include "error.hpp"
+#include "json_pointer.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace yajson {
+
+namespace detail {
+
+/// @brief Compiled set of JSON Pointers; node 0 is the document root.
+///
+/// Implements the trie interface of BasicParser::extract over a vector of
+/// optional result slots, one per pointer (in pointer order).
+class PointerTrie {
+public:
+    using Slots = std::vector<std::optional<JsonValue>>;
+
+    static constexpr uint32_t kNoNode = UINT32_MAX;
+
+    explicit PointerTrie(const std::vector<JsonPointer>& pointers)
+        : nodes_(1), size_(pointers.size()) {
+        for (size_t slot = 0; slot < pointers.size(); ++slot) {
+            const auto& tokens = pointers[slot].tokens();
+            uint32_t node = 0;
+            nodes_[0].subtree.push_back(slot);
+            for (size_t depth = 0; depth < tokens.size(); ++depth) {
+                if (!nodes_[node].slots.empty()) {
+                    // Below another pointer's target: resolved on its value
+                    JsonPointer rest;
+                    for (size_t i = depth; i < tokens.size(); ++i) rest = rest.append(tokens[i]);
+                    nodes_[node].nested.emplace_back(slot, std::move(rest));
+                    break;
+                }
+                node = find_or_add(node, tokens[depth]);
+                nodes_[node].subtree.push_back(slot);
+            }
+            if (nodes_[node].nested.empty() || nodes_[node].nested.back().first != slot) {
+                make_terminal(node, slot);
+            }
+        }
+    }
+
+    /// Number of pointers (result slots).
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+    // ─── Parser interface ────────────────────────────────────────────────
+
+    [[nodiscard]] bool terminal(uint32_t node) const noexcept {
+        return !nodes_[node].slots.empty();
+    }
+
+    [[nodiscard]] uint32_t child(uint32_t node, std::string_view key) const noexcept {
+        for (const auto& e : nodes_[node].edges) {
+            if (e.token == key) return e.node;
+        }
+        return kNoNode;
+    }
+
+    [[nodiscard]] uint32_t element(uint32_t node, size_t index) const noexcept {
+        for (const auto& e : nodes_[node].edges) {
+            if (e.index == index) return e.node;
+        }
+        return kNoNode;
+    }
+
+    /// A value for @p node starts: forget results of earlier duplicates.
+    void enter(uint32_t node, Slots& slots) const {
+        for (size_t slot : nodes_[node].subtree) slots[slot].reset();
+    }
+
+    void found(uint32_t node, JsonValue&& value, Slots& slots) const {
+        const Node& n = nodes_[node];
+        for (const auto& [slot, rest] : n.nested) {
+            if (const JsonValue* v = rest.try_resolve(std::as_const(value))) slots[slot] = *v;
+        }
+        for (size_t i = 0; i + 1 < n.slots.size(); ++i) slots[n.slots[i]] = value;
+        slots[n.slots.back()] = std::move(value);
+    }
+
+private:
+    static constexpr size_t kNoIndex = static_cast<size_t>(-1);
+
+    struct Edge {
+        std::string token;
+        size_t index;   ///< Array index the token denotes, or kNoIndex
+        uint32_t node;
+    };
+
+    struct Node {
+        std::vector<Edge> edges;
+        std::vector<size_t> slots;    ///< Pointers ending here
+        std::vector<size_t> subtree;  ///< Pointers ending here or below
+        std::vector<std::pair<size_t, JsonPointer>> nested;  ///< Below a terminal
+    };
+
+    std::vector<Node> nodes_;
+    size_t size_;
+
+    /// Array index per RFC 6901 (no leading zeros), as try_resolve reads it.
+    static size_t array_index(std::string_view token) noexcept {
+        if (token.empty() || token.size() > 18) return kNoIndex;
+        if (token.size() > 1 && token[0] == '0') return kNoIndex;
+        size_t idx = 0;
+        for (char c : token) {
+            if (c < '0' || c > '9') return kNoIndex;
+            idx = idx * 10 + static_cast<size_t>(c - '0');
+        }
+        return idx;
+    }
+
+    uint32_t find_or_add(uint32_t node, std::string_view token) {
+        if (uint32_t next = child(node, token); next != kNoNode) return next;
+        const auto id = static_cast<uint32_t>(nodes_.size());
+        nodes_[node].edges.push_back({std::string(token), array_index(token), id});
+        nodes_.emplace_back();
+        return id;
+    }
+
+    /// A pointer ends at @p node: pointers already compiled below it are
+    /// re-rooted onto this node's value.
+    void make_terminal(uint32_t node, size_t slot) {
+        if (nodes_[node].slots.empty() && !nodes_[node].edges.empty()) {
+            collect_nested(node, node, JsonPointer());
+            nodes_[node].edges.clear();
+        }
+        nodes_[node].slots.push_back(slot);
+    }
+
+    void collect_nested(uint32_t target, uint32_t node, const JsonPointer& path) {
+        for (const auto& e : nodes_[node].edges) {
+            JsonPointer next = path.append(e.token);
+            for (size_t s : nodes_[e.node].slots) nodes_[target].nested.emplace_back(s, next);
+            for (auto& [s, rest] : nodes_[e.node].nested) {
+                JsonPointer full = next;
+                for (auto tok : rest.tokens()) full = full.append(tok);
+                nodes_[target].nested.emplace_back(s, std::move(full));
+            }
+            collect_nested(target, e.node, next);
+        }
+    }
+};
+
+} // namespace detail
+
+/// @brief A reusable set of JSON Pointers compiled for extraction.
+class Extractor {
+public:
+    explicit Extractor(const std::vector<JsonPointer>& pointers)
+        : trie_(pointers) {}
+
+    /// Number of pointers (and result slots).
+    [[nodiscard]] size_t size() const noexcept { return trie_.size(); }
+
+    /// @brief Extract into @p out (resized to size(); slot i for pointer i).
+    /// Reusing @p out across calls keeps its storage.
+    /// @throws ParseError on malformed input.
+    void extract(std::string_view input,
+                 std::vector<std::optional<JsonValue>>& out,
+                 const ParseOptions& opts = {}) const {
+        out.clear();
+        out.resize(trie_.size());
+        detail::Parser::extract(input, opts, trie_, out);
+    }
+
+    /// @brief Extract and return one optional value per pointer.
+    /// @throws ParseError on malformed input.
+    [[nodiscard]] std::vector<std::optional<JsonValue>> extract(
+            std::string_view input, const ParseOptions& opts = {}) const {
+        std::vector<std::optional<JsonValue>> out;
+        extract(input, out, opts);
+        return out;
+    }
+
+private:
+    detail::PointerTrie trie_;
+};
+
+/// @brief Extract the values at @p pointers from @p input in a single pass.
+///
+/// Equivalent to resolving each pointer on parse(input), but only the
+/// targets are materialized. Use Extractor to compile the pointers once.
+/// @throws ParseError on malformed input.
+[[nodiscard]] inline std::vector<std::optional<JsonValue>> extract(
+        std::string_view input, const std::vector<JsonPointer>& pointers,
+        const ParseOptions& opts = {}) {
+    return Extractor(pointers).extract(input, opts);
+}
+
+} // namespace yajson
@@ -13,6 +13,7 @@
 #include <memory_resource>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -22,7 +23,7 @@ namespace yajson {
 // ─── Forward declarations ───────────────────────────────────────────────
 class JsonValue;
 class MonotonicArena;
-namespace detail { class Parser; } // Forward for friend access
+namespace detail { class ParserBase; } // Forward for friend access
 
 /// JSON value types
 enum class Type : uint8_t {
@@ -33,7 +34,8 @@ enum class Type : uint8_t {
     String  = 4,
     Array   = 5,
     Object   = 6,
-    UInteger = 7
+    UInteger = 7,
+    RawNumber = 8  ///< Unconverted number text (ParseOptions::number_mode)
 };
 
 /// @brief Returns the string representation of a type.
@@ -47,6 +49,7 @@ inline const char* type_name(Type t) noexcept {
         case Type::Array:   return "array";
         case Type::Object:   return "object";
         case Type::UInteger: return "uinteger";
+        case Type::RawNumber: return "raw number";
     }
     return "unknown";
 }
@@ -58,6 +61,37 @@ inline const char* type_name(Type t) noexcept {
 /// backing store is allocated from the arena instead of the global heap.
 using Array = std::pmr::vector<JsonValue>;
 
+/// @brief Read-only view of contiguous elements (std::span is C++20).
+///
+/// Returned by JsonValue::as_int64_span() / as_double_span() for packed
+/// arrays, and accepted by JsonValue::packed_array().
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using iterator = T*;
+
+    constexpr Span() noexcept = default;
+    constexpr Span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+    /// From any contiguous container with data() and size() (vector, array).
+    template <typename C, typename = std::enable_if_t<std::is_convertible_v<
+                                decltype(std::declval<C&>().data() + std::declval<C&>().size()), T*>>>
+    constexpr Span(C& c) noexcept : data_(c.data()), size_(c.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+    constexpr T& operator[](size_t i) const noexcept { return data_[i]; }
+
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
 /// @brief JSON object: ordered key-value pairs with O(1) lookup.
 ///
 /// Uses pmr::vector for entry storage and pmr::unordered_map for the hash
@@ -169,7 +203,7 @@ struct Object {
     void rebuild_index() const;
 
 private:
-    friend class detail::Parser;  // Allow parser to call rebuild_index / kIndexThreshold
+    friend class detail::ParserBase;  // Allow finalize_object to use kIndexThreshold
 
     // Threshold: below this value linear search is used (cache-friendly)
     static constexpr size_type kIndexThreshold = 16;
@@ -0,0 +1,733 @@
+#pragma once
+
+/// @file incremental.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Resumable push parser for JSON arriving in arbitrary chunks.
+///
+/// parse() and parse_sax() need the whole document in one contiguous buffer.
+/// The incremental parsers accept input as it arrives (e.g. TCP segments)
+/// and report each token as soon as it is complete:
+///
+/// @code
+///   yajson::IncrementalParser p;
+///   p.feed(R"({"id":1,"na)");
+///   p.feed(R"(me":"x"} {"id")");      // first value is now complete
+///   while (auto v = p.next()) handle(*v);
+///   p.feed(":2}");
+///   p.finish();                         // end of stream
+///   while (auto v = p.next()) handle(*v);
+/// @endcode
+///
+/// The input is a stream of zero or more JSON texts separated by optional
+/// whitespace (comments too, when enabled). Chunk boundaries may fall
+/// anywhere, including inside strings, escapes, numbers and comments.
+///
+/// State is kept in an explicit container stack rather than on the call
+/// stack, so a parse can stop at the end of any chunk. Parser memory is
+/// bounded by the nesting depth plus the largest token split across a chunk
+/// boundary; tokens that lie entirely inside one chunk are never copied
+/// (clean strings are delivered as views into the chunk).
+///
+/// A scalar at the top level is complete only once the byte following it
+/// has been seen (a top-level `42` could still become `421`), so it is
+/// reported at the next delimiter or at finish().
+///
+/// Grammar, ParseOptions handling and error codes match parse(); error
+/// locations are relative to the whole stream. After an error the parser
+/// must be reset() before further use.
+
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace yajson {
+
+/// @brief Push parser that reports SAX events (see sax.hpp for the handler
+/// interface) while input is fed chunk by chunk.
+///
+/// String views passed to the handler are valid only during the callback:
+/// they point into the current chunk, or into an internal buffer for tokens
+/// that were split across chunks or contain escapes.
+template <typename Handler>
+class IncrementalSaxParser {
+public:
+    explicit IncrementalSaxParser(Handler& handler, const ParseOptions& opts = {})
+        : handler_(handler), opts_(opts)
+        , max_depth_(opts.max_depth > 0 ? opts.max_depth : YAJSON_MAX_DEPTH) {}
+
+    IncrementalSaxParser(const IncrementalSaxParser&) = delete;
+    IncrementalSaxParser& operator=(const IncrementalSaxParser&) = delete;
+
+    /// @brief Consume the next chunk of input.
+    /// @throws ParseError on invalid JSON (the parser is then unusable until reset()).
+    void feed(std::string_view chunk) {
+        check_usable();
+        const char* p = chunk.data();
+        const char* const end = p + chunk.size();
+        text_begin_ = p;
+        text_loc_ = base_;
+        try {
+            const char* stop = end;
+            if (JSON_UNLIKELY(opts_.validate_utf8)) {
+                p = complete_utf8_tail(p, end);
+                stop = check_utf8(p, end);
+            }
+            consume(p, stop);
+        } catch (...) {
+            failed_ = true;
+            throw;
+        }
+        detail::ParserBase::advance_location(base_, chunk.data(), end);
+    }
+
+    /// @brief Signal the end of the stream.
+    ///
+    /// Completes a pending top-level scalar and checks that no value is left
+    /// open. On success the parser is ready for a new stream.
+    /// @throws ParseError if the stream ends inside a value.
+    void finish() {
+        check_usable();
+        text_begin_ = nullptr;
+        text_loc_ = base_;
+        try {
+            if (utf8_len_ != 0) fail_utf8_tail();
+            if (comment_ == Comment::Slash) fail_here("unexpected character '/'");
+            if (pending_ != Token::None) complete_pending();
+            if (!stack_.empty() || state_ != State::Value) fail_at_end();
+        } catch (...) {
+            failed_ = true;
+            throw;
+        }
+        reset();
+    }
+
+    /// @brief Discard all state (including a previous error) and start a new stream.
+    void reset() noexcept {
+        stack_.clear();
+        keys_.clear();
+        token_.clear();
+        state_ = State::Value;
+        pending_ = Token::None;
+        comment_ = Comment::None;
+        escape_ = false;
+        utf8_len_ = 0;
+        failed_ = false;
+        base_ = SourceLocation{};
+        values_ = 0;
+    }
+
+    /// @brief Current container nesting depth.
+    [[nodiscard]] size_t depth() const noexcept { return stack_.size(); }
+
+    /// @brief Number of top-level values completed since the last reset().
+    [[nodiscard]] size_t values() const noexcept { return values_; }
+
+    /// @brief Bytes held for a token split across chunks.
+    [[nodiscard]] size_t buffered_bytes() const noexcept { return token_.size(); }
+
+    /// @brief Bytes consumed since the last reset().
+    [[nodiscard]] size_t offset() const noexcept { return base_.offset; }
+
+private:
+    /// What the grammar expects next.
+    enum class State : uint8_t {
+        Value,        ///< any value (top level, or after ':')
+        ArrayFirst,   ///< after '[': value or ']'
+        ArrayValue,   ///< after ',' in an array: value (or ']' with trailing commas)
+        ArrayNext,    ///< after an element: ',' or ']'
+        ObjectFirst,  ///< after '{': key or '}'
+        ObjectKey,    ///< after ',' in an object: key (or '}' with trailing commas)
+        ObjectColon,  ///< after a key: ':'
+        ObjectNext,   ///< after a member: ',' or '}'
+    };
+
+    /// Token split across a chunk boundary (bytes so far are in token_).
+    enum class Token : uint8_t { None, String, Scalar };
+
+    /// Comment split across a chunk boundary.
+    enum class Comment : uint8_t { None, Slash, Line, Block, BlockStar };
+
+    struct Frame {
+        size_t count;
+        bool object;
+    };
+
+    /// Forwards token events to the handler; keys go through accept_key().
+    struct Sink {
+        IncrementalSaxParser& self;
+        void on_null() { self.handler_.on_null(); }
+        void on_bool(bool b) { self.handler_.on_bool(b); }
+        void on_int64(int64_t v) { self.handler_.on_int64(v); }
+        void on_uint64(uint64_t v) { self.handler_.on_uint64(v); }
+        void on_double(double v) { self.handler_.on_double(v); }
+        void on_string(std::string_view s) { self.handler_.on_string(s); }
+        void on_key(std::string_view s) { self.accept_key(s); }
+        void start_object() {}
+        void end_object(size_t) {}
+        void start_array() {}
+        void end_array(size_t) {}
+    };
+
+    Handler& handler_;
+    ParseOptions opts_;
+    size_t max_depth_;
+    std::vector<Frame> stack_;
+    std::vector<std::unordered_set<std::string>> keys_;  ///< only without allow_duplicate_keys
+    std::string token_;
+    State state_ = State::Value;
+    Token pending_ = Token::None;
+    Comment comment_ = Comment::None;
+    char quote_ = '"';
+    bool escape_ = false;       ///< token_ ends with an unpaired backslash
+    bool token_key_ = false;    ///< token_ is an object key
+    bool failed_ = false;
+    uint8_t utf8_len_ = 0;      ///< bytes of a UTF-8 sequence split across chunks
+    char utf8_tail_[4] = {};
+    SourceLocation utf8_loc_{};
+    size_t values_ = 0;
+    SourceLocation base_{};     ///< location of the current chunk's first byte
+    SourceLocation token_loc_{};
+    const char* text_begin_ = nullptr;  ///< text that error locations refer to
+    SourceLocation text_loc_{};
+    const char* key_ptr_ = nullptr;     ///< current key (duplicate-key errors point here)
+
+    // ─── Error reporting ──────────────────────────────────────────────────
+
+    void check_usable() const {
+        if (JSON_UNLIKELY(failed_)) {
+            throw ParseError("parser is in an error state (reset() required)", base_,
+                             errc::unexpected_character);
+        }
+    }
+
+    [[nodiscard]] SourceLocation locate(const char* p) const noexcept {
+        if (!text_begin_) return text_loc_;
+        return detail::Parser::shift_location(text_loc_,
+                                              detail::Parser::location_at(text_begin_, p));
+    }
+
+    [[noreturn]] JSON_NOINLINE void fail(const char* p, const std::string& msg,
+                                         errc code = errc::unexpected_character) const {
+        throw ParseError(msg, locate(p), code);
+    }
+
+    [[noreturn]] JSON_NOINLINE void fail_here(const std::string& msg,
+                                              errc code = errc::unexpected_character) const {
+        throw ParseError(msg, text_loc_, code);
+    }
+
+    [[noreturn]] JSON_NOINLINE void fail_unexpected(const char* p) const {
+        fail(p, std::string("unexpected character '") + *p + "'");
+    }
+
+    [[noreturn]] JSON_NOINLINE void fail_utf8_tail() const {
+        throw ParseError("invalid UTF-8 encoding", utf8_loc_, errc::invalid_utf8);
+    }
+
+    [[noreturn]] JSON_NOINLINE void fail_at_end() const {
+        switch (state_) {
+            case State::ArrayFirst:
+            case State::ArrayNext:
+                fail_here("unterminated array", errc::unterminated_array);
+            case State::ObjectFirst:
+            case State::ObjectNext:
+                fail_here("unterminated object", errc::unterminated_object);
+            case State::ObjectKey:
+                fail_here("expected string key in object", errc::unterminated_object);
+            default:
+                fail_here("unexpected end of input", errc::unexpected_end_of_input);
+        }
+    }
+
+    // ─── Whitespace and comments ──────────────────────────────────────────
+
+    const char* skip_ws(const char* p, const char* end) {
+        for (;;) {
+            switch (comment_) {
+                case Comment::None:
+                    while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) ++p;
+                    if (p >= end || *p != '/' || !opts_.allow_comments) return p;
+                    if (p + 1 >= end) {
+                        comment_ = Comment::Slash;
+                        return end;
+                    }
+                    if (p[1] == '/') comment_ = Comment::Line;
+                    else if (p[1] == '*') comment_ = Comment::Block;
+                    else return p;  // not a comment: the grammar rejects '/'
+                    p += 2;
+                    break;
+                case Comment::Slash:
+                    if (p >= end) return end;
+                    if (*p == '/') comment_ = Comment::Line;
+                    else if (*p == '*') comment_ = Comment::Block;
+                    else fail_here("unexpected character '/'");
+                    ++p;
+                    break;
+                case Comment::Line: {
+                    const void* nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+                    if (!nl) return end;
+                    p = static_cast<const char*>(nl) + 1;
+                    comment_ = Comment::None;
+                    break;
+                }
+                case Comment::Block:
+                case Comment::BlockStar:
+                    for (;;) {
+                        if (p >= end) return end;
+                        if (comment_ == Comment::BlockStar && *p == '/') {
+                            ++p;
+                            comment_ = Comment::None;
+                            break;
+                        }
+                        comment_ = *p == '*' ? Comment::BlockStar : Comment::Block;
+                        ++p;
+                    }
+                    break;
+            }
+        }
+    }
+
+    // ─── UTF-8 validation ─────────────────────────────────────────────────
+
+    /// Length of the UTF-8 sequence led by @p c (0 for a byte that cannot
+    /// start a multi-byte sequence).
+    static int utf8_sequence_length(unsigned char c) noexcept {
+        if (c >= 0xC2 && c <= 0xDF) return 2;
+        if (c >= 0xE0 && c <= 0xEF) return 3;
+        if (c >= 0xF0 && c <= 0xF4) return 4;
+        return 0;
+    }
+
+    /// Complete a sequence held back by check_utf8() with the first bytes of
+    /// the chunk, validate it and parse it; returns where the chunk resumes.
+    const char* complete_utf8_tail(const char* p, const char* end) {
+        if (utf8_len_ == 0) return p;
+        const int need = utf8_sequence_length(static_cast<unsigned char>(utf8_tail_[0]));
+        while (utf8_len_ < need && p < end) utf8_tail_[utf8_len_++] = *p++;
+        if (utf8_len_ < need) return p;
+        if (detail::simd::validate_utf8(utf8_tail_, utf8_tail_ + need) != utf8_tail_ + need) {
+            fail_utf8_tail();
+        }
+        const char* saved_begin = text_begin_;
+        const SourceLocation saved_loc = text_loc_;
+        text_begin_ = utf8_tail_;
+        text_loc_ = utf8_loc_;
+        consume(utf8_tail_, utf8_tail_ + need);  // no quote inside: nothing views the buffer
+        text_begin_ = saved_begin;
+        text_loc_ = saved_loc;
+        utf8_len_ = 0;
+        return p;
+    }
+
+    /// ParseOptions::validate_utf8: check the chunk before any of it is
+    /// parsed, as parse() checks the whole input. A sequence cut by the end
+    /// of the chunk is held back in utf8_tail_; returns where the checked
+    /// bytes end.
+    const char* check_utf8(const char* p, const char* end) {
+        const char* stop = end;
+        for (int k = 1; k <= 3 && end - k >= p; ++k) {
+            const auto c = static_cast<unsigned char>(end[-k]);
+            if ((c & 0xC0) == 0x80) continue;
+            if (utf8_sequence_length(c) > k) stop = end - k;
+            break;
+        }
+        const char* bad = detail::simd::validate_utf8(p, stop);
+        if (JSON_UNLIKELY(bad != stop)) fail(bad, "invalid UTF-8 encoding", errc::invalid_utf8);
+        if (stop != end) {
+            utf8_len_ = static_cast<uint8_t>(end - stop);
+            std::memcpy(utf8_tail_, stop, utf8_len_);
+            utf8_loc_ = locate(stop);
+        }
+        return stop;
+    }
+
+    // ─── Grammar ──────────────────────────────────────────────────────────
+
+    /// Parse [p, end) of the current text.
+    void consume(const char* p, const char* end) {
+        if (pending_ != Token::None) p = continue_token(p, end);
+        while (p < end) {
+            p = skip_ws(p, end);
+            if (p >= end) break;
+            p = step(p, end);
+        }
+    }
+
+    /// Process the significant byte at @p p; returns the next position.
+    const char* step(const char* p, const char* end) {
+        const char c = *p;
+        switch (state_) {
+            case State::Value:
+                return begin_value(p, end);
+            case State::ArrayFirst:
+                if (c == ']') return close(p, false);
+                return begin_value(p, end);
+            case State::ArrayValue:
+                if (c == ']' && opts_.allow_trailing_commas) return close(p, false);
+                return begin_value(p, end);
+            case State::ArrayNext:
+                if (c == ',') { state_ = State::ArrayValue; return p + 1; }
+                if (c == ']') return close(p, false);
+                fail(p, "expected ',' or ']' in array");
+            case State::ObjectFirst:
+                if (c == '}') return close(p, true);
+                return begin_key(p, end);
+            case State::ObjectKey:
+                if (c == '}' && opts_.allow_trailing_commas) return close(p, true);
+                return begin_key(p, end);
+            case State::ObjectColon:
+                if (c == ':') { state_ = State::Value; return p + 1; }
+                fail(p, std::string("expected ':', got '") + c + "'");
+            case State::ObjectNext:
+                if (c == ',') { state_ = State::ObjectKey; return p + 1; }
+                if (c == '}') return close(p, true);
+                fail(p, "expected ',' or '}' in object");
+        }
+        return p + 1;  // unreachable
+    }
+
+    const char* begin_value(const char* p, const char* end) {
+        switch (*p) {
+            case '[': return open(p, false);
+            case '{': return open(p, true);
+            case '"': return begin_string(p, end, false);
+            case '\'':
+                if (opts_.allow_single_quotes) return begin_string(p, end, false);
+                fail_unexpected(p);
+            default:
+                if (is_scalar_char(*p)) return begin_scalar(p, end, false);
+                fail_unexpected(p);
+        }
+    }
+
+    const char* begin_key(const char* p, const char* end) {
+        if (*p == '"' || (*p == '\'' && opts_.allow_single_quotes)) {
+            return begin_string(p, end, true);
+        }
+        if (opts_.allow_unquoted_keys && is_ident_start(*p)) return begin_scalar(p, end, true);
+        fail(p, "expected string key in object", errc::unterminated_object);
+    }
+
+    const char* open(const char* p, bool object) {
+        if (JSON_UNLIKELY(stack_.size() >= max_depth_)) {
+            fail(p + 1, "maximum nesting depth exceeded", errc::max_depth_exceeded);
+        }
+        stack_.push_back({0, object});
+        if (object) {
+            if (JSON_UNLIKELY(!opts_.allow_duplicate_keys)) keys_.emplace_back();
+            handler_.start_object();
+            state_ = State::ObjectFirst;
+        } else {
+            handler_.start_array();
+            state_ = State::ArrayFirst;
+        }
+        return p + 1;
+    }
+
+    const char* close(const char* p, bool object) {
+        const size_t count = stack_.back().count;
+        stack_.pop_back();
+        if (object) {
+            if (JSON_UNLIKELY(!opts_.allow_duplicate_keys)) keys_.pop_back();
+            handler_.end_object(count);
+        } else {
+            handler_.end_array(count);
+        }
+        value_done();
+        return p + 1;
+    }
+
+    void value_done() noexcept {
+        if (stack_.empty()) {
+            ++values_;
+            state_ = State::Value;
+            return;
+        }
+        Frame& top = stack_.back();
+        ++top.count;
+        state_ = top.object ? State::ObjectNext : State::ArrayNext;
+    }
+
+    void accept_key(std::string_view key) {
+        if (JSON_UNLIKELY(!opts_.allow_duplicate_keys)) {
+            if (!keys_.back().emplace(key).second) {
+                fail(key_ptr_, "duplicate key: \"" + std::string(key) + "\"",
+                     errc::duplicate_key);
+            }
+        }
+        handler_.on_key(key);
+    }
+
+    // ─── Tokens ───────────────────────────────────────────────────────────
+
+    static bool is_ident_start(char c) noexcept {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$';
+    }
+
+    /// Bytes that can continue a number, literal or unquoted key.
+    static bool is_scalar_char(char c) noexcept {
+        return is_ident_start(c) || (c >= '0' && c <= '9') ||
+               c == '-' || c == '+' || c == '.';
+    }
+
+    /// Find the closing @p quote of a string whose content starts at @p p.
+    /// Returns nullptr if the chunk ends first; escape_ then records whether
+    /// the chunk ended right after a backslash.
+    const char* find_close(const char* p, const char* end, char quote) noexcept {
+        if (escape_) {
+            if (p >= end) return nullptr;
+            ++p;
+            escape_ = false;
+        }
+        for (;;) {
+            if (quote == '"') {
+                p = detail::simd::find_string_delimiter(p, end);
+            } else {
+                while (p < end && *p != quote && *p != '\\') ++p;
+            }
+            if (p >= end) return nullptr;
+            if (*p == quote) return p;
+            if (p + 1 >= end) {
+                escape_ = true;
+                return nullptr;
+            }
+            p += 2;
+        }
+    }
+
+    const char* begin_string(const char* p, const char* end, bool key) {
+        const char quote = *p;
+        if (JSON_LIKELY(quote == '"')) {
+            // Fast path: string without escapes, delivered as a view into the chunk
+            const char* delim = detail::simd::find_string_delimiter(p + 1, end);
+            if (delim < end && *delim == '"') {
+                const char* bad = opts_.allow_control_chars
+                                ? delim : detail::simd::find_needs_escape<false>(p + 1, delim);
+                if (bad >= delim || static_cast<unsigned char>(*bad) >= 0x20) {
+                    const std::string_view sv(p + 1, static_cast<size_t>(delim - p - 1));
+                    if (key) {
+                        key_ptr_ = p;
+                        accept_key(sv);
+                        state_ = State::ObjectColon;
+                    } else {
+                        handler_.on_string(sv);
+                        value_done();
+                    }
+                    return delim + 1;
+                }
+            }
+        }
+        escape_ = false;
+        if (const char* close = find_close(p + 1, end, quote)) {
+            return complete_token(p, close + 1, key);
+        }
+        buffer_token(p, end, Token::String, key);
+        quote_ = quote;
+        return end;
+    }
+
+    const char* begin_scalar(const char* p, const char* end, bool key) {
+        const char* q = p + 1;
+        while (q < end && is_scalar_char(*q)) ++q;
+        if (q < end) return complete_token(p, q, key);
+        buffer_token(p, end, Token::Scalar, key);
+        return end;
+    }
+
+    void buffer_token(const char* p, const char* end, Token kind, bool key) {
+        token_.assign(p, static_cast<size_t>(end - p));
+        token_loc_ = locate(p);
+        pending_ = kind;
+        token_key_ = key;
+    }
+
+    /// Resume a token split across chunks; returns the position after it.
+    const char* continue_token(const char* p, const char* end) {
+        if (pending_ == Token::String) {
+            const char* close = find_close(p, end, quote_);
+            if (!close) {
+                token_.append(p, static_cast<size_t>(end - p));
+                return end;
+            }
+            token_.append(p, static_cast<size_t>(close + 1 - p));
+            p = close + 1;
+        } else {
+            const char* q = p;
+            while (q < end && is_scalar_char(*q)) ++q;
+            token_.append(p, static_cast<size_t>(q - p));
+            if (q == end) return end;
+            p = q;
+        }
+        complete_pending();
+        return p;
+    }
+
+    /// Parse the reassembled token in token_ (also used by finish()).
+    void complete_pending() {
+        pending_ = Token::None;
+        const char* saved_begin = text_begin_;
+        const SourceLocation saved_loc = text_loc_;
+        text_begin_ = token_.data();
+        text_loc_ = token_loc_;
+        complete_token(token_.data(), token_.data() + token_.size(), token_key_);
+        text_begin_ = saved_begin;
+        text_loc_ = saved_loc;
+        token_.clear();
+    }
+
+    /// Deliver literals and short integers without setting up a Parser.
+    bool try_simple_scalar(const char* first, const char* last) {
+        const size_t len = static_cast<size_t>(last - first);
+        if (len == 4 && std::memcmp(first, "true", 4) == 0) { handler_.on_bool(true); return true; }
+        if (len == 5 && std::memcmp(first, "false", 5) == 0) { handler_.on_bool(false); return true; }
+        if (len == 4 && std::memcmp(first, "null", 4) == 0) { handler_.on_null(); return true; }
+
+        const bool negative = *first == '-';
+        const char* p = first + negative;
+        const size_t digits = static_cast<size_t>(last - p);
+        if (digits == 0 || digits > 18 || (*p == '0' && digits > 1)) return false;
+        int64_t v = 0;
+        for (; p < last; ++p) {
+            const unsigned d = static_cast<unsigned>(*p - '0');
+            if (d > 9) return false;
+            v = v * 10 + static_cast<int64_t>(d);
+        }
+        handler_.on_int64(negative ? -v : v);
+        return true;
+    }
+
+    /// Deliver a complete token [first, last) through the regular parser.
+    const char* complete_token(const char* first, const char* last, bool key) {
+        if (!key && try_simple_scalar(first, last)) {
+            value_done();
+            return last;
+        }
+        if (key) key_ptr_ = first;
+        Sink sink{*this};
+        const char* stop = detail::Parser::parse_token_events(
+            text_begin_ ? text_begin_ : first, first, last, key, sink, opts_, text_loc_);
+        if (key) state_ = State::ObjectColon;
+        else value_done();
+        if (JSON_UNLIKELY(stop < last)) {
+            // Bytes glued to the token (e.g. "truex", "1.5.3"): the grammar
+            // rejects them exactly as parse() would.
+            if (stack_.empty() && state_ == State::Value) {
+                fail(stop, "unexpected trailing content", errc::trailing_content);
+            }
+            step(stop, last);
+        }
+        return last;
+    }
+};
+
+/// @brief Push parser that assembles complete top-level JsonValues.
+///
+/// Values become available through next() as soon as their closing byte
+/// has been fed (top-level scalars: see the note in the file header).
+class IncrementalParser {
+public:
+    explicit IncrementalParser(const ParseOptions& opts = {})
+        : sax_(builder_, opts) {}
+
+    IncrementalParser(const IncrementalParser&) = delete;
+    IncrementalParser& operator=(const IncrementalParser&) = delete;
+
+    /// @brief Consume the next chunk of input.
+    /// @throws ParseError on invalid JSON (reset() before reuse).
+    void feed(std::string_view chunk) { sax_.feed(chunk); }
+
+    /// @brief Signal the end of the stream.
+    /// @throws ParseError if the stream ends inside a value.
+    void finish() { sax_.finish(); }
+
+    /// @brief Discard all state, including completed values not yet taken.
+    void reset() {
+        sax_.reset();
+        builder_.clear();
+    }
+
+    /// @brief True if a completed value is waiting in next().
+    [[nodiscard]] bool has_value() const noexcept { return !builder_.ready.empty(); }
+
+    /// @brief Take the oldest completed value, if any.
+    [[nodiscard]] std::optional<JsonValue> next() {
+        if (builder_.ready.empty()) return std::nullopt;
+        std::optional<JsonValue> v(std::move(builder_.ready.front()));
+        builder_.ready.pop_front();
+        return v;
+    }
+
+    /// @brief Current container nesting depth.
+    [[nodiscard]] size_t depth() const noexcept { return sax_.depth(); }
+
+    /// @brief Bytes held for a token split across chunks.
+    [[nodiscard]] size_t buffered_bytes() const noexcept { return sax_.buffered_bytes(); }
+
+private:
+    /// Builds values from events; open containers live on an explicit stack.
+    struct Builder {
+        std::vector<JsonValue> stack;
+        std::vector<std::string> keys;
+        std::deque<JsonValue> ready;
+
+        void clear() {
+            stack.clear();
+            keys.clear();
+            ready.clear();
+        }
+
+        void add(JsonValue v) {
+            if (stack.empty()) {
+                ready.push_back(std::move(v));
+                return;
+            }
+            JsonValue& top = stack.back();
+            if (top.is_array()) {
+                top.push_back(std::move(v));
+            } else {
+                top.as_object().entries.emplace_back(std::move(keys.back()), std::move(v));
+                keys.pop_back();
+            }
+        }
+
+        void close() {
+            JsonValue v = std::move(stack.back());
+            stack.pop_back();
+            add(std::move(v));
+        }
+
+        void on_null() { add(JsonValue(nullptr)); }
+        void on_bool(bool b) { add(JsonValue(b)); }
+        void on_int64(int64_t v) { add(JsonValue(v)); }
+        void on_uint64(uint64_t v) { add(JsonValue(v)); }
+        void on_double(double v) { add(JsonValue(v)); }
+        void on_string(std::string_view s) { add(JsonValue(s)); }
+        void on_key(std::string_view s) { keys.emplace_back(s); }
+        void start_object() { stack.push_back(JsonValue::object()); }
+        void end_object(size_t) {
+            detail::ParserBase::finalize_object(stack.back().as_object());  // as in parse()
+            close();
+        }
+        void start_array() { stack.push_back(JsonValue::array()); }
+        void end_array(size_t) { close(); }
+    };
+
+    Builder builder_;
+    IncrementalSaxParser<Builder> sax_;
+};
+
+} // namespace yajson
@@ -12,10 +12,21 @@
 #include "parse_options.hpp"
 #include "serializer.hpp"
 #include "parser.hpp"
+#include "parser_context.hpp"
+#include "padded_string.hpp"
+#include "sax.hpp"
+#include "incremental.hpp"
+#include "tape.hpp"
+#include "ondemand.hpp"
 #include "stream_parser.hpp"
+#include "array_stream.hpp"
+#include "ndjson.hpp"
+#include "parallel.hpp"
+#include "batch.hpp"
 #include "thread_safe.hpp"
 #include "conversion.hpp"
 #include "json_pointer.hpp"
+#include "extract.hpp"
 #include "json_writer.hpp"
 #include "allocator.hpp"
 
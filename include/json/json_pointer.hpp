@@ -102,71 +102,36 @@ public:
         return *this;
     }
 
-    JsonPointer(JsonPointer&& o) noexcept = default;
-    JsonPointer& operator=(JsonPointer&& o) noexcept = default;
+    /// Move constructor — a short source_ lives in SSO storage, which does
+    /// not move with the string, so views into it must be re-pointed.
+    JsonPointer(JsonPointer&& o) noexcept { move_from(o); }
+
+    JsonPointer& operator=(JsonPointer&& o) noexcept {
+        if (this != &o) move_from(o);
+        return *this;
+    }
 
     /// Resolve pointer against a JSON value (const). Throws on failure.
     const JsonValue& resolve(const JsonValue& root) const {
-        const JsonValue* cur = &root;
-        for (size_t i = 0; i < tokens_.size(); ++i) {
-            const auto& tok = tokens_[i];
-            if (cur->is_object()) {
-                auto* p = cur->find(tok);
-                if (!p)
-                    throw OutOfRangeError("JSON pointer: key not found \"" +
-                                          std::string(tok) + "\" at depth " +
-                                          size_to_string(i));
-                cur = p;
-            } else if (cur->is_array()) {
-                size_t idx = parse_index(tok, cur->as_array().size());
-                cur = &cur->as_array()[idx];
-            } else {
-                throw TypeError("JSON pointer: cannot index into " +
-                                std::string(type_name(cur->type())) +
-                                " at depth " + size_to_string(i));
-            }
-        }
-        return *cur;
+        return resolve_in(root);
     }
 
-    /// Resolve pointer against a JSON value (mutable).
+    /// Resolve pointer against a JSON value (mutable); a packed array on the
+    /// path is unpacked.
     JsonValue& resolve(JsonValue& root) const {
-        return const_cast<JsonValue&>(
-            static_cast<const JsonPointer*>(this)->resolve(
-                static_cast<const JsonValue&>(root)));
+        return resolve_in(root);
     }
 
-    /// Try to resolve without exceptions; returns nullptr if path doesn't exist.
-    const JsonValue* try_resolve(const JsonValue& root) const noexcept {
-        const JsonValue* cur = &root;
-        for (size_t i = 0; i < tokens_.size(); ++i) {
-            const auto& tok = tokens_[i];
-            if (cur->is_object()) {
-                auto* p = cur->find(tok);
-                if (!p) return nullptr;
-                cur = p;
-            } else if (cur->is_array()) {
-                const auto& arr = cur->as_array();
-                if (tok.empty()) return nullptr;
-                if (tok.size() > 1 && tok[0] == '0') return nullptr;
-                size_t idx = 0;
-                for (char c : tok) {
-                    if (c < '0' || c > '9') return nullptr;
-                    idx = idx * 10 + static_cast<size_t>(c - '0');
-                    if (idx >= arr.size() + 1) return nullptr;
-                }
-                if (idx >= arr.size()) return nullptr;
-                cur = &arr[idx];
-            } else {
-                return nullptr;
-            }
-        }
-        return cur;
+    /// Try to resolve; returns nullptr if the path doesn't exist. Elements
+    /// of a packed array are found like those of any other array (the const
+    /// form reads its element view, the mutable form unpacks it), so this
+    /// may throw std::bad_alloc, but never for a missing path.
+    const JsonValue* try_resolve(const JsonValue& root) const {
+        return try_resolve_in(root);
     }
 
-    JsonValue* try_resolve(JsonValue& root) const noexcept {
-        return const_cast<JsonValue*>(
-            try_resolve(static_cast<const JsonValue&>(root)));
+    JsonValue* try_resolve(JsonValue& root) const {
+        return try_resolve_in(root);
     }
 
     /// Set a value at this pointer location, creating intermediate objects.
@@ -281,6 +246,62 @@ public:
     bool operator!=(const JsonPointer& o) const { return tokens_ != o.tokens_; }
 
 private:
+    /// resolve() for a const or mutable @p root (V = const JsonValue or
+    /// JsonValue): the mutable form reaches array elements through the
+    /// non-const as_array(), which unpacks a packed array.
+    template <typename V>
+    V& resolve_in(V& root) const {
+        V* cur = &root;
+        for (size_t i = 0; i < tokens_.size(); ++i) {
+            const auto& tok = tokens_[i];
+            if (cur->is_object()) {
+                auto* p = cur->find(tok);
+                if (!p)
+                    throw OutOfRangeError("JSON pointer: key not found \"" +
+                                          std::string(tok) + "\" at depth " +
+                                          size_to_string(i));
+                cur = p;
+            } else if (cur->is_array()) {
+                auto& arr = cur->as_array();
+                cur = &arr[parse_index(tok, arr.size())];
+            } else {
+                throw TypeError("JSON pointer: cannot index into " +
+                                std::string(type_name(cur->type())) +
+                                " at depth " + size_to_string(i));
+            }
+        }
+        return *cur;
+    }
+
+    /// try_resolve() for a const or mutable @p root, as resolve_in().
+    template <typename V>
+    V* try_resolve_in(V& root) const {
+        V* cur = &root;
+        for (size_t i = 0; i < tokens_.size(); ++i) {
+            const auto& tok = tokens_[i];
+            if (cur->is_object()) {
+                auto* p = cur->find(tok);
+                if (!p) return nullptr;
+                cur = p;
+            } else if (cur->is_array()) {
+                if (tok.empty()) return nullptr;
+                if (tok.size() > 1 && tok[0] == '0') return nullptr;
+                const size_t n = cur->size();
+                size_t idx = 0;
+                for (char c : tok) {
+                    if (c < '0' || c > '9') return nullptr;
+                    idx = idx * 10 + static_cast<size_t>(c - '0');
+                    if (idx >= n + 1) return nullptr;
+                }
+                if (idx >= n) return nullptr;
+                cur = &cur->as_array()[idx];
+            } else {
+                return nullptr;
+            }
+        }
+        return cur;
+    }
+
     /// Original pointer string — string_view tokens reference into this.
     std::string source_;
 
@@ -290,6 +311,26 @@ private:
     /// Token views: either into source_ or into unescaped_ strings.
     std::vector<std::string_view> tokens_;
 
+    /// Take o's state; tokens into o.source_ are shifted onto our source_.
+    /// Tokens into unescaped_ stay valid: the vector's buffer is moved.
+    void move_from(JsonPointer& o) noexcept {
+        const char* old = o.source_.data();
+        const size_t old_size = o.source_.size();
+        source_ = std::move(o.source_);
+        unescaped_ = std::move(o.unescaped_);
+        tokens_ = std::move(o.tokens_);
+        if (source_.data() != old) {
+            for (auto& tok : tokens_) {
+                if (tok.data() >= old && tok.data() <= old + old_size) {
+                    tok = std::string_view(source_.data() + (tok.data() - old), tok.size());
+                }
+            }
+        }
+        o.source_.clear();
+        o.unescaped_.clear();
+        o.tokens_.clear();
+    }
+
     /// Rebuild tokens_ after copy, adjusting string_view pointers.
     void rebuild_tokens(const JsonPointer& o) {
         tokens_.resize(o.tokens_.size());
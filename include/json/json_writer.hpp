@@ -20,6 +20,7 @@
 
 #include "config.hpp"
 #include "error.hpp"
+#include "detail/dtoa.hpp"
 
 #include <charconv>
 #include <cmath>
@@ -104,19 +105,9 @@ public:
         if (JSON_UNLIKELY(std::isnan(v) || std::isinf(v))) {
             write_raw("null", 4);
         } else {
-            char buf[32];
-            auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), v);
-            size_t len = static_cast<size_t>(ptr - buf);
-            write_raw(buf, len);
-            // Ensure it looks like a float (contains '.' or 'e')
-            bool has_dot = false;
-            for (size_t i = 0; i < len; ++i) {
-                if (buf[i] == '.' || buf[i] == 'e' || buf[i] == 'E') {
-                    has_dot = true;
-                    break;
-                }
-            }
-            if (!has_dot) write_raw(".0", 2);
+            // Same output as the DOM serializer
+            char buf[40];
+            write_raw(buf, detail::fast_dtoa(buf, v));
         }
         post_value();
         return *this;
@@ -0,0 +1,249 @@
+#pragma once
+
+/// @file ndjson.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Reader for newline-delimited JSON (NDJSON / JSON Lines).
+///
+/// Splits the input on '\n' with the SIMD newline kernel and parses each
+/// record into a MonotonicArena that is reset between records, so a
+/// multi-gigabyte log is processed with a small, constant working set:
+///
+/// @code
+///   auto reader = yajson::ndjson::Reader::open("events.ndjson");
+///   for (const auto& rec : reader) {
+///       if (!rec) {
+///           std::cerr << "line " << rec.line << ": " << rec.message << '\n';
+///           continue;                        // bad lines do not stop the stream
+///       }
+///       handle(rec.value);                   // valid until the next record
+///   }
+/// @endcode
+///
+/// Records are the lines of the input with a trailing "\r" removed. Lines
+/// that are empty or contain only whitespace are skipped. A record's value
+/// lives in the reader's arena and is invalidated when the iterator
+/// advances; copy it (outside of any ArenaScope) to keep it longer.
+///
+/// Raw newlines inside strings are not valid JSON, so they cannot occur
+/// inside a record unless ParseOptions::allow_control_chars is set — in
+/// which case they still split the record, as NDJSON requires.
+
+#include "arena.hpp"
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "stream_parser.hpp"
+#include "value.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace yajson::ndjson {
+
+/// @brief One line of an NDJSON stream.
+struct Record {
+    size_t line = 0;           ///< 1-based line number in the input
+    size_t offset = 0;         ///< Byte offset of the line in the input
+    std::string_view text;     ///< Raw line (without "\n" / "\r\n")
+    JsonValue value;           ///< Parsed value (null on error; arena-backed)
+    std::error_code ec;        ///< Parse error for this line, if any
+    size_t column = 0;         ///< 1-based column of the error within the line
+    std::string message;       ///< Full error message (empty on success)
+
+    [[nodiscard]] bool ok() const noexcept { return !ec; }
+    explicit operator bool() const noexcept { return !ec; }
+};
+
+/// @brief Forward iteration over the records of an NDJSON input.
+///
+/// The reader owns the per-record arena (and, for open(), the file
+/// mapping). It is movable but not copyable; iterators refer to the reader
+/// and are invalidated by moving it. Only one pass is supported: begin()
+/// restarts from the first line.
+class Reader {
+public:
+    /// Default per-record arena size; grows to fit the largest record seen.
+    static constexpr size_t kDefaultArenaSize = 64 * 1024;
+
+    /// @brief Read records from @p input (must outlive the reader).
+    explicit Reader(std::string_view input, const ParseOptions& opts = {},
+                    size_t arena_size = kDefaultArenaSize)
+        : input_(input), opts_(opts) {
+        reserve_arena(arena_size);
+    }
+
+    /// @brief Read records from a file (memory-mapped where supported).
+    /// @throws ParseError if the file cannot be opened.
+    [[nodiscard]] static Reader open(const char* path, const ParseOptions& opts = {},
+                                     size_t arena_size = kDefaultArenaSize) {
+        Reader r(std::string_view{}, opts, arena_size);
+        r.file_ = std::make_unique<FileData>();
+        r.input_ = r.file_->load(path);
+        return r;
+    }
+
+    [[nodiscard]] static Reader open(const std::string& path, const ParseOptions& opts = {},
+                                     size_t arena_size = kDefaultArenaSize) {
+        return open(path.c_str(), opts, arena_size);
+    }
+
+    Reader(Reader&&) noexcept = default;
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+    Reader& operator=(Reader&&) = delete;
+
+    /// @brief Input iterator over records; dereferences to the current Record.
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Record;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Record*;
+        using reference = const Record&;
+
+        iterator() = default;
+
+        reference operator*() const noexcept { return reader_->record_; }
+        pointer operator->() const noexcept { return &reader_->record_; }
+
+        iterator& operator++() {
+            if (!reader_->next()) reader_ = nullptr;
+            return *this;
+        }
+
+        bool operator==(const iterator& o) const noexcept { return reader_ == o.reader_; }
+        bool operator!=(const iterator& o) const noexcept { return reader_ != o.reader_; }
+
+    private:
+        friend class Reader;
+        explicit iterator(Reader* r) noexcept : reader_(r) {}
+        Reader* reader_ = nullptr;
+    };
+
+    /// @brief Rewind to the first line and return an iterator to the first record.
+    [[nodiscard]] iterator begin() {
+        rewind();
+        return next() ? iterator(this) : iterator();
+    }
+
+    [[nodiscard]] iterator end() noexcept { return iterator(); }
+
+    /// @brief Advance to the next record; returns false at end of input.
+    /// The previous record (and its value) is invalidated.
+    bool next() {
+        record_.value = JsonValue();
+        for (;;) {
+            if (pos_ >= input_.size()) return false;
+            const char* const base = input_.data();
+            const char* first = base + pos_;
+            const char* nl = detail::simd::find_newline(first, base + input_.size());
+            const char* last = nl;
+            pos_ = static_cast<size_t>(nl - base) + 1;
+            ++line_;
+            if (last > first && last[-1] == '\r') --last;
+            if (is_blank(first, last)) continue;
+
+            record_.line = line_;
+            record_.offset = static_cast<size_t>(first - base);
+            record_.text = std::string_view(first, static_cast<size_t>(last - first));
+            parse_record();
+            return true;
+        }
+    }
+
+    /// @brief The current record (valid after a successful next()).
+    [[nodiscard]] const Record& record() const noexcept { return record_; }
+
+    /// @brief Number of records that failed to parse so far.
+    [[nodiscard]] size_t error_count() const noexcept { return errors_; }
+
+    /// @brief The whole input being read.
+    [[nodiscard]] std::string_view input() const noexcept { return input_; }
+
+    /// @brief Restart from the first line.
+    void rewind() noexcept {
+        record_.value = JsonValue();
+        record_ = Record{};
+        pos_ = 0;
+        line_ = 0;
+        errors_ = 0;
+    }
+
+private:
+    /// Backing storage for open(): a read-only mapping or a loaded copy.
+    struct FileData {
+#if defined(YAJSON_HAS_MMAP)
+        detail::MappedFile mapped;
+#endif
+        std::string content;
+
+        std::string_view load(const char* path) {
+#if defined(YAJSON_HAS_MMAP)
+            int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                throw ParseError("cannot open file", SourceLocation{},
+                                 errc::unexpected_end_of_input);
+            }
+            const bool ok = mapped.open(fd);
+            ::close(fd);
+            if (ok) return mapped.view();
+#endif
+            std::ifstream ifs(path, std::ios::binary);
+            if (!ifs) {
+                throw ParseError("cannot open file", SourceLocation{},
+                                 errc::unexpected_end_of_input);
+            }
+            content = detail::read_stream(ifs);
+            return content;
+        }
+    };
+
+    // record_ is declared last so its arena-backed value is destroyed first
+    std::string_view input_;
+    ParseOptions opts_;
+    std::unique_ptr<detail::BufferedArena> arena_;
+    std::unique_ptr<FileData> file_;
+    Record record_;
+    size_t pos_ = 0;
+    size_t line_ = 0;
+    size_t errors_ = 0;
+
+    static bool is_blank(const char* p, const char* end) noexcept {
+        for (; p < end; ++p) {
+            if (*p != ' ' && *p != '\t' && *p != '\r') return false;
+        }
+        return true;
+    }
+
+    void reserve_arena(size_t n) {
+        arena_ = std::make_unique<detail::BufferedArena>(n < 256 ? 256 : n);
+    }
+
+    void parse_record() {
+        // A record that overflowed into heap blocks last time gets a larger
+        // initial buffer, so steady state stays allocation-free.
+        detail::rewind_or_grow(arena_);
+
+        record_.ec.clear();
+        record_.column = 0;
+        record_.message.clear();
+        try {
+            ArenaScope scope(arena_->arena);
+            record_.value = detail::Parser::parse(record_.text, opts_);
+        } catch (const ParseError& e) {
+            record_.value = JsonValue();
+            record_.ec = e.code();
+            record_.column = e.location().column;
+            record_.message = e.what();
+            ++errors_;
+        }
+    }
+};
+
+} // namespace yajson::ndjson
@@ -0,0 +1,580 @@
+#pragma once
+
+/// @file ondemand.hpp
+/// @author Aleksandr Loshkarev
+/// @brief On-demand (lazy) JSON access: parse only what is read.
+///
+/// An ondemand::Document wraps the input buffer without parsing it. Values
+/// are lightweight cursors (document pointer + input position); navigating
+/// to a field scans forward from the enclosing container, passing over
+/// unrelated subtrees with a bracket-matching skip. Scalars are converted
+/// with the regular parser on just their token, so number and string
+/// semantics are identical to yajson::parse().
+///
+/// @code
+///   yajson::ondemand::Document doc(payload);
+///   auto user  = doc.root()["user"];
+///   int64_t id = user["id"].as_integer();
+///   std::string_view name = user["name"].as_string_view();  // zero-copy
+///   yajson::JsonValue tags = user["tags"].to_value();        // materialize
+/// @endcode
+///
+/// Semantics and limits:
+///   - Only the parts that are visited are validated. Errors surface as
+///     ParseError (with document-relative line/column) when reached.
+///   - Member lookup returns the first occurrence of a duplicate key
+///     (the DOM keeps the last), so it can stop early. With
+///     allow_duplicate_keys = false, lookup and iteration first scan the
+///     whole object and throw ParseError (errc::duplicate_key) on a repeat.
+///   - Each lookup rescans its container: O(members) per access.
+///   - Escaped strings and keys are decoded once per token and cached in
+///     the Document, so the cache is bounded by the input.
+///   - The input must outlive the Document; Values must not outlive it.
+///     A Document is not safe for concurrent use (because of that cache).
+
+#include "config.hpp"
+#include "detail/simd.hpp"
+#include "detail/structural.hpp"
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace yajson::ondemand {
+
+class Document;
+class Array;
+class Object;
+
+// ─── Value ───────────────────────────────────────────────────────────────────
+
+/// @brief Cursor to a not-yet-parsed JSON value inside a Document.
+class Value {
+public:
+    Value() noexcept = default;
+
+    /// Type of the value. Numbers are classified by parsing the token.
+    [[nodiscard]] Type type() const;
+    [[nodiscard]] bool is_null()   const noexcept { return first() == 'n'; }
+    [[nodiscard]] bool is_bool()   const noexcept { return first() == 't' || first() == 'f'; }
+    [[nodiscard]] bool is_string() const noexcept { return first() == '"' || first() == '\''; }
+    [[nodiscard]] bool is_array()  const noexcept { return first() == '['; }
+    [[nodiscard]] bool is_object() const noexcept { return first() == '{'; }
+    [[nodiscard]] bool is_number() const {
+        const Type t = type();
+        return t == Type::Integer || t == Type::UInteger || t == Type::Float ||
+               t == Type::RawNumber;
+    }
+
+    [[nodiscard]] bool as_bool() const { return scalar().as_bool(); }
+    [[nodiscard]] int64_t as_integer() const { return scalar().as_integer(); }
+    [[nodiscard]] uint64_t as_uinteger() const { return scalar().as_uinteger(); }
+    [[nodiscard]] double as_float() const { return scalar().as_float(); }
+
+    /// String content. Points into the input for strings without escapes;
+    /// escaped strings are decoded once and cached in the Document.
+    [[nodiscard]] std::string_view as_string_view() const;
+    [[nodiscard]] std::string as_string() const { return std::string(as_string_view()); }
+
+    [[nodiscard]] Array as_array() const;
+    [[nodiscard]] Object as_object() const;
+
+    /// Number of elements/members (scans the container; 0 for scalars).
+    [[nodiscard]] size_t size() const;
+
+    /// Object member access. Throws OutOfRangeError if missing.
+    [[nodiscard]] Value operator[](std::string_view key) const;
+    [[nodiscard]] Value operator[](const char* key) const {
+        return operator[](std::string_view(key));
+    }
+    /// Array element access, O(index). Throws OutOfRangeError if out of range.
+    [[nodiscard]] Value operator[](size_t index) const;
+    [[nodiscard]] Value operator[](int index) const {
+        return operator[](static_cast<size_t>(index));
+    }
+
+    /// Object member lookup; nullopt if not an object or the key is missing.
+    [[nodiscard]] std::optional<Value> find(std::string_view key) const;
+    [[nodiscard]] bool contains(std::string_view key) const { return find(key).has_value(); }
+
+    /// Fully parse this subtree into a JsonValue (honors an active ArenaScope).
+    [[nodiscard]] JsonValue to_value() const;
+
+    /// Raw JSON text of this value (from its first byte to its last).
+    [[nodiscard]] std::string_view raw_json() const;
+
+private:
+    friend class Document;
+    friend class Array;
+    friend class Object;
+
+    const Document* doc_ = nullptr;
+    const char* p_ = nullptr;  ///< First byte of the value (whitespace skipped)
+
+    Value(const Document* doc, const char* p) noexcept : doc_(doc), p_(p) {}
+
+    char first() const noexcept { return p_ ? *p_ : 'n'; }
+    JsonValue scalar() const;
+    [[noreturn]] void type_error(const char* expected) const;
+};
+
+// ─── Array / Object ranges ───────────────────────────────────────────────────
+
+/// @brief Forward-iterable view of an on-demand array.
+class Array {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Value;
+
+        iterator() noexcept = default;
+        Value operator*() const noexcept { return Value(doc_, p_); }
+        iterator& operator++();
+        iterator operator++(int) { auto t = *this; ++*this; return t; }
+        bool operator==(const iterator& o) const noexcept { return p_ == o.p_; }
+        bool operator!=(const iterator& o) const noexcept { return p_ != o.p_; }
+
+    private:
+        friend class Array;
+        const Document* doc_ = nullptr;
+        const char* p_ = nullptr;  ///< Current element, or nullptr at end
+        iterator(const Document* d, const char* p) noexcept : doc_(d), p_(p) {}
+    };
+
+    [[nodiscard]] iterator begin() const;
+    [[nodiscard]] iterator end() const noexcept { return {doc_, nullptr}; }
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool empty() const { return begin() == end(); }
+
+private:
+    friend class Value;
+    const Document* doc_;
+    const char* p_;  ///< The '['
+    Array(const Document* d, const char* p) noexcept : doc_(d), p_(p) {}
+};
+
+/// @brief Forward-iterable view of an on-demand object (key/value pairs).
+class Object {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string_view, Value>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        iterator() noexcept = default;
+        value_type operator*() const;
+        iterator& operator++();
+        iterator operator++(int) { auto t = *this; ++*this; return t; }
+        bool operator==(const iterator& o) const noexcept { return p_ == o.p_; }
+        bool operator!=(const iterator& o) const noexcept { return p_ != o.p_; }
+
+    private:
+        friend class Object;
+        const Document* doc_ = nullptr;
+        const char* p_ = nullptr;  ///< Current key, or nullptr at end
+        iterator(const Document* d, const char* p) noexcept : doc_(d), p_(p) {}
+    };
+
+    [[nodiscard]] iterator begin() const;
+    [[nodiscard]] iterator end() const noexcept { return {doc_, nullptr}; }
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool empty() const { return begin() == end(); }
+    [[nodiscard]] std::optional<Value> find(std::string_view key) const;
+
+private:
+    friend class Value;
+    const Document* doc_;
+    const char* p_;  ///< The '{'
+    Object(const Document* d, const char* p) noexcept : doc_(d), p_(p) {}
+};
+
+// ─── Document ────────────────────────────────────────────────────────────────
+
+/// @brief Lazily parsed view over a JSON text.
+///
+/// Construction only locates the root value. The Document is neither
+/// copyable nor movable because Values refer back to it.
+class Document {
+public:
+    /// @throws ParseError if the input contains no value, or with
+    /// ParseOptions::validate_utf8 if it is not well-formed UTF-8.
+    explicit Document(std::string_view input, const ParseOptions& opts = {})
+        : begin_(input.data()), end_(input.data() + input.size()), opts_(opts) {
+        if (opts_.validate_utf8) {
+            const char* bad = detail::simd::validate_utf8(begin_, end_);
+            if (JSON_UNLIKELY(bad != end_)) fail(bad, "invalid UTF-8 encoding", errc::invalid_utf8);
+        }
+        root_ = skip_ws(begin_);
+        if (JSON_UNLIKELY(root_ >= end_)) {
+            fail(root_, "unexpected end of input", errc::unexpected_end_of_input);
+        }
+    }
+
+    Document(const Document&) = delete;
+    Document& operator=(const Document&) = delete;
+
+    [[nodiscard]] Value root() const noexcept { return Value(this, root_); }
+
+    /// Shorthands for root()[...].
+    [[nodiscard]] Value operator[](std::string_view key) const { return root()[key]; }
+    [[nodiscard]] Value operator[](const char* key) const { return root()[key]; }
+    [[nodiscard]] Value operator[](size_t index) const { return root()[index]; }
+    [[nodiscard]] std::optional<Value> find(std::string_view key) const {
+        return root().find(key);
+    }
+
+    [[nodiscard]] std::string_view input() const noexcept {
+        return {begin_, static_cast<size_t>(end_ - begin_)};
+    }
+
+private:
+    friend class Value;
+    friend class Array;
+    friend class Object;
+
+    const char* begin_;
+    const char* end_;
+    ParseOptions opts_;
+    const char* root_ = nullptr;
+    /// Decoded escaped strings/keys by token position: each token is
+    /// decoded at most once however often it is read.
+    mutable std::unordered_map<const char*, std::string> decoded_;
+
+    // ─── Scanning helpers ────────────────────────────────────────────────
+
+    [[noreturn]] JSON_NOINLINE void fail(const char* at, const char* msg, errc code) const {
+        throw ParseError(msg, detail::Parser::location_at(begin_, at), code);
+    }
+
+    /// Skip whitespace (and comments when enabled).
+    const char* skip_ws(const char* p) const {
+        for (;;) {
+            if (p + 16 <= end_) p = detail::simd::skip_whitespace(p, end_);
+            while (p < end_ && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) ++p;
+            if (!opts_.allow_comments || p + 1 >= end_ || *p != '/') return p;
+            if (p[1] == '/') {
+                p += 2;
+                while (p < end_ && *p != '\n') ++p;
+            } else if (p[1] == '*') {
+                p += 2;
+                while (p + 1 < end_ && !(p[0] == '*' && p[1] == '/')) ++p;
+                p = (p + 1 < end_) ? p + 2 : end_;
+            } else {
+                return p;
+            }
+        }
+    }
+
+    /// @p p at the opening quote; returns one past the closing quote.
+    const char* skip_string(const char* p) const {
+        const char quote = *p++;
+        for (;;) {
+            if (quote == '"') {
+                p = detail::simd::find_string_delimiter(p, end_);
+            } else {
+                while (p < end_ && *p != quote && *p != '\\') ++p;
+            }
+            if (JSON_UNLIKELY(p >= end_)) {
+                fail(p, "unterminated string", errc::unterminated_string);
+            }
+            if (*p == quote) return p + 1;
+            p += 2;  // backslash + escaped character
+        }
+    }
+
+    /// Bracket-matching skip over one value; returns one past its last byte.
+    /// Containers are passed 64 bytes at a time by simd::skip_container
+    /// unless comments or single quotes are enabled; strings with the SIMD
+    /// delimiter search. Nothing else is validated here.
+    const char* skip_value(const char* p) const {
+        const char c = *p;
+        if (c == '"' || (c == '\'' && opts_.allow_single_quotes)) return skip_string(p);
+        if ((c == '{' || c == '[') && !opts_.allow_comments && !opts_.allow_single_quotes) {
+            // Byte loop below only to report an unterminated container
+            if (const char* after = detail::simd::skip_container(p, end_)) return after;
+        }
+        if (c != '{' && c != '[') {
+            // Scalar token: runs until a structural character or whitespace
+            while (p < end_) {
+                const char d = *p;
+                if (d == ',' || d == ']' || d == '}' || d == ':' ||
+                    static_cast<unsigned char>(d) <= ' ' ||
+                    (d == '/' && opts_.allow_comments)) {
+                    break;
+                }
+                ++p;
+            }
+            return p;
+        }
+        size_t depth = 0;
+        while (p < end_) {
+            const char d = *p;
+            if (d == '"' || (d == '\'' && opts_.allow_single_quotes)) {
+                p = skip_string(p);
+                continue;
+            }
+            if (d == '{' || d == '[') {
+                ++depth;
+            } else if (d == '}' || d == ']') {
+                if (--depth == 0) return p + 1;
+            } else if (d == '/' && opts_.allow_comments) {
+                const char* q = skip_ws(p);
+                if (q != p) { p = q; continue; }
+            }
+            ++p;
+        }
+        fail(p, c == '{' ? "unterminated object" : "unterminated array",
+             c == '{' ? errc::unterminated_object : errc::unterminated_array);
+    }
+
+    /// After an element/member at @p p: returns the next element position,
+    /// or nullptr when the container closes with @p close.
+    const char* next_item(const char* p, char close) const {
+        p = skip_ws(p);
+        if (JSON_UNLIKELY(p >= end_)) unterminated(p, close);
+        if (*p == ',') {
+            p = skip_ws(p + 1);
+            if (JSON_UNLIKELY(p >= end_)) unterminated(p, close);
+            if (*p == close) {
+                if (opts_.allow_trailing_commas) return nullptr;
+                fail(p, close == '}' ? "expected string key in object" : "unexpected character",
+                     close == '}' ? errc::unterminated_object : errc::unexpected_character);
+            }
+            return p;
+        }
+        if (JSON_LIKELY(*p == close)) return nullptr;
+        fail(p, close == '}' ? "expected ',' or '}' in object" : "expected ',' or ']' in array",
+             errc::unexpected_character);
+    }
+
+    /// First element/member of the container opening at @p p, or nullptr.
+    const char* first_item(const char* p, char close) const {
+        p = skip_ws(p + 1);
+        if (JSON_UNLIKELY(p >= end_)) unterminated(p, close);
+        return *p == close ? nullptr : p;
+    }
+
+    [[noreturn]] void unterminated(const char* p, char close) const {
+        if (close == '}') fail(p, "unterminated object", errc::unterminated_object);
+        fail(p, "unterminated array", errc::unterminated_array);
+    }
+
+    /// Key at @p p; sets @p value to the member value's first byte.
+    /// With @p decode == false the key is only skipped (returns empty).
+    std::string_view read_key(const char* p, const char*& value, bool decode = true) const {
+        std::string_view key;
+        const char* after;
+        if (*p == '"' || (*p == '\'' && opts_.allow_single_quotes)) {
+            after = skip_string(p);
+            if (decode) key = decode_string(p, after);
+        } else if (opts_.allow_unquoted_keys &&
+                   ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') || *p == '_' || *p == '$')) {
+            after = p;
+            while (after < end_ && ((*after >= 'a' && *after <= 'z') || (*after >= 'A' && *after <= 'Z') ||
+                                    (*after >= '0' && *after <= '9') || *after == '_' || *after == '$')) {
+                ++after;
+            }
+            key = std::string_view(p, static_cast<size_t>(after - p));
+        } else {
+            fail(p, "expected string key in object", errc::unterminated_object);
+        }
+        const char* colon = skip_ws(after);
+        if (JSON_UNLIKELY(colon >= end_ || *colon != ':')) {
+            if (colon >= end_) fail(colon, "unexpected end of input", errc::unexpected_end_of_input);
+            fail(colon, "expected ':'", errc::unexpected_character);
+        }
+        value = skip_ws(colon + 1);
+        if (JSON_UNLIKELY(value >= end_)) {
+            fail(value, "unexpected end of input", errc::unexpected_end_of_input);
+        }
+        return key;
+    }
+
+    /// Content of the string token [p, after). Clean double-quoted strings
+    /// are returned in place; everything else goes through the parser.
+    std::string_view decode_string(const char* p, const char* after) const {
+        if (*p == '"') {
+            const char* q = detail::simd::find_string_delimiter(p + 1, after);
+            if (q == after - 1) {
+                // No escapes: validate control characters like the parser does
+                if (!opts_.allow_control_chars) {
+                    const char* bad = detail::simd::find_needs_escape<false>(p + 1, q);
+                    if (bad < q && static_cast<unsigned char>(*bad) < 0x20) {
+                        fail(bad, "unescaped control character in string", errc::invalid_escape);
+                    }
+                }
+                return {p + 1, static_cast<size_t>(q - p - 1)};
+            }
+        }
+        auto it = decoded_.find(p);
+        if (it == decoded_.end()) {
+            const JsonValue v = detail::Parser::parse_subrange(begin_, p, after, opts_);
+            it = decoded_.emplace(p, v.as_string_view()).first;
+        }
+        return it->second;
+    }
+
+    /// With allow_duplicate_keys = false: throw on the first repeated key
+    /// of the object opening at @p p.
+    void check_unique_keys(const char* p) const {
+        if (opts_.allow_duplicate_keys) return;
+        std::unordered_set<std::string_view> seen;
+        for (p = first_item(p, '}'); p != nullptr;) {
+            const char* value = nullptr;
+            const std::string_view key = read_key(p, value);
+            if (JSON_UNLIKELY(!seen.insert(key).second)) {
+                fail(p, ("duplicate key: \"" + std::string(key) + "\"").c_str(),
+                     errc::duplicate_key);
+            }
+            p = next_item(skip_value(value), '}');
+        }
+    }
+};
+
+// ─── Value members ───────────────────────────────────────────────────────────
+
+inline JsonValue Value::scalar() const {
+    return detail::Parser::parse_subrange(doc_->begin_, p_, doc_->skip_value(p_), doc_->opts_);
+}
+
+inline void Value::type_error(const char* expected) const {
+    throw TypeError(std::string("expected ") + expected + ", got " +
+                    std::string(type_name(type())));
+}
+
+inline Type Value::type() const {
+    switch (first()) {
+        case 'n': return Type::Null;
+        case 't': case 'f': return Type::Bool;
+        case '"': return Type::String;
+        case '[': return Type::Array;
+        case '{': return Type::Object;
+        case '\'': if (doc_->opts_.allow_single_quotes) return Type::String; break;
+        default: break;
+    }
+    return scalar().type();
+}
+
+inline std::string_view Value::as_string_view() const {
+    if (JSON_UNLIKELY(!is_string() || (first() == '\'' && !doc_->opts_.allow_single_quotes))) {
+        type_error("string");
+    }
+    return doc_->decode_string(p_, doc_->skip_string(p_));
+}
+
+inline std::string_view Value::raw_json() const {
+    if (!p_) return "null";
+    return {p_, static_cast<size_t>(doc_->skip_value(p_) - p_)};
+}
+
+inline JsonValue Value::to_value() const {
+    if (!p_) return JsonValue(nullptr);
+    return detail::Parser::parse_subrange(doc_->begin_, p_, doc_->skip_value(p_), doc_->opts_);
+}
+
+inline Array Value::as_array() const {
+    if (JSON_UNLIKELY(!is_array())) type_error("array");
+    return Array(doc_, p_);
+}
+
+inline Object Value::as_object() const {
+    if (JSON_UNLIKELY(!is_object())) type_error("object");
+    return Object(doc_, p_);
+}
+
+inline size_t Value::size() const {
+    if (is_array()) return as_array().size();
+    if (is_object()) return as_object().size();
+    return 0;
+}
+
+inline std::optional<Value> Value::find(std::string_view key) const {
+    if (!is_object()) return std::nullopt;
+    return Object(doc_, p_).find(key);
+}
+
+inline Value Value::operator[](std::string_view key) const {
+    if (JSON_UNLIKELY(!is_object())) type_error("object");
+    auto v = Object(doc_, p_).find(key);
+    if (JSON_UNLIKELY(!v)) throw OutOfRangeError("key not found: \"" + std::string(key) + "\"");
+    return *v;
+}
+
+inline Value Value::operator[](size_t index) const {
+    const Array arr = as_array();
+    size_t n = 0;
+    for (Value v : arr) {
+        if (n++ == index) return v;
+    }
+    throw OutOfRangeError("array index " + std::to_string(index) +
+                          " out of range (size=" + std::to_string(n) + ")");
+}
+
+// ─── Array / Object members ──────────────────────────────────────────────────
+
+inline Array::iterator Array::begin() const {
+    return {doc_, doc_->first_item(p_, ']')};
+}
+
+inline Array::iterator& Array::iterator::operator++() {
+    p_ = doc_->next_item(doc_->skip_value(p_), ']');
+    return *this;
+}
+
+inline size_t Array::size() const {
+    size_t n = 0;
+    for (auto it = begin(); it != end(); ++it) ++n;
+    return n;
+}
+
+inline Object::iterator Object::begin() const {
+    doc_->check_unique_keys(p_);
+    return {doc_, doc_->first_item(p_, '}')};
+}
+
+inline Object::iterator::value_type Object::iterator::operator*() const {
+    const char* value = nullptr;
+    std::string_view key = doc_->read_key(p_, value);
+    return {key, Value(doc_, value)};
+}
+
+inline Object::iterator& Object::iterator::operator++() {
+    const char* value = nullptr;
+    (void)doc_->read_key(p_, value, false);
+    p_ = doc_->next_item(doc_->skip_value(value), '}');
+    return *this;
+}
+
+inline size_t Object::size() const {
+    size_t n = 0;
+    for (auto it = begin(); it != end(); ++it) ++n;
+    return n;
+}
+
+inline std::optional<Value> Object::find(std::string_view key) const {
+    doc_->check_unique_keys(p_);
+    for (const char* p = doc_->first_item(p_, '}'); p != nullptr;) {
+        const char* value = nullptr;
+        if (doc_->read_key(p, value) == key) return Value(doc_, value);
+        p = doc_->next_item(doc_->skip_value(value), '}');
+    }
+    return std::nullopt;
+}
+
+} // namespace yajson::ondemand
@@ -0,0 +1,124 @@
+#pragma once
+
+/// @file padded_string.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Inputs with readable padding past the end, and parse_padded().
+///
+/// A padded input is followed by YAJSON_PADDING readable bytes, the first of
+/// which is NUL. The parser then uses the NUL as a sentinel: digit,
+/// whitespace and literal scans run without per-byte bounds checks, and the
+/// SIMD searches use full-width loads up to the end (no scalar tails).
+///
+/// @code
+///   yajson::PaddedString buf(payload);            // copy + zeroed padding
+///   auto v = yajson::parse_padded(buf);
+///
+///   yajson::PaddedString rx(4096);                // read directly into it
+///   rx.shrink(::read(fd, rx.data(), rx.size()));
+///   auto w = yajson::parse_padded(rx);
+/// @endcode
+///
+/// Results and errors are identical to parse(). parse_file() pads the file
+/// mapping the same way.
+
+#include "config.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+namespace yajson {
+
+/// @brief Owning buffer of size() bytes followed by YAJSON_PADDING zero bytes.
+class PaddedString {
+public:
+    PaddedString() : PaddedString(size_t{0}) {}
+
+    /// @brief Zero-filled buffer of @p size bytes (e.g. to read into).
+    explicit PaddedString(size_t size)
+        : data_(new char[size + YAJSON_PADDING]()), size_(size) {}
+
+    /// @brief Copy of @p s.
+    explicit PaddedString(std::string_view s) : PaddedString(s.size()) {
+        if (!s.empty()) std::memcpy(data_.get(), s.data(), s.size());
+    }
+
+    PaddedString(const PaddedString& o) : PaddedString(o.view()) {}
+    PaddedString& operator=(const PaddedString& o) {
+        if (this != &o) *this = PaddedString(o);
+        return *this;
+    }
+    PaddedString(PaddedString&&) noexcept = default;
+    PaddedString& operator=(PaddedString&&) noexcept = default;
+
+    [[nodiscard]] char* data() noexcept { return data_.get(); }
+    [[nodiscard]] const char* data() const noexcept { return data_.get(); }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    /// Readable bytes at data(): size() + YAJSON_PADDING.
+    [[nodiscard]] size_t capacity() const noexcept { return size_ + YAJSON_PADDING; }
+
+    [[nodiscard]] std::string_view view() const noexcept { return {data_.get(), size_}; }
+
+    /// @brief Shrink the logical size (e.g. after a short read); the bytes
+    /// from @p size on are zeroed so the padding invariant holds.
+    void shrink(size_t size) noexcept {
+        if (size >= size_) return;
+        std::memset(data_.get() + size, 0, size_ - size);
+        size_ = size;
+    }
+
+private:
+    std::unique_ptr<char[]> data_;
+    size_t size_;
+};
+
+/// @brief Non-owning view of a padded input.
+///
+/// The view is padded when at least YAJSON_PADDING bytes after it are
+/// readable and the first of them is NUL; parse_padded() checks this and
+/// falls back to the bounds-checked parser otherwise.
+class PaddedStringView {
+public:
+    /// @param capacity Readable bytes at @p data (size + padding).
+    PaddedStringView(const char* data, size_t size, size_t capacity) noexcept
+        : data_(data), size_(size), capacity_(capacity) {}
+
+    PaddedStringView(const PaddedString& s) noexcept
+        : data_(s.data()), size_(s.size()), capacity_(s.capacity()) {}
+
+    [[nodiscard]] const char* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] std::string_view view() const noexcept { return {data_, size_}; }
+
+    /// True if the parser may use the sentinel fast paths on this input.
+    [[nodiscard]] bool is_padded() const noexcept {
+        return capacity_ >= size_ + YAJSON_PADDING && data_[size_] == '\0';
+    }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t capacity_;
+};
+
+/// @brief Parse a padded input (see PaddedStringView).
+/// @throws ParseError on invalid JSON (same errors as parse()).
+[[nodiscard]] inline JsonValue parse_padded(PaddedStringView input,
+                                            const ParseOptions& opts = {}) {
+    if (JSON_LIKELY(input.is_padded())) return detail::Parser::parse_padded(input.view(), opts);
+    return detail::Parser::parse(input.view(), opts);
+}
+
+/// @brief Parse a padded input (no exceptions).
+[[nodiscard]] inline result<JsonValue> try_parse_padded(PaddedStringView input,
+                                                        const ParseOptions& opts = {}) noexcept {
+    if (JSON_LIKELY(input.is_padded())) return detail::Parser::try_parse_padded(input.view(), opts);
+    return detail::Parser::try_parse(input.view(), opts);
+}
+
+} // namespace yajson
@@ -0,0 +1,299 @@
+#pragma once
+
+/// @file parallel.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Multi-threaded parsing of documents whose root is a large array.
+///
+/// @code
+///   auto v = yajson::parse_parallel(input);          // all hardware threads
+///
+///   yajson::ParallelDocument doc;                      // per-thread arenas
+///   doc.parse(input, 8);
+///   for (const auto& rec : doc.root().as_array()) ...
+/// @endcode
+///
+/// Algorithm:
+///   1. The input is cut into one byte slice per thread. Each thread scans
+///      its slice with the stage-1 block scanner (see detail/structural.hpp)
+///      under both hypotheses for the unknown string state at its start,
+///      recording the net bracket depth change for each.
+///   2. A serial pass over the per-slice summaries resolves the exact string
+///      state and depth at every slice start.
+///   3. Each thread finds the first root-level comma at or after its slice
+///      start and the next slice's start, and parses the elements between
+///      them with the regular parser (into its own arena, for
+///      ParallelDocument).
+///   4. The element lists are moved into the root array — element subtrees
+///      are never copied.
+///
+/// Inputs that are small, not arrays, or parsed with options that make
+/// quote-aware splitting unsafe (comments, single-quoted strings) use the
+/// serial parser. If any chunk fails to parse, the whole input is re-parsed
+/// serially, so errors are reported exactly as parse() reports them.
+
+#include "arena.hpp"
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+#include "detail/structural.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace yajson {
+
+namespace detail {
+
+/// Smallest slice worth a thread of its own.
+inline constexpr size_t kParallelMinSlice = 256 * 1024;
+
+/// Stage-1 summary of one input slice.
+struct SliceSummary {
+    size_t begin = 0;          ///< Slice start (never preceded by a backslash)
+    long long delta_out = 0;   ///< Depth change if the slice starts outside a string
+    long long delta_in = 0;    ///< Depth change if the slice starts inside a string
+    bool quote_parity = false; ///< Odd number of unescaped quotes in the slice
+    bool start_in_string = false;  ///< Resolved in pass 2
+    long long start_depth = 0;     ///< Resolved in pass 2
+};
+
+/// Pass 1: bracket balance of [begin, end) under both string-state hypotheses.
+inline void summarize_slice(const char* begin, const char* end, SliceSummary& out) noexcept {
+    simd::BlockScanner scanner;  // hypothesis: outside a string at begin
+    long long out_open = 0, out_close = 0, in_open = 0, in_close = 0;
+    uint64_t quotes = 0;
+    alignas(64) char tail[64];
+    for (const char* p = begin; p < end; p += 64) {
+        const char* block = p;
+        if (end - p < 64) {
+            std::memset(tail, ' ', sizeof(tail));
+            std::memcpy(tail, p, static_cast<size_t>(end - p));
+            block = tail;
+        }
+        const simd::BlockScan s = scanner.next(block);
+        const simd::BracketMasks b = simd::classify_brackets(block);
+        // Starting inside a string flips every in_string bit; brackets are
+        // never quotes, so the flipped "outside" is simply in_string.
+        out_open += simd::popcount64(b.open & ~s.in_string);
+        out_close += simd::popcount64(b.close & ~s.in_string);
+        in_open += simd::popcount64(b.open & s.in_string);
+        in_close += simd::popcount64(b.close & s.in_string);
+        quotes += static_cast<uint64_t>(simd::popcount64(s.quote));
+    }
+    out.delta_out = out_open - out_close;
+    out.delta_in = in_open - in_close;
+    out.quote_parity = (quotes & 1) != 0;
+}
+
+/// Pass 3: first comma at root-array depth (1) at or after @p p, given the
+/// exact state at @p p. Returns nullptr if the root array closes first.
+inline const char* find_root_comma(const char* p, const char* end, bool in_string,
+                                   long long depth) noexcept {
+    while (p < end) {
+        if (in_string) {
+            p = simd::find_string_delimiter(p, end);
+            if (p >= end) return nullptr;
+            if (*p == '\\') {
+                p += 2;
+                continue;
+            }
+            in_string = false;
+            ++p;
+            continue;
+        }
+        const char c = *p++;
+        if (c == '"') {
+            in_string = true;
+        } else if (c == '[' || c == '{') {
+            ++depth;
+        } else if (c == ']' || c == '}') {
+            if (--depth <= 0) return nullptr;
+        } else if (c == ',' && depth == 1) {
+            return p - 1;
+        }
+    }
+    return nullptr;
+}
+
+/// Runs fn(i) for i in [0, n) on n threads (the calling thread takes i = 0).
+template <typename Fn>
+void run_threads(size_t n, Fn&& fn) {
+    std::vector<std::thread> threads;
+    threads.reserve(n - 1);
+    for (size_t i = 1; i < n; ++i) threads.emplace_back([&fn, i] { fn(i); });
+    fn(0);
+    for (auto& t : threads) t.join();
+}
+
+/// @brief Parse @p input with up to @p n_threads threads.
+///
+/// @param arenas Either empty (heap allocation) or one arena per thread;
+///               arenas[0] also receives the serial fallback's allocations.
+/// @param min_slice Smallest slice per thread (tests use small values).
+inline JsonValue parse_parallel_impl(std::string_view input, size_t n_threads,
+                                     const ParseOptions& opts,
+                                     const std::vector<MonotonicArena*>& arenas,
+                                     size_t min_slice = kParallelMinSlice) {
+    auto serial = [&] {
+        if (arenas.empty()) return Parser::parse(input, opts);
+        ArenaScope scope(*arenas[0]);
+        return Parser::parse(input, opts);
+    };
+
+    const char* const doc = input.data();
+    const char* const end = doc + input.size();
+    const char* open = simd::skip_whitespace(doc, end);
+
+    if (min_slice == 0) min_slice = 1;
+    n_threads = std::min(n_threads, input.size() / min_slice);
+    if (!arenas.empty()) n_threads = std::min(n_threads, arenas.size());
+    if (n_threads < 2 || open >= end || *open != '[' ||
+        opts.allow_comments || opts.allow_single_quotes) {
+        return serial();
+    }
+    // ParseOptions::validate_utf8: checked once here rather than per chunk;
+    // the serial parser reports the error
+    if (opts.validate_utf8 && simd::validate_utf8(doc, end) != end) return serial();
+
+    // Pass 1: slice summaries, in parallel
+    std::vector<SliceSummary> slices(n_threads);
+    const size_t step = input.size() / n_threads;
+    for (size_t i = 1; i < n_threads; ++i) {
+        size_t b = i * step;
+        while (b < input.size() && doc[b - 1] == '\\') ++b;  // never split an escape
+        slices[i].begin = std::max(b, slices[i - 1].begin);
+    }
+    run_threads(n_threads, [&](size_t i) {
+        const size_t e = i + 1 < n_threads ? slices[i + 1].begin : input.size();
+        summarize_slice(doc + slices[i].begin, doc + e, slices[i]);
+    });
+
+    // Pass 2: exact state at each slice start
+    for (size_t i = 1; i < n_threads; ++i) {
+        const SliceSummary& prev = slices[i - 1];
+        slices[i].start_in_string = prev.start_in_string != prev.quote_parity;
+        slices[i].start_depth = prev.start_depth +
+                                (prev.start_in_string ? prev.delta_in : prev.delta_out);
+    }
+
+    // Pass 3 + parse: chunk i runs from the first root comma at/after slice
+    // i's start to the first root comma at/after slice i+1's start.
+    auto split_at = [&](size_t i) -> const char* {
+        if (i == 0) return open;  // chunk 0 starts after the '['
+        if (i >= n_threads) return nullptr;
+        const SliceSummary& s = slices[i];
+        return find_root_comma(doc + s.begin, end, s.start_in_string, s.start_depth);
+    };
+
+    std::vector<Array> parts;
+    parts.reserve(n_threads);
+    for (size_t i = 0; i < n_threads; ++i) {
+        parts.emplace_back(arenas.empty()
+                               ? std::pmr::new_delete_resource()
+                               : static_cast<std::pmr::memory_resource*>(arenas[i]));
+    }
+    std::atomic<bool> failed{false};
+    run_threads(n_threads, [&](size_t i) {
+        const char* first = split_at(i);
+        if (!first) return;
+        const char* last = split_at(i + 1);
+        if (last == first) return;  // no root comma inside this slice
+        try {
+            std::unique_ptr<ArenaScope> scope;
+            if (!arenas.empty()) scope = std::make_unique<ArenaScope>(*arenas[i]);
+            Parser::parse_array_chunk(doc, first + 1, last ? last : end, last == nullptr,
+                                      i > 0, opts, parts[i]);
+        } catch (...) {
+            failed.store(true, std::memory_order_relaxed);
+        }
+    });
+    if (failed.load(std::memory_order_relaxed)) {
+        parts.clear();
+        return serial();
+    }
+
+    // Stitch: move (not copy) each element into the root array
+    size_t total = 0;
+    for (const auto& part : parts) total += part.size();
+    Array root(std::pmr::new_delete_resource());
+    root.reserve(total);
+    for (auto& part : parts) {
+        for (auto& v : part) root.push_back(std::move(v));
+    }
+    return JsonValue(std::move(root), nullptr);
+}
+
+} // namespace detail
+
+/// @brief Parse JSON whose root is a large array using multiple threads.
+///
+/// @param n_threads Thread count (0 = std::thread::hardware_concurrency()).
+///        Fewer threads are used for small inputs; other documents are
+///        parsed serially. The result is heap-allocated and equal to parse().
+/// @throws ParseError on invalid JSON (same error as parse()).
+[[nodiscard]] inline JsonValue parse_parallel(std::string_view input, size_t n_threads = 0,
+                                              const ParseOptions& opts = {}) {
+    if (n_threads == 0) n_threads = std::max(1u, std::thread::hardware_concurrency());
+    return detail::parse_parallel_impl(input, n_threads, opts, {});
+}
+
+/// @brief Parallel parse into per-thread arenas owned by the document.
+///
+/// Each worker allocates its elements from its own MonotonicArena, so
+/// threads never contend on the allocator. The root array itself is
+/// heap-allocated and points at the arena-resident elements. The root is
+/// valid until reset(), the next parse() or destruction.
+class ParallelDocument {
+public:
+    ParallelDocument() = default;
+    ~ParallelDocument() { reset(); }
+
+    ParallelDocument(const ParallelDocument&) = delete;
+    ParallelDocument& operator=(const ParallelDocument&) = delete;
+
+    /// @brief Parse @p input (see parse_parallel); root() is updated.
+    /// @throws ParseError on invalid JSON.
+    void parse(std::string_view input, size_t n_threads = 0, const ParseOptions& opts = {}) {
+        if (n_threads == 0) n_threads = std::max(1u, std::thread::hardware_concurrency());
+        reset();
+        const size_t per_thread = input.size() / n_threads + 4096;
+        while (arenas_.size() < n_threads) {
+            arenas_.push_back(std::make_unique<MonotonicArena>(per_thread));
+        }
+        std::vector<MonotonicArena*> arenas;
+        arenas.reserve(n_threads);
+        for (size_t i = 0; i < n_threads; ++i) arenas.push_back(arenas_[i].get());
+        root_ = detail::parse_parallel_impl(input, n_threads, opts, arenas);
+    }
+
+    [[nodiscard]] JsonValue& root() noexcept { return root_; }
+    [[nodiscard]] const JsonValue& root() const noexcept { return root_; }
+
+    /// @brief Release the root and rewind the arenas (kept for reuse).
+    void reset() noexcept {
+        root_ = JsonValue();
+        for (auto& a : arenas_) a->reset();
+    }
+
+    /// @brief Total bytes held by the per-thread arenas.
+    [[nodiscard]] size_t bytes_allocated() const noexcept {
+        size_t n = 0;
+        for (const auto& a : arenas_) n += a->bytes_allocated();
+        return n;
+    }
+
+private:
+    std::vector<std::unique_ptr<MonotonicArena>> arenas_;
+    JsonValue root_;
+};
+
+} // namespace yajson
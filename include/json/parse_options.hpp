@@ -14,9 +14,16 @@
 ///   - Control characters in strings
 
 #include <cstddef>
+#include <cstdint>
 
 namespace yajson {
 
+/// @brief How the parser stores numbers (ParseOptions::number_mode).
+enum class NumberMode : uint8_t {
+    convert,  ///< Integer / UInteger / Float, converted while parsing
+    raw       ///< Type::RawNumber: the original token, converted on access
+};
+
 /// @brief Parser configuration for standard and non-standard JSON.
 struct ParseOptions {
     // ─── Non-standard extensions (all disabled by default) ──────────────
@@ -45,11 +52,83 @@ struct ParseOptions {
     /// Allow duplicate keys in objects (last value wins)
     bool allow_duplicate_keys   = true;
 
+    // ─── Validation ──────────────────────────────────────────────────────
+
+    /// Reject input that is not well-formed UTF-8 (errc::invalid_utf8 at the
+    /// first bad byte). The whole input is checked in one SIMD pass before
+    /// parsing, so this error takes precedence over syntax errors. Without
+    /// it, bytes >= 0x80 are passed through unchecked.
+    bool validate_utf8          = false;
+
     // ─── Limits ──────────────────────────────────────────────────────────
 
     /// Maximum nesting depth (0 = use the value from config.hpp)
     size_t max_depth = 0;
 
+    /// Parse with an explicit frame stack instead of recursion. Nesting no
+    /// longer consumes native stack while parsing, so max_depth can be raised
+    /// far beyond YAJSON_MAX_DEPTH. Destroying, copying, comparing and
+    /// serializing a value recurse at most YAJSON_MAX_DEPTH levels and
+    /// continue from an explicit work list below that, so they are safe at
+    /// any depth the parser accepts.
+    bool iterative = false;
+
+    // ─── Performance ─────────────────────────────────────────────────────
+
+    /// Run a stage-1 SIMD pass that indexes structural characters before
+    /// parsing (see detail/structural.hpp). Pays off on medium and large
+    /// documents with many strings or indentation. Ignored when comments
+    /// or single-quoted strings are enabled.
+    bool structural_index = false;
+
+    /// Make string values that need no unescaping views into the input
+    /// instead of copies (strings up to the SSO size are still stored
+    /// inline). The input must outlive the parsed value and everything moved
+    /// out of it; copying a value copies its strings. Object keys are always
+    /// copied. Ignored where the parser reads into a buffer that dies with
+    /// the call (istream parse, parse_file); see FileDocument for a file.
+    bool borrow_strings = false;
+
+    /// With borrow_strings: an escaped string value longer than the SSO size
+    /// keeps referencing its raw bytes in the input until it is decoded.
+    /// Escapes are still validated while parsing. Only the non-const
+    /// as_string_view() and get_or<std::string_view>() decode in place
+    /// (into the arena that was active while parsing, or the heap), so
+    /// const access never modifies a value and concurrent const readers are
+    /// safe. A lazy string not yet decoded (JsonValue::is_lazy_string()) is
+    /// decoded into a temporary by as_string(), comparison, copy and
+    /// ensure_ascii serialization; the const as_string_view() and
+    /// get_or<std::string_view>() throw TypeError. Serializing it
+    /// otherwise writes its original escaped bytes. Ignored when
+    /// single-quoted strings or control characters are allowed.
+    bool lazy_unescape = false;
+
+    /// NumberMode::raw: store decimal numbers as Type::RawNumber holding the
+    /// token text (inline when it fits the SSO buffer, else a view with
+    /// borrow_strings or a copy). The grammar is still validated, but no
+    /// value is computed: as_integer(), as_uinteger(), as_float() and
+    /// get_or() convert on every call, and serializing writes the original
+    /// text. Precision is never lost in a round-trip. A number outside the
+    /// double range is rejected with errc::invalid_number, as in convert
+    /// mode, so conversion on access never overflows. Hex numbers, NaN and Infinity are still converted. SAX handlers and
+    /// tapes receive converted numbers.
+    NumberMode number_mode = NumberMode::convert;
+
+    /// Store arrays whose elements are all integers (int64 range) or all
+    /// floats as a contiguous int64_t[] / double[] (JsonValue::is_packed(),
+    /// as_int64_span(), as_double_span()). The kind is guessed from the
+    /// first element; an element that does not fit turns the array back
+    /// into a regular one. type() is still Array. size(), element(),
+    /// comparison, copy and serialization work on the packed form directly.
+    /// Const as_array(), operator[] and JsonPointer read the same elements
+    /// as for a regular array, from a regular Array built on first use and
+    /// kept with the value (thread-safe; the packed form is unchanged).
+    /// Non-const access that needs a mutable Array (as_array(), operator[],
+    /// push_back(), unpack()) expands it in place. The iterative core packs
+    /// an array once it is complete, so it briefly holds the regular form.
+    /// Ignored with NumberMode::raw.
+    bool packed_arrays = false;
+
     // ─── Factory methods ─────────────────────────────────────────────────
 
     /// Strict JSON (RFC 8259) — all extensions disabled.
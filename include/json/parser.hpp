@@ -6,20 +6,28 @@
 ///
 /// Features:
 ///   - SIMD-accelerated whitespace skipping and string scanning
+///   - Optional two-stage mode: a SIMD structural index (stage 1) lets the
+///     recursive descent (stage 2) jump over whitespace and clean strings
 ///   - Inline integer accumulation (no from_chars on the hot path)
+///   - Correctly rounded floats via Eisel-Lemire (detail/fast_float.hpp)
 ///   - Branch prediction hints for hot paths
 ///   - Non-standard JSON extensions (comments, trailing commas, etc.)
 ///   - Exception-free parsing via try_parse() with error_code
 ///   - Recursion depth limiting to protect against stack overflow
+///   - Optional iterative core (explicit frame stack) for very deep input
+///   - Compile-time specialization for the strict/lenient/json5 presets
 ///   - Full UTF-8 support, including surrogate pairs
 
 #include "config.hpp"
+#include "detail/fast_float.hpp"
 #include "detail/simd.hpp"
+#include "detail/structural.hpp"
 #include "detail/utf8.hpp"
 #include "error.hpp"
 #include "parse_options.hpp"
 #include "value.hpp"
 
+#include <algorithm>
 #include <charconv>
 #include <climits>
 #include <cmath>
@@ -31,26 +39,285 @@
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 namespace yajson {
 namespace detail {
 
-/// @brief High-performance recursive JSON parser.
-class Parser {
+// ─── Compile-time policies ───────────────────────────────────────────────────
+//
+// A parser policy fixes the extension flags of ParseOptions at compile time,
+// so BasicParser<StrictPolicy> has no comment, single-quote, NaN/Infinity,
+// hex-number or control-character branches in its inner loops. Limits and
+// mode switches (max_depth, structural_index, iterative) stay runtime.
+//
+// PaddedInput<P> additionally lets the parser read past the end: the input
+// is followed by YAJSON_PADDING readable bytes, the first of them NUL.
+
+/// Extension flags read from ParseOptions at run time (any combination).
+struct DynamicPolicy {
+    static constexpr bool kDynamic = true;
+    static constexpr bool kPadded = false;
+    static constexpr ParseOptions kOptions{};
+};
+
+/// ParseOptions::strict(): RFC 8259.
+struct StrictPolicy {
+    static constexpr bool kDynamic = false;
+    static constexpr bool kPadded = false;
+    static constexpr ParseOptions kOptions = ParseOptions::strict();
+};
+
+/// ParseOptions::lenient().
+struct LenientPolicy {
+    static constexpr bool kDynamic = false;
+    static constexpr bool kPadded = false;
+    static constexpr ParseOptions kOptions = ParseOptions::lenient();
+};
+
+/// ParseOptions::json5().
+struct Json5Policy {
+    static constexpr bool kDynamic = false;
+    static constexpr bool kPadded = false;
+    static constexpr ParseOptions kOptions = ParseOptions::json5();
+};
+
+/// @p Policy on a padded input (see parse_padded): the NUL at end_ ends every
+/// token scan, so digit, whitespace and literal loops need no bounds checks
+/// and SIMD searches never take their scalar tails.
+template <typename Policy>
+struct PaddedInput : Policy {
+    static constexpr bool kPadded = true;
+};
+
+/// @brief True if @p a and @p b enable the same grammar extensions.
+constexpr bool same_extensions(const ParseOptions& a, const ParseOptions& b) noexcept {
+    return a.allow_comments == b.allow_comments &&
+           a.allow_trailing_commas == b.allow_trailing_commas &&
+           a.allow_single_quotes == b.allow_single_quotes &&
+           a.allow_unquoted_keys == b.allow_unquoted_keys &&
+           a.allow_nan_inf == b.allow_nan_inf &&
+           a.allow_hex_numbers == b.allow_hex_numbers &&
+           a.allow_control_chars == b.allow_control_chars &&
+           a.allow_duplicate_keys == b.allow_duplicate_keys;
+}
+
+/// @brief Call fn(Policy{}) with the policy matching @p opts' extensions.
+template <typename Fn>
+decltype(auto) with_parser_policy(const ParseOptions& opts, Fn&& fn) {
+    if (JSON_LIKELY(same_extensions(opts, StrictPolicy::kOptions))) return fn(StrictPolicy{});
+    if (same_extensions(opts, LenientPolicy::kOptions)) return fn(LenientPolicy{});
+    if (same_extensions(opts, Json5Policy::kOptions)) return fn(Json5Policy{});
+    return fn(DynamicPolicy{});
+}
+
+/// @brief @p opts for an input buffer owned by the caller of the parser,
+/// which dies before the result: strings must be copied out of it.
+constexpr ParseOptions copying_strings(ParseOptions opts) noexcept {
+    opts.borrow_strings = false;
+    return opts;
+}
+
+/// @brief Policy-independent parser helpers.
+class ParserBase {
+public:
+    /// @brief Line/column/offset of @p pos within the text starting at @p begin.
+    [[nodiscard]] static SourceLocation location_at(const char* begin,
+                                                    const char* pos) noexcept {
+        SourceLocation loc;
+        loc.offset = static_cast<size_t>(pos - begin);
+        for (const char* p = begin; p < pos; ++p) {
+            if (*p == '\n') { ++loc.line; loc.column = 1; }
+            else { ++loc.column; }
+        }
+        return loc;
+    }
+
+    /// @brief Translate @p rel, a location inside a text fragment that starts
+    /// at @p origin, into a location in the enclosing text.
+    [[nodiscard]] static SourceLocation shift_location(const SourceLocation& origin,
+                                                       const SourceLocation& rel) noexcept {
+        SourceLocation loc;
+        loc.offset = origin.offset + rel.offset;
+        loc.line = origin.line + rel.line - 1;
+        loc.column = rel.line == 1 ? origin.column + rel.column - 1 : rel.column;
+        return loc;
+    }
+
+    /// @brief Move @p loc past the text [first, last).
+    static void advance_location(SourceLocation& loc, const char* first,
+                                 const char* last) noexcept {
+        loc.offset += static_cast<size_t>(last - first);
+        const char* line_start = nullptr;
+        for (const char* p = first; p < last;) {
+            const void* nl = std::memchr(p, '\n', static_cast<size_t>(last - p));
+            if (!nl) break;
+            ++loc.line;
+            p = static_cast<const char*>(nl) + 1;
+            line_start = p;
+        }
+        if (line_start) loc.column = 1 + static_cast<size_t>(last - line_start);
+        else loc.column += static_cast<size_t>(last - first);
+    }
+
+    /// @brief Finalize a parsed object: build hash index and dedup if needed.
+    ///
+    /// Called once after the closing '}' instead of per-entry insert(); also
+    /// used by TapeValue::to_value() and IncrementalParser, so all of them
+    /// agree on duplicate keys.
+    /// For large objects (>= kIndexThreshold): builds the hash index in a
+    /// single pass. The index naturally maps to the last occurrence of each
+    /// key, providing "last-value-wins" semantics.
+    /// If duplicates exist (index_.size() < entries.size()), compacts the
+    /// entries vector to remove earlier duplicates.
+    ///
+    /// For small objects (< kIndexThreshold): does a lightweight O(n²)
+    /// reverse-dedup (n < 16, at most ~120 comparisons).
+    static void finalize_object(Object& obj) {
+        auto& entries = obj.entries;
+        const size_t n = entries.size();
+
+        if (n >= Object::kIndexThreshold) {
+            // Build hash index (single pass). (*index_)[key] = i iterates
+            // forward, so the last index for each key wins.
+            obj.rebuild_index();
+
+            // Check for duplicates: index has fewer entries than the vector.
+            if (obj.index_->size() < n) {
+                // Compact: keep only the positions the index maps to. They
+                // are collected first: moving an entry invalidates the index
+                // views of its key.
+                std::vector<size_t> keep;
+                keep.reserve(obj.index_->size());
+                for (const auto& kv : *obj.index_) keep.push_back(kv.second);
+                std::sort(keep.begin(), keep.end());
+                size_t write = 0;
+                for (const size_t i : keep) {
+                    if (write != i) entries[write] = std::move(entries[i]);
+                    ++write;
+                }
+                entries.resize(write);
+                // Re-index after compaction (indices changed).
+                obj.rebuild_index();
+            }
+        } else if (n >= 2) {
+            // Small object: O(n²) dedup, last-value-wins (n < 16).
+            // For the common case (no duplicates): inner loop finds no matches.
+            for (size_t i = 0; i < entries.size(); ) {
+                bool has_later_dup = false;
+                for (size_t j = i + 1; j < entries.size(); ++j) {
+                    if (entries[i].first == entries[j].first) {
+                        has_later_dup = true;
+                        break;
+                    }
+                }
+                if (JSON_UNLIKELY(has_later_dup)) {
+                    entries.erase(entries.begin() + static_cast<ptrdiff_t>(i));
+                } else {
+                    ++i;
+                }
+            }
+        }
+    }
+};
+
+/// @brief Event handler of yajson::validate(): nothing consumes the events,
+/// so BasicParser::walk_value() checks strings without decoding them.
+struct ValidateHandler {
+    void on_null() noexcept {}
+    void on_bool(bool) noexcept {}
+    void on_int64(int64_t) noexcept {}
+    void on_uint64(uint64_t) noexcept {}
+    void on_double(double) noexcept {}
+    void on_string(std::string_view) noexcept {}
+    void on_key(std::string_view) noexcept {}
+    void start_object() noexcept {}
+    void end_object(size_t) noexcept {}
+    void start_array() noexcept {}
+    void end_array(size_t) noexcept {}
+};
+
+/// @brief High-performance recursive JSON parser, specialized on @p Policy.
+template <typename Policy>
+class BasicParser : public ParserBase {
 public:
-    /// @brief Parse a JSON string (with exceptions).
+    /// @brief Parse a JSON string.
     ///
     /// Internally creates a stack-buffered std::pmr::monotonic_buffer_resource
     /// for parser temporaries (string building, duplicate-key set). When an
     /// arena is active, the arena is used instead — enabling zero-copy strings.
+    ///
+    /// Invalid JSON throws ParseError, or, when @p ec is given, sets *ec and
+    /// returns null without throwing (this applies to all entry points that
+    /// take @p ec).
     [[nodiscard]] static JsonValue parse(std::string_view input,
-                                         const ParseOptions& opts = {}) {
+                                         const ParseOptions& opts = {},
+                                         std::error_code* ec = nullptr) {
         // Stack-buffered monotonic resource for parser temporary allocations.
-        // When an arena is active, use the arena directly (zero-copy path).
+        alignas(16) char temp_buf[4096];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+        return parse_with_scratch(input, opts, local_mbr, ec);
+    }
+
+    /// @brief Parse with parser temporaries (decoded strings, duplicate-key
+    /// sets, frame stack, structural index window) taken from @p scratch.
+    ///
+    /// When an arena is active, temporaries other than the index window use
+    /// the arena directly instead (zero-copy path for escaped strings).
+    /// Nothing allocated from @p scratch outlives the call.
+    [[nodiscard]] static JsonValue parse_with_scratch(std::string_view input,
+                                                      const ParseOptions& opts,
+                                                      std::pmr::memory_resource& scratch,
+                                                      std::error_code* ec = nullptr) {
+        return parse_at(input, opts, scratch, SourceLocation{}, ec);
+    }
+
+    /// @brief parse_with_scratch() of a text that starts at @p origin in an
+    /// enclosing stream; error locations are reported in stream coordinates
+    /// (used by ArrayStreamReader).
+    [[nodiscard]] static JsonValue parse_at(std::string_view input, const ParseOptions& opts,
+                                            std::pmr::memory_resource& scratch,
+                                            const SourceLocation& origin,
+                                            std::error_code* ec = nullptr) {
         // Cache the TLS arena pointer once here — the Parser constructor will
         // cache it further, avoiding repeated TLS access inside the hot loop.
         auto* arena = detail::current_arena;
+        auto* mr = arena
+                 ? static_cast<std::pmr::memory_resource*>(arena)
+                 : &scratch;
+
+        BasicParser p(input.data(), input.data() + input.size(), opts, mr, arena);
+        p.origin_ = origin;
+        p.check_utf8();
+        // The index window lives in the scratch resource even when an arena
+        // is active: it is dead as soon as parsing finishes.
+        simd::StructuralIndexer indexer;
+        if (opts.structural_index) p.start_index(indexer, scratch);
+        JsonValue result = p.parse_root();
+        p.skip_whitespace();
+        if (p.allow_comments()) p.skip_comments();
+        if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+            p.error("unexpected trailing content", errc::trailing_content);
+        }
+        p.finish(ec);
+        if (JSON_UNLIKELY(p.failed())) return {};
+        return result;
+    }
+
+    /// @brief Parse inputs[0..count) into out[0..count) (see
+    /// yajson::parse_batch); returns the number of failed documents.
+    ///
+    /// The scratch resource and the arena pointer are set up once for the
+    /// whole batch; the scratch resource is rewound between documents, so
+    /// one large document does not pin its overflow for the rest of the
+    /// batch. Nothing throws: allocation failure is reported per document
+    /// as std::errc::not_enough_memory.
+    static size_t parse_batch(const std::string_view* inputs, size_t count,
+                              const ParseOptions& opts, result<JsonValue>* out) noexcept {
+        auto* arena = detail::current_arena;
         alignas(16) char temp_buf[4096];
         std::pmr::monotonic_buffer_resource local_mbr(
             temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
@@ -58,29 +325,284 @@ public:
                  ? static_cast<std::pmr::memory_resource*>(arena)
                  : static_cast<std::pmr::memory_resource*>(&local_mbr);
 
-        Parser p(input.data(), input.data() + input.size(), opts, mr, arena);
-        JsonValue result = p.parse_value();
+        size_t failures = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const std::string_view input = inputs[i];
+            result<JsonValue>& r = out[i];
+            r.ec.clear();
+            try {
+                BasicParser p(input.data(), input.data() + input.size(), opts, mr, arena);
+                p.check_utf8();
+                simd::StructuralIndexer indexer;
+                if (opts.structural_index) p.start_index(indexer, local_mbr);
+                r.value = p.parse_root();
+                p.skip_whitespace();
+                if (p.allow_comments()) p.skip_comments();
+                if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+                    p.error("unexpected trailing content", errc::trailing_content);
+                }
+                p.finish(&r.ec);
+            } catch (...) {
+                // The parser itself never throws: only allocation can fail
+                // (std::bad_alloc, or std::length_error from a container)
+                r.ec = std::make_error_code(std::errc::not_enough_memory);
+            }
+            if (JSON_UNLIKELY(r.ec)) {
+                r.value = JsonValue();
+                ++failures;
+            }
+            local_mbr.release();
+        }
+        return failures;
+    }
+
+    /// @brief Parse one complete value spanning [first, last) of a larger
+    /// document starting at @p doc_begin. Error locations are reported
+    /// relative to @p doc_begin (used by the on-demand API).
+    [[nodiscard]] static JsonValue parse_subrange(const char* doc_begin, const char* first,
+                                                  const char* last, const ParseOptions& opts) {
+        auto* arena = detail::current_arena;
+        alignas(16) char temp_buf[1024];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+        auto* mr = arena
+                 ? static_cast<std::pmr::memory_resource*>(arena)
+                 : static_cast<std::pmr::memory_resource*>(&local_mbr);
+
+        BasicParser p(first, last, opts, mr, arena);
+        p.begin_ = doc_begin;
+        JsonValue result = p.parse_root();
         p.skip_whitespace();
-        if (p.opts_.allow_comments) p.skip_comments();
+        if (p.allow_comments()) p.skip_comments();
         if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
             p.error("unexpected trailing content", errc::trailing_content);
         }
+        p.finish();
         return result;
     }
 
-    /// @brief Parse a JSON string (no exceptions, error_code).
-    [[nodiscard]] static result<JsonValue> try_parse(
-            std::string_view input, const ParseOptions& opts = {}) noexcept {
-        try {
-            return {parse(input, opts), {}};
-        } catch (const ParseError& e) {
-            return {JsonValue{}, e.code()};
-        } catch (...) {
-            return {JsonValue{}, make_error_code(errc::unexpected_character)};
+    /// @brief Parse @p buf destructively (see yajson::parse_insitu): escaped
+    /// strings are decoded over their own bytes and all string values longer
+    /// than SSO reference the buffer.
+    [[nodiscard]] static JsonValue parse_insitu(char* buf, size_t len,
+                                                const ParseOptions& opts,
+                                                std::error_code* ec = nullptr) {
+        auto* arena = detail::current_arena;
+        alignas(16) char temp_buf[4096];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+        auto* mr = arena
+                 ? static_cast<std::pmr::memory_resource*>(arena)
+                 : static_cast<std::pmr::memory_resource*>(&local_mbr);
+
+        // The structural index would be built over bytes that decoding
+        // later rewrites, so in-situ parsing is always single-stage
+        ParseOptions o = opts;
+        o.borrow_strings = true;
+        o.structural_index = false;
+        BasicParser p(buf, buf + len, o, mr, arena);
+        p.check_utf8();
+        p.insitu_ = buf;
+        JsonValue result = p.parse_root();
+        p.skip_whitespace();
+        if (p.allow_comments()) p.skip_comments();
+        if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+            p.error("unexpected trailing content", errc::trailing_content);
+        }
+        p.finish(ec);
+        if (JSON_UNLIKELY(p.failed())) return {};
+        return result;
+    }
+
+    /// @brief Parse the elements of a root-level array that lie in
+    /// [first, last) and append them to @p out (used by parse_parallel).
+    ///
+    /// The range holds comma-separated elements at depth 1; the separator
+    /// that ends it is at @p last and is not part of the range. When
+    /// @p final_chunk is set, the range instead runs to the end of the
+    /// document: it ends with the array's ']' and optional trailing
+    /// whitespace. @p after_comma marks a range that starts right after a
+    /// separator (relevant for a trailing comma before ']'). Error locations
+    /// are relative to @p doc_begin.
+    static void parse_array_chunk(const char* doc_begin, const char* first, const char* last,
+                                  bool final_chunk, bool after_comma,
+                                  const ParseOptions& opts, Array& out) {
+        auto* arena = detail::current_arena;
+        alignas(16) char temp_buf[4096];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+        auto* mr = arena
+                 ? static_cast<std::pmr::memory_resource*>(arena)
+                 : static_cast<std::pmr::memory_resource*>(&local_mbr);
+
+        BasicParser p(first, last, opts, mr, arena);
+        p.begin_ = doc_begin;
+        p.depth_ = 1;  // inside the root array
+        p.skip_ws_and_comments();
+        const bool close_first = final_chunk && p.ptr_ < p.end_ && *p.ptr_ == ']' &&
+                                 (!after_comma || p.allow_trailing_commas());
+        if (!close_first) {
+            for (;;) {
+                out.push_back(p.parse_root());
+                p.skip_ws_and_comments();
+
+                if (p.ptr_ >= p.end_) {
+                    if (final_chunk) p.error("unterminated array", errc::unterminated_array);
+                    p.finish();
+                    return;
+                }
+                if (*p.ptr_ == ',') {
+                    ++p.ptr_;
+                    p.skip_ws_and_comments();
+                    if (final_chunk && p.allow_trailing_commas() &&
+                        p.ptr_ < p.end_ && *p.ptr_ == ']') {
+                        break;
+                    }
+                    continue;
+                }
+                if (final_chunk && *p.ptr_ == ']') break;
+                p.error("expected ',' or ']' in array");
+                p.finish();
+            }
+        }
+        ++p.ptr_;  // the root ']'
+        p.skip_whitespace();
+        if (p.allow_comments()) p.skip_comments();
+        if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+            p.error("unexpected trailing content", errc::trailing_content);
+        }
+        p.finish();
+    }
+
+    /// @brief Parse one scalar token in [first, last) — a string, number or
+    /// literal, or an object key when @p key is set — and deliver it as a
+    /// single handler event. Returns where the token ended (may be before
+    /// @p last if trailing bytes do not belong to it). The token lies in a
+    /// text fragment starting at @p text_begin whose own location in the
+    /// full stream is @p origin; errors are reported in stream coordinates
+    /// (used by IncrementalSaxParser, which sees the stream chunk by chunk).
+    template <typename Handler>
+    static const char* parse_token_events(const char* text_begin, const char* first,
+                                          const char* last, bool key, Handler& handler,
+                                          const ParseOptions& opts,
+                                          const SourceLocation& origin) {
+        // A single token needs at most one scratch string: no local arena.
+        BasicParser p(first, last, opts, std::pmr::new_delete_resource(), nullptr);
+        p.begin_ = text_begin;
+        p.origin_ = origin;
+        if (key) {
+            const std::string_view k = p.scan_key();
+            if (!p.failed()) handler.on_key(k);
+        } else {
+            p.walk_value(handler);
+        }
+        p.finish();
+        return p.ptr_;
+    }
+
+    /// @brief Parse a JSON string into a stream of handler events (no DOM).
+    ///
+    /// The handler receives the same callbacks as a SAX consumer:
+    /// on_null(), on_bool(b), on_int64(i), on_uint64(u), on_double(d),
+    /// on_string(sv), on_key(sv), start_object(), end_object(n),
+    /// start_array(), end_array(n). String views point into @p input when
+    /// the string has no escapes, otherwise into a scratch buffer; either
+    /// way they are valid only for the duration of the callback.
+    /// Syntax errors are reported exactly like parse(): as ParseError, or in
+    /// @p ec when given. No event follows the error.
+    template <typename Handler>
+    static void parse_events(std::string_view input, Handler& handler,
+                             const ParseOptions& opts = {},
+                             std::error_code* ec = nullptr) {
+        alignas(16) char temp_buf[4096];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+
+        BasicParser p(input.data(), input.data() + input.size(), opts, &local_mbr, nullptr);
+        p.check_utf8();
+        simd::StructuralIndexer indexer;
+        if (opts.structural_index) p.start_index(indexer, local_mbr);
+        p.walk_value(handler);
+        p.skip_whitespace();
+        if (p.allow_comments()) p.skip_comments();
+        if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+            p.error("unexpected trailing content", errc::trailing_content);
+        }
+        p.finish(ec);
+    }
+
+    /// @brief Check that @p input is a valid JSON text (see yajson::validate).
+    ///
+    /// Walks the input like parse_events() without building values or
+    /// decoding strings. Nothing is allocated, except key copies for
+    /// duplicate detection when allow_duplicate_keys is off (from a stack
+    /// buffer first). The structural index is not used.
+    [[nodiscard]] static result<void> validate(std::string_view input,
+                                               const ParseOptions& opts) {
+        alignas(16) char temp_buf[1024];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+
+        BasicParser p(input.data(), input.data() + input.size(), opts, &local_mbr, nullptr);
+        p.check_utf8();
+        ValidateHandler handler;
+        p.walk_value(handler);
+        p.skip_whitespace();
+        if (p.allow_comments()) p.skip_comments();
+        if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+            p.error("unexpected trailing content", errc::trailing_content);
+        }
+        if (JSON_UNLIKELY(p.failed())) {
+            return {make_error_code(p.fail_.code), p.failure_location()};
+        }
+        return {};
+    }
+
+    /// @brief Walk @p input once and materialize only the values selected
+    /// by @p trie (used by yajson::extract; see extract.hpp).
+    ///
+    /// Trie interface (node 0 is the document root):
+    ///   bool terminal(node)       — a pointer ends at this node
+    ///   uint32_t child(node, key) — member child, or Trie::kNoNode
+    ///   uint32_t element(node, i) — element child, or Trie::kNoNode
+    ///   void enter(node, slots)   — a value for node was found: clear its slots
+    ///   void found(node, JsonValue&&, slots) — terminal value for node
+    ///
+    /// Subtrees that no pointer enters are skipped without building values.
+    template <typename Trie, typename Slots>
+    static void extract(std::string_view input, const ParseOptions& opts,
+                        const Trie& trie, Slots& slots) {
+        auto* arena = detail::current_arena;
+        alignas(16) char temp_buf[4096];
+        std::pmr::monotonic_buffer_resource local_mbr(
+            temp_buf, sizeof(temp_buf), std::pmr::new_delete_resource());
+        auto* mr = arena
+                 ? static_cast<std::pmr::memory_resource*>(arena)
+                 : static_cast<std::pmr::memory_resource*>(&local_mbr);
+
+        BasicParser p(input.data(), input.data() + input.size(), opts, mr, arena);
+        p.check_utf8();
+        p.extract_value(trie, 0, slots);
+        p.skip_whitespace();
+        if (p.allow_comments()) p.skip_comments();
+        if (JSON_UNLIKELY(p.ptr_ < p.end_)) {
+            p.error("unexpected trailing content", errc::trailing_content);
         }
+        p.finish();
     }
 
 private:
+    /// @brief First error: @c fmt is the message, with each %c replaced by
+    /// the next of c1, c2 and %s by detail.
+    struct Failure {
+        errc code = errc::ok;
+        const char* at = nullptr;
+        const char* fmt = nullptr;
+        char c1 = 0;
+        char c2 = 0;
+        std::string detail;
+    };
+
     const char* ptr_;
     const char* end_;
     const char* begin_;
@@ -90,8 +612,15 @@ private:
     std::pmr::memory_resource* temp_mr_;  ///< Temporary allocator for parser internals
     MonotonicArena* arena_;               ///< Cached TLS arena pointer (avoids repeated TLS access)
     std::pmr::memory_resource* resource_; ///< Cached pmr resource (arena or new_delete)
-
-    Parser(const char* begin, const char* end,
+    const uint32_t* idx_ = nullptr;       ///< Structural index cursor (null = single-stage)
+    uint32_t* idx_buf_ = nullptr;         ///< Structural index window
+    simd::StructuralIndexer* indexer_ = nullptr;
+    std::pmr::string scratch_;            ///< Decoded escaped strings (see scan_string)
+    char* insitu_ = nullptr;              ///< Writable begin_ in in-situ mode, else null
+    SourceLocation origin_{};             ///< Location of begin_ in the enclosing text
+    Failure fail_;                        ///< First error (see error())
+
+    BasicParser(const char* begin, const char* end,
            const ParseOptions& opts,
            std::pmr::memory_resource* temp_mr,
            MonotonicArena* arena) noexcept
@@ -100,35 +629,127 @@ private:
         , temp_mr_(temp_mr)
         , arena_(arena)
         , resource_(arena_ ? static_cast<std::pmr::memory_resource*>(arena_)
-                           : std::pmr::new_delete_resource()) {}
+                           : std::pmr::new_delete_resource())
+        , scratch_(temp_mr) {}
+
+    // ─── Extension flags (constants unless Policy is DynamicPolicy) ─────────
+
+    static constexpr bool kDynamic = Policy::kDynamic;
+    static constexpr bool kPadded = Policy::kPadded;
+    static constexpr const ParseOptions& kFixed = Policy::kOptions;
+
+    bool allow_comments() const noexcept {
+        return kDynamic ? opts_.allow_comments : kFixed.allow_comments;
+    }
+    bool allow_trailing_commas() const noexcept {
+        return kDynamic ? opts_.allow_trailing_commas : kFixed.allow_trailing_commas;
+    }
+    bool allow_single_quotes() const noexcept {
+        return kDynamic ? opts_.allow_single_quotes : kFixed.allow_single_quotes;
+    }
+    bool allow_unquoted_keys() const noexcept {
+        return kDynamic ? opts_.allow_unquoted_keys : kFixed.allow_unquoted_keys;
+    }
+    bool allow_nan_inf() const noexcept {
+        return kDynamic ? opts_.allow_nan_inf : kFixed.allow_nan_inf;
+    }
+    bool allow_hex_numbers() const noexcept {
+        return kDynamic ? opts_.allow_hex_numbers : kFixed.allow_hex_numbers;
+    }
+    bool allow_control_chars() const noexcept {
+        return kDynamic ? opts_.allow_control_chars : kFixed.allow_control_chars;
+    }
+    bool allow_duplicate_keys() const noexcept {
+        return kDynamic ? opts_.allow_duplicate_keys : kFixed.allow_duplicate_keys;
+    }
 
     // ─── Error reporting ──────────────────────────────────────────────────
+    //
+    // The parsing core does not throw. The first error is recorded in fail_
+    // (code, position and a message template; nothing is formatted) and ptr_
+    // jumps to end_, so every caller runs into its end-of-input check and
+    // returns. The entry points then call finish(): only there, and only if
+    // the caller wants an exception or a location, are the message and the
+    // line/column built.
+
+    /// @brief Result of the error helpers, convertible to the return type of
+    /// any parsing function (`return error(...);`). Callers ignore the value.
+    struct Failed {
+        template <typename T>
+        operator T() const noexcept(std::is_nothrow_default_constructible_v<T>) { return T{}; }
+    };
 
-    [[nodiscard]] SourceLocation current_location() const noexcept {
-        SourceLocation loc;
-        loc.offset = static_cast<size_t>(ptr_ - begin_);
-        for (const char* p = begin_; p < ptr_; ++p) {
-            if (*p == '\n') { ++loc.line; loc.column = 1; }
-            else { ++loc.column; }
+    [[nodiscard]] bool failed() const noexcept { return fail_.code != errc::ok; }
+
+    JSON_NOINLINE Failed error(const char* fmt, errc code = errc::unexpected_character,
+                               char c1 = 0, char c2 = 0, std::string_view detail = {}) {
+        if (!failed()) {
+            fail_.code = code;
+            fail_.at = ptr_;
+            fail_.fmt = fmt;
+            fail_.c1 = c1;
+            fail_.c2 = c2;
+            fail_.detail.assign(detail.data(), detail.size());
         }
-        return loc;
+        ptr_ = end_;
+        return {};
+    }
+
+    JSON_NOINLINE Failed error_unexpected_end() {
+        return error("unexpected end of input", errc::unexpected_end_of_input);
+    }
+
+    JSON_NOINLINE Failed error_unexpected_char() {
+        if (ptr_ >= end_) return error_unexpected_end();
+        return error("unexpected character '%c'", errc::unexpected_character, *ptr_);
+    }
+
+    [[nodiscard]] SourceLocation failure_location() const noexcept {
+        return shift_location(origin_, location_at(begin_, fail_.at));
+    }
+
+    [[nodiscard]] std::string failure_message() const {
+        std::string msg;
+        const char chars[2] = {fail_.c1, fail_.c2};
+        size_t next = 0;
+        for (const char* f = fail_.fmt; *f; ++f) {
+            if (f[0] == '%' && f[1] == 'c') {
+                msg += chars[next++];
+                ++f;
+            } else if (f[0] == '%' && f[1] == 's') {
+                msg += fail_.detail;
+                ++f;
+            } else {
+                msg += *f;
+            }
+        }
+        return msg;
     }
 
-    [[noreturn]] JSON_NOINLINE void error(const std::string& msg,
-                                           errc code = errc::unexpected_character) {
-        throw ParseError(msg, current_location(), code);
+    /// @brief End of an entry point: report the recorded error, if any, as
+    /// ParseError, or only as its code when @p ec is given.
+    void finish(std::error_code* ec = nullptr) const {
+        if (JSON_LIKELY(!failed())) return;
+        if (ec) {
+            *ec = make_error_code(fail_.code);
+            return;
+        }
+        throw_failure();
     }
 
-    [[noreturn]] JSON_NOINLINE void error_unexpected_end() {
-        throw ParseError("unexpected end of input", current_location(),
-                         errc::unexpected_end_of_input);
+    [[noreturn]] JSON_NOINLINE void throw_failure() const {
+        throw ParseError(failure_message(), failure_location(), fail_.code);
     }
 
-    [[noreturn]] JSON_NOINLINE void error_unexpected_char() {
-        if (ptr_ >= end_) error_unexpected_end();
-        throw ParseError(
-            std::string("unexpected character '") + *ptr_ + "'",
-            current_location(), errc::unexpected_character);
+    /// @brief ParseOptions::validate_utf8: reject malformed UTF-8 anywhere
+    /// in the remaining input before parsing it.
+    void check_utf8() {
+        if (!opts_.validate_utf8) return;
+        const char* bad = simd::validate_utf8(ptr_, end_);
+        if (JSON_UNLIKELY(bad != end_)) {
+            ptr_ = bad;
+            error("invalid UTF-8 encoding", errc::invalid_utf8);
+        }
     }
 
     // ─── Depth tracking ──────────────────────────────────────────────────────
@@ -141,31 +762,114 @@ private:
 
     void pop_depth() noexcept { --depth_; }
 
+    // ─── Structural index (stage 1) ──────────────────────────────────────────
+
+    /// Bytes indexed per stage-1 window (the window holds up to one entry
+    /// per byte, so 16 KiB of input needs a 64 KiB buffer at most).
+    static constexpr size_t kIndexWindow = 16 * 1024;
+
+    /// @brief Enable two-stage mode and index the first window.
+    /// Skipped for extensions the stage-1 classifier does not model
+    /// (comments and single-quoted strings change what is "inside a string").
+    void start_index(simd::StructuralIndexer& indexer, std::pmr::memory_resource& mr) {
+        if (allow_comments() || allow_single_quotes()) return;
+        const size_t len = static_cast<size_t>(end_ - begin_);
+        if (len > simd::kMaxIndexedInput) return;
+        const size_t cap = (len < kIndexWindow ? len : kIndexWindow) + 1;
+        idx_buf_ = static_cast<uint32_t*>(mr.allocate(cap * sizeof(uint32_t), alignof(uint32_t)));
+        indexer_ = &indexer;
+        idx_ = refill_index();
+    }
+
+    JSON_NOINLINE const uint32_t* refill_index() noexcept {
+        indexer_->fill(begin_, end_, idx_buf_, kIndexWindow);
+        return idx_buf_;
+    }
+
+    /// @brief Advance the index cursor to the first entry at or after @p off.
+    /// The parser only moves forward, so the walk is amortized O(1); the
+    /// terminator (input length or kIndexRefill) bounds it.
+    const uint32_t* index_seek(uint32_t off) noexcept {
+        const uint32_t* c = idx_;
+        for (;;) {
+            while ((*c & ~simd::kClosingQuoteTag) < off) ++c;
+            if (JSON_LIKELY(*c != simd::kIndexRefill)) break;
+            c = refill_index();
+        }
+        idx_ = c;
+        return c;
+    }
+
+    /// @brief Closing quote of the string whose opening quote is at ptr_ - 1,
+    /// or nullptr if the string has escapes/control characters (not indexed).
+    const char* indexed_string_end() noexcept {
+        const auto off = static_cast<uint32_t>(ptr_ - begin_ - 1);
+        const uint32_t* c = index_seek(off);
+        if (*c != off) return nullptr;
+        ++c;
+        while (JSON_UNLIKELY(*c == simd::kIndexRefill)) c = refill_index();
+        idx_ = c;
+        if (!(*c & simd::kClosingQuoteTag)) return nullptr;
+        idx_ = c + 1;
+        return begin_ + (*c & ~simd::kClosingQuoteTag);
+    }
+
     // ─── Whitespace and comments ───────────────────────────────────────
 
+    /// @brief True if *ptr_ may be read: always on padded input, where the
+    /// NUL sentinel at end_ matches no token character.
+    JSON_ALWAYS_INLINE bool more() const noexcept {
+        return kPadded || ptr_ < end_;
+    }
+
+    /// @brief Bound for SIMD scans: past the padding on padded input, where
+    /// the scans stop at the sentinel (or are clamped) anyway.
+    const char* simd_end() const noexcept {
+        return kPadded ? end_ + YAJSON_PADDING : end_;
+    }
+
+    static constexpr bool is_whitespace(char c) noexcept {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
     void skip_whitespace() noexcept {
         // Fast path 0: current char is not whitespace (most common case)
-        if (JSON_LIKELY(ptr_ < end_ && static_cast<unsigned char>(*ptr_) > ' ')) {
+        if (JSON_LIKELY(more() && static_cast<unsigned char>(*ptr_) > ' ')) {
             return;
         }
-        // Fast path 1: single whitespace char (very common in JSON after ':' and ',')
-        // Avoids the NOINLINE slow-path call for the most frequent whitespace pattern.
-        if (ptr_ + 1 < end_ && static_cast<unsigned char>(ptr_[1]) > ' ') {
-            ++ptr_;
-            return;
-        }
-        // Fast path 2: two whitespace chars (e.g. ", " or ":\n")
-        if (ptr_ + 2 < end_ && static_cast<unsigned char>(ptr_[2]) > ' ') {
-            ptr_ += 2;
-            return;
+        // Fast paths 1-2: one or two whitespace chars (very common after ':'
+        // and ',', e.g. ", " or ":\n"). Avoids the NOINLINE slow-path call
+        // for the most frequent whitespace patterns. Bytes <= ' ' that are
+        // not whitespace (control characters, the padding NUL) must stop.
+        if ((kPadded || ptr_ + 2 < end_) && is_whitespace(ptr_[0])) {
+            if (static_cast<unsigned char>(ptr_[1]) > ' ') {
+                ++ptr_;
+                return;
+            }
+            if (is_whitespace(ptr_[1]) && static_cast<unsigned char>(ptr_[2]) > ' ') {
+                ptr_ += 2;
+                return;
+            }
         }
         skip_whitespace_slow();
     }
 
     JSON_NOINLINE void skip_whitespace_slow() noexcept {
-        // Try SIMD first (we already know *ptr_ is whitespace from the caller)
-        if (ptr_ + 16 <= end_) {
-            ptr_ = simd::skip_whitespace(ptr_, end_);
+        // Two-stage mode: the next indexed position is the next token, unless
+        // something other than whitespace precedes it (e.g. a control byte
+        // after a scalar). Then stop at that byte like the single-stage path.
+        if (idx_ && ptr_ < end_) {
+            const uint32_t* c = index_seek(static_cast<uint32_t>(ptr_ - begin_));
+            const char* next = begin_ + (*c & ~simd::kClosingQuoteTag);
+            if (JSON_LIKELY(simd::skip_whitespace(ptr_, next) == next)) {
+                ptr_ = next;
+                return;
+            }
+        }
+        // Try SIMD first; on padded input the NUL at end_ stops it and the
+        // loads never need the scalar tail
+        if (kPadded || ptr_ + 16 <= end_) {
+            ptr_ = simd::skip_whitespace(ptr_, simd_end());
             return;
         }
         // Scalar fallback for tail bytes
@@ -203,11 +907,11 @@ private:
 
     /// @brief Skip whitespace and (optionally) comments.
     /// Inlined for the common case (no comments): just skip_whitespace().
-    /// The opts_.allow_comments check is well-predicted but the extra function
+    /// The allow_comments() check is well-predicted but the extra function
     /// call overhead adds up with millions of JSON values.
     JSON_ALWAYS_INLINE void skip_ws_and_comments() {
         skip_whitespace();
-        if (JSON_UNLIKELY(opts_.allow_comments)) {
+        if (JSON_UNLIKELY(allow_comments())) {
             skip_comments_and_ws();
         }
     }
@@ -221,22 +925,25 @@ private:
     // ─── Character reading ────────────────────────────────────────────
 
     char peek() const noexcept {
-        if (JSON_UNLIKELY(ptr_ >= end_)) return '\0';
+        if (JSON_UNLIKELY(!more())) return '\0';
         return *ptr_;
     }
 
     char advance() {
-        if (JSON_UNLIKELY(ptr_ >= end_)) error_unexpected_end();
+        if (JSON_UNLIKELY(ptr_ >= end_)) return error_unexpected_end();
         return *ptr_++;
     }
 
     void expect(char c) {
-        if (JSON_LIKELY(ptr_ < end_ && *ptr_ == c)) {
+        if (JSON_LIKELY(more() && *ptr_ == c)) {
             ++ptr_;
             return;
         }
-        if (ptr_ >= end_) error_unexpected_end();
-        error(std::string("expected '") + c + "', got '" + *ptr_ + "'");
+        if (ptr_ >= end_) {
+            error_unexpected_end();
+            return;
+        }
+        error("expected '%c', got '%c'", errc::unexpected_character, c, *ptr_);
     }
 
     /// Template version ensures memcmp sees a compile-time length,
@@ -244,9 +951,12 @@ private:
     template <size_t N>
     void expect_literal(const char (&literal)[N]) {
         constexpr size_t len = N - 1;  // exclude null terminator
-        if (JSON_UNLIKELY(static_cast<size_t>(end_ - ptr_) < len) ||
+        static_assert(len < YAJSON_PADDING);
+        // Padded input: the NUL sentinel fails the compare at end_
+        if (JSON_UNLIKELY(!kPadded && static_cast<size_t>(end_ - ptr_) < len) ||
             JSON_UNLIKELY(std::memcmp(ptr_, literal, len) != 0)) {
-            error(std::string("expected '") + literal + "'", errc::invalid_literal);
+            error("expected '%s'", errc::invalid_literal, 0, 0, literal);
+            return;
         }
         ptr_ += len;
     }
@@ -255,13 +965,14 @@ private:
 
     JsonValue parse_value() {
         skip_ws_and_comments();
-        if (JSON_UNLIKELY(ptr_ >= end_)) error_unexpected_end();
+        // Padded input: the sentinel reaches error_unexpected_char() below
+        if (JSON_UNLIKELY(!more())) return error_unexpected_end();
 
         switch (*ptr_) {
             case '"': return parse_string_value();
             case '\'':
-                if (opts_.allow_single_quotes) return parse_string_value_sq();
-                error_unexpected_char();
+                if (allow_single_quotes()) return parse_string_value_sq();
+                return error_unexpected_char();
             case '{': return parse_object();
             case '[': return parse_array();
             case 't': return parse_true();
@@ -272,13 +983,13 @@ private:
             case '5': case '6': case '7': case '8': case '9':
                 return parse_number();
             case 'N':
-                if (opts_.allow_nan_inf) return parse_nan();
-                error_unexpected_char();
+                if (allow_nan_inf()) return parse_nan();
+                return error_unexpected_char();
             case 'I':
-                if (opts_.allow_nan_inf) return parse_infinity(false);
-                error_unexpected_char();
+                if (allow_nan_inf()) return parse_infinity(false);
+                return error_unexpected_char();
             default:
-                error_unexpected_char();
+                return error_unexpected_char();
         }
     }
 
@@ -310,46 +1021,97 @@ private:
 
     // ─── String parsing (full UTF-8 support) ──────────────────────────────
 
-    /// @brief Parse a double-quoted string and return as std::string.
-    /// Fast path: if no escape sequences, return directly from input span
-    /// without constructing a pmr::string at all (~95% of JSON strings).
-    std::string parse_string() {
-        expect('"');
-        // Fast path: probe for closing quote with SIMD
-        const char* delim = simd::find_string_delimiter(ptr_, end_);
-        if (JSON_LIKELY(delim < end_ && *delim == '"')) {
-            if (JSON_UNLIKELY(!opts_.allow_control_chars)) {
-                const char* bad = simd::find_needs_escape<false>(ptr_, delim);
-                if (bad < delim && static_cast<unsigned char>(*bad) < 0x20) {
-                    error("unescaped control character in string", errc::invalid_escape);
+    /// @brief Scan a quoted string (ptr_ at the opening quote) and return a view
+    /// of its decoded content.
+    /// Fast path: if no escape sequences, the view points into the input
+    /// (~95% of JSON strings). Otherwise the content is decoded into scratch_
+    /// and the view is valid until the next scan_string() call.
+    std::string_view scan_string() {
+        const char quote = *ptr_++;
+        if (JSON_LIKELY(quote == '"')) {
+            // Two-stage mode: the index already knows where clean strings end
+            if (idx_) {
+                if (const char* close = indexed_string_end()) {
+                    std::string_view sv(ptr_, static_cast<size_t>(close - ptr_));
+                    ptr_ = close + 1;
+                    return sv;
                 }
             }
-            // No escapes — zero-copy from input buffer
-            std::string result(ptr_, static_cast<size_t>(delim - ptr_));
-            ptr_ = delim + 1;
-            return result;
+            // Fast path: probe for closing quote with SIMD
+            const char* delim = find_delimiter();
+            if (JSON_UNLIKELY(!clean_segment(delim))) return {};
+            if (JSON_LIKELY(delim < end_ && *delim == '"')) {
+                std::string_view sv(ptr_, static_cast<size_t>(delim - ptr_));
+                ptr_ = delim + 1;
+                return sv;
+            }
+            // Slow path: has escape sequences, decode into the scratch buffer
+            if (insitu_) return decode_in_place(delim, '"');
+            scratch_.clear();
+            if (delim > ptr_) {
+                scratch_.append(ptr_, static_cast<size_t>(delim - ptr_));
+                ptr_ = delim;
+            }
+            parse_string_content_into(scratch_, '"');
+            return scratch_;
         }
-        // Slow path: has escape sequences, use pmr::string builder
-        std::pmr::string buf(temp_mr_);
-        if (delim > ptr_) {
-            buf.append(ptr_, static_cast<size_t>(delim - ptr_));
-            ptr_ = delim;
+        if (insitu_) return decode_in_place(ptr_, quote);
+        scratch_.clear();
+        parse_string_content_into(scratch_, quote);
+        return scratch_;
+    }
+
+    /// @brief Output of in-situ decoding. It writes behind the read position
+    /// and never overtakes it: no escape decodes to more bytes than it spans.
+    struct InsituWriter {
+        char* pos;
+
+        void append(const char* s, size_t n) noexcept {
+            if (s != pos) std::memmove(pos, s, n);
+            pos += n;
         }
-        parse_string_content_into(buf, '"');
-        return std::string(buf.data(), buf.size());
+        void push_back(char c) noexcept { *pos++ = c; }
+    };
+
+    /// @brief In-situ mode: decode the string whose content starts at ptr_
+    /// over its own bytes. [ptr_, clean_end) is known to need no decoding.
+    std::string_view decode_in_place(const char* clean_end, char quote) {
+        char* start = insitu_ + (ptr_ - begin_);
+        InsituWriter out{insitu_ + (clean_end - begin_)};
+        ptr_ = clean_end;
+        parse_string_content_into(out, quote);
+        return {start, static_cast<size_t>(out.pos - start)};
     }
 
-    std::string parse_string_sq() {
-        expect('\'');
-        std::pmr::string buf(temp_mr_);
-        parse_string_content_into(buf, '\'');
-        return std::string(buf.data(), buf.size());
+    /// @brief First '"' or '\\' at or after ptr_, or end_.
+    /// Padded input: the SIMD search runs over the padding with full-width
+    /// loads only and the result is clamped to end_.
+    const char* find_delimiter() const noexcept {
+        const char* delim = simd::find_string_delimiter(ptr_, simd_end());
+        if constexpr (kPadded) {
+            if (delim > end_) delim = end_;
+        }
+        return delim;
     }
 
-    /// @brief Build string content into a pmr::string buffer.
-    /// The template-less version avoids code duplication between the
-    /// std::string return path (keys) and the zero-copy JsonValue path (values).
-    void parse_string_content_into(std::pmr::string& result, char quote) {
+    /// @brief Check the string content [ptr_, @p delim) — the run up to the
+    /// next '"', '\\' or the end of input — for unescaped control characters.
+    /// Every double-quoted scan (parse, scan, validate, in-situ, lazy) checks
+    /// each run here before looking at what ends it, so they all report the
+    /// same error. @return false after reporting one.
+    bool clean_segment(const char* delim) {
+        if (allow_control_chars()) return true;
+        const char* bad = simd::find_needs_escape<false>(ptr_, delim);
+        if (JSON_LIKELY(bad >= delim || static_cast<unsigned char>(*bad) >= 0x20)) return true;
+        error("unescaped control character in string", errc::invalid_escape);
+        return false;
+    }
+
+    /// @brief Decode string content up to the closing @p quote into @p result:
+    /// a pmr::string, or an InsituWriter in in-situ mode (anything with
+    /// append(const char*, size_t) and push_back(char)).
+    template <typename Out>
+    void parse_string_content_into(Out& result, char quote) {
         // Note: the memchr pre-scan was removed — the SIMD find_string_delimiter
         // in the main loop already identifies the closing quote, making the
         // pre-scan redundant (double scanning the same bytes). For PMR with
@@ -357,14 +1119,9 @@ private:
         for (;;) {
             if (quote == '"') {
                 // SIMD-accelerated search for '"' or '\\'
-                const char* delim = simd::find_string_delimiter(ptr_, end_);
+                const char* delim = find_delimiter();
                 if (delim > ptr_) {
-                    if (JSON_UNLIKELY(!opts_.allow_control_chars)) {
-                        const char* bad = simd::find_needs_escape<false>(ptr_, delim);
-                        if (bad < delim && static_cast<unsigned char>(*bad) < 0x20) {
-                            error("unescaped control character in string", errc::invalid_escape);
-                        }
-                    }
+                    if (JSON_UNLIKELY(!clean_segment(delim))) return;
                     result.append(ptr_, static_cast<size_t>(delim - ptr_));
                     ptr_ = delim;
                 }
@@ -372,9 +1129,10 @@ private:
                 // Scalar search for single-quote delimiter — batch copy
                 const char* run_start = ptr_;
                 while (ptr_ < end_ && *ptr_ != quote && *ptr_ != '\\') {
-                    if (JSON_UNLIKELY(!opts_.allow_control_chars &&
+                    if (JSON_UNLIKELY(!allow_control_chars() &&
                                       static_cast<unsigned char>(*ptr_) < 0x20)) {
                         error("unescaped control character in string", errc::invalid_escape);
+                        return;
                     }
                     ++ptr_;
                 }
@@ -384,6 +1142,7 @@ private:
 
             if (JSON_UNLIKELY(ptr_ >= end_)) {
                 error("unterminated string", errc::unterminated_string);
+                return;
             }
 
             char c = *ptr_;
@@ -399,9 +1158,12 @@ private:
         }
     }
 
-    void parse_escape(std::pmr::string& out) {
-        if (JSON_UNLIKELY(ptr_ >= end_))
+    template <typename Out>
+    void parse_escape(Out& out) {
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
             error("unterminated escape sequence", errc::invalid_escape);
+            return;
+        }
         char c = *ptr_++;
         switch (c) {
             case '"':  out.push_back('"');  return;
@@ -413,11 +1175,13 @@ private:
             case 'r':  out.push_back('\r'); return;
             case 't':  out.push_back('\t'); return;
             case '\'':
-                if (opts_.allow_single_quotes) { out.push_back('\''); return; }
-                error(std::string("invalid escape '\\") + c + "'", errc::invalid_escape);
+                if (allow_single_quotes()) { out.push_back('\''); return; }
+                error("invalid escape '\\%c'", errc::invalid_escape, c);
+                return;
             case 'u':  parse_unicode_escape(out); return;
             default:
-                error(std::string("invalid escape '\\") + c + "'", errc::invalid_escape);
+                error("invalid escape '\\%c'", errc::invalid_escape, c);
+                return;
         }
     }
 
@@ -445,34 +1209,39 @@ private:
 
     uint32_t parse_hex4() {
         if (JSON_UNLIKELY(end_ - ptr_ < 4))
-            error("incomplete unicode escape", errc::invalid_unicode_escape);
+            return error("incomplete unicode escape", errc::invalid_unicode_escape);
         uint32_t val = 0;
         for (int i = 0; i < 4; ++i) {
             uint8_t nib = kHexTable[static_cast<unsigned char>(ptr_[i])];
             if (JSON_UNLIKELY(nib > 15))
-                error("invalid hex digit in unicode escape", errc::invalid_unicode_escape);
+                return error("invalid hex digit in unicode escape", errc::invalid_unicode_escape);
             val = (val << 4) | nib;
         }
         ptr_ += 4;
         return val;
     }
 
-    void parse_unicode_escape(std::pmr::string& out) {
+    template <typename Out>
+    void parse_unicode_escape(Out& out) {
         uint32_t cp = parse_hex4();
 
         if (cp >= 0xD800 && cp <= 0xDBFF) {
             if (JSON_UNLIKELY(end_ - ptr_ < 2 || ptr_[0] != '\\' || ptr_[1] != 'u')) {
                 error("missing low surrogate", errc::invalid_unicode_escape);
+                return;
             }
             ptr_ += 2;
             uint32_t low = parse_hex4();
             if (JSON_UNLIKELY(low < 0xDC00 || low > 0xDFFF)) {
                 error("invalid low surrogate value", errc::invalid_unicode_escape);
+                return;
             }
             cp = 0x10000u + ((cp - 0xD800u) << 10) + (low - 0xDC00u);
         } else if (JSON_UNLIKELY(cp >= 0xDC00 && cp <= 0xDFFF)) {
             error("unexpected low surrogate", errc::invalid_unicode_escape);
+            return;
         }
+        if (JSON_UNLIKELY(failed())) return;
 
         // Use char-buffer overload of utf8::encode to avoid std::string dependency
         char buf[4];
@@ -491,35 +1260,126 @@ private:
     /// (still faster than std::string due to avoided intermediate reallocs).
     JsonValue parse_string_value() {
         expect('"');
+        // Two-stage mode: the index already knows where clean strings end
+        if (idx_) {
+            if (const char* close = indexed_string_end()) {
+                const char* start = ptr_;
+                ptr_ = close + 1;
+                return input_string(start, static_cast<size_t>(close - start));
+            }
+        }
         // Fast path: probe for closing quote with SIMD
-        const char* delim = simd::find_string_delimiter(ptr_, end_);
+        const char* delim = find_delimiter();
+        if (JSON_UNLIKELY(!clean_segment(delim))) return {};
         if (JSON_LIKELY(delim < end_ && *delim == '"')) {
-            if (JSON_UNLIKELY(!opts_.allow_control_chars)) {
-                const char* bad = simd::find_needs_escape<false>(ptr_, delim);
-                if (bad < delim && static_cast<unsigned char>(*bad) < 0x20) {
-                    error("unescaped control character in string", errc::invalid_escape);
-                }
-            }
             // No escapes — construct JsonValue directly from input span
-            std::string_view sv(ptr_, static_cast<size_t>(delim - ptr_));
+            const char* start = ptr_;
             ptr_ = delim + 1;
-            return JsonValue(sv);
+            return input_string(start, static_cast<size_t>(delim - start));
         }
         // Slow path: has escape sequences
-        std::pmr::string buf(temp_mr_);
+        if (insitu_) {
+            const std::string_view sv = decode_in_place(delim, '"');
+            return input_string(sv.data(), sv.size());
+        }
+        if (JSON_UNLIKELY(opts_.lazy_unescape && opts_.borrow_strings) &&
+            !allow_single_quotes() && !allow_control_chars()) {
+            return raw_string(delim);
+        }
+        if (temp_is_arena()) {
+            std::pmr::string buf(temp_mr_);
+            if (delim > ptr_) {
+                buf.append(ptr_, static_cast<size_t>(delim - ptr_));
+                ptr_ = delim;
+            }
+            parse_string_content_into(buf, '"');
+            return pmr_string_to_value(buf);
+        }
+        // Decode into the reusable scratch buffer; the value copies it.
+        scratch_.clear();
         if (delim > ptr_) {
-            buf.append(ptr_, static_cast<size_t>(delim - ptr_));
+            scratch_.append(ptr_, static_cast<size_t>(delim - ptr_));
             ptr_ = delim;
         }
-        parse_string_content_into(buf, '"');
-        return pmr_string_to_value(buf);
+        parse_string_content_into(scratch_, '"');
+        return JsonValue(std::string_view(scratch_));
     }
 
     JsonValue parse_string_value_sq() {
         expect('\'');
-        std::pmr::string buf(temp_mr_);
-        parse_string_content_into(buf, '\'');
-        return pmr_string_to_value(buf);
+        if (insitu_) {
+            const std::string_view sv = decode_in_place(ptr_, '\'');
+            return input_string(sv.data(), sv.size());
+        }
+        if (temp_is_arena()) {
+            std::pmr::string buf(temp_mr_);
+            parse_string_content_into(buf, '\'');
+            return pmr_string_to_value(buf);
+        }
+        scratch_.clear();
+        parse_string_content_into(scratch_, '\'');
+        return JsonValue(std::string_view(scratch_));
+    }
+
+    /// @brief True when temporaries come from the active arena, so a decoded
+    /// string can be adopted by the value without a copy.
+    bool temp_is_arena() const noexcept {
+        return arena_ && temp_mr_ == static_cast<std::pmr::memory_resource*>(arena_);
+    }
+
+    /// @brief True if a string of @p len bytes may be stored as a
+    /// non-owning reference (longer than SSO, length fits the arena form).
+    static constexpr bool can_reference(size_t len) noexcept {
+        return len > JsonValue::kSsoMax &&
+               len <= static_cast<size_t>(std::numeric_limits<uint32_t>::max());
+    }
+
+    /// @brief String value referencing [p, p + len) without owning it
+    /// (the arena string form: nothing is freed on destruction).
+    static JsonValue string_reference(const char* p, size_t len) noexcept {
+        JsonValue v;
+        v.kind_ = Type::String;
+        v.sso_len_ = JsonValue::kHeapTag;
+        v.set_arena_str(p, static_cast<uint32_t>(len));
+        return v;
+    }
+
+    /// @brief Value for an unescaped string at [p, p + len) of the input:
+    /// a view into the input with ParseOptions::borrow_strings, else a copy.
+    JsonValue input_string(const char* p, size_t len) {
+        if (JSON_UNLIKELY(opts_.borrow_strings) && can_reference(len)) {
+            return string_reference(p, len);
+        }
+        return JsonValue(std::string_view(p, len));
+    }
+
+    /// @brief Output that discards decoded bytes: the escapes are only validated.
+    struct NullWriter {
+        void append(const char*, size_t) noexcept {}
+        void push_back(char) noexcept {}
+    };
+
+    /// @brief ParseOptions::lazy_unescape: validate the escaped string whose
+    /// content starts at ptr_ and keep its raw bytes, to be unescaped on
+    /// first access. [ptr_, clean_end) is known to need no decoding.
+    JsonValue raw_string(const char* clean_end) {
+        const char* start = ptr_;
+        ptr_ = clean_end;
+        NullWriter sink;
+        parse_string_content_into(sink, '"');
+        if (JSON_UNLIKELY(failed())) return {};
+        const auto len = static_cast<size_t>(ptr_ - 1 - start);
+        if (can_reference(len)) {
+            JsonValue v;
+            v.kind_ = Type::String;
+            v.sso_len_ = JsonValue::kHeapTag;
+            v.set_raw_str(start, static_cast<uint32_t>(len), arena_);
+            return v;
+        }
+        // Short (or huge): decode now
+        std::string decoded(len, '\0');
+        decoded.resize(utf8::unescape(start, len, decoded.data()));
+        return JsonValue(std::move(decoded));
     }
 
     /// @brief Convert a parser-internal pmr::string to a JsonValue.
@@ -530,15 +1390,8 @@ private:
         // Arena zero-copy: when temp_mr_ IS the arena and string > SSO,
         // the pmr::string's data is already in the arena. Create a JsonValue
         // pointing directly to it — no allocation, no copy.
-        if (arena_ &&
-            temp_mr_ == static_cast<std::pmr::memory_resource*>(arena_) &&
-            len > JsonValue::kSsoMax &&
-            len <= static_cast<size_t>(std::numeric_limits<uint32_t>::max())) {
-            JsonValue v;
-            v.kind_ = Type::String;
-            v.sso_len_ = JsonValue::kHeapTag;
-            v.set_arena_str(s.data(), static_cast<uint32_t>(len));
-            return v;
+        if (temp_is_arena() && can_reference(len)) {
+            return string_reference(s.data(), len);
         }
         // Non-arena or SSO: construct normally
         return JsonValue(std::string_view(s.data(), len));
@@ -547,29 +1400,35 @@ private:
     // ─── Number parsing (inline accumulation for fast integer path) ───────────
 
     JsonValue parse_number() {
+        if (JSON_UNLIKELY(opts_.number_mode == NumberMode::raw)) return parse_raw_number();
+        return convert_number();
+    }
+
+    /// @brief Parse and convert the number at ptr_ (NumberMode::convert).
+    JSON_ALWAYS_INLINE JsonValue convert_number() {
         const char* start = ptr_;
         bool negative = false;
 
         if (*ptr_ == '-') {
             negative = true;
             ++ptr_;
-            if (JSON_UNLIKELY(ptr_ >= end_))
-                error("invalid number", errc::invalid_number);
+            if (JSON_UNLIKELY(!more()))
+                return error("invalid number", errc::invalid_number);
 
             // Check for -Infinity
-            if (opts_.allow_nan_inf && *ptr_ == 'I') {
+            if (allow_nan_inf() && *ptr_ == 'I') {
                 return parse_infinity(true);
             }
         }
 
         // Hex numbers: 0x or 0X
-        if (opts_.allow_hex_numbers && *ptr_ == '0' &&
+        if (allow_hex_numbers() && *ptr_ == '0' &&
             ptr_ + 1 < end_ && (ptr_[1] == 'x' || ptr_[1] == 'X')) {
             return parse_hex_number(negative);
         }
 
         if (JSON_UNLIKELY(static_cast<unsigned>(*ptr_ - '0') > 9u)) {
-            error("invalid number", errc::invalid_number);
+            return error("invalid number", errc::invalid_number);
         }
 
         // Fast integer path — track digit count incrementally (avoids post-hoc
@@ -585,16 +1444,27 @@ private:
             int_val = static_cast<uint64_t>(*ptr_ - '0');
             ++ptr_;
             int_digits = 1;
+            // Eight digits per step (SWAR). Stopping at 19 digits means a
+            // chunk can never overflow, so no per-chunk check is needed.
+            while (int_digits <= 11 && end_ - ptr_ >= 8) {
+                const uint64_t chunk = simd::load_digits8(ptr_);
+                if (!simd::is_eight_digits(chunk)) break;
+                int_val = int_val * 100000000u + simd::parse_eight_digits(chunk);
+                ptr_ += 8;
+                int_digits += 8;
+            }
             // Precomputed constants: avoid 64-bit division on every digit
             constexpr uint64_t kOverflowThreshold = UINT64_MAX / 10;       // 1844674407370955161
             constexpr uint64_t kOverflowLastDigit = UINT64_MAX % 10;       // 5
-            while (ptr_ < end_ && static_cast<unsigned>(*ptr_ - '0') <= 9u) {
+            while (more() && static_cast<unsigned>(*ptr_ - '0') <= 9u) {
                 uint64_t digit = static_cast<uint64_t>(*ptr_ - '0');
-                if (JSON_UNLIKELY(int_val > kOverflowThreshold ||
-                                  (int_val == kOverflowThreshold && digit > kOverflowLastDigit))) {
+                // Up to 19 digits always fit; only the 20th and later can overflow
+                if (JSON_UNLIKELY(int_digits >= 19) &&
+                    (int_val > kOverflowThreshold ||
+                     (int_val == kOverflowThreshold && digit > kOverflowLastDigit))) {
                     int_overflow = true;
                     ++ptr_;
-                    while (ptr_ < end_ && static_cast<unsigned>(*ptr_ - '0') <= 9u) ++ptr_;
+                    while (more() && static_cast<unsigned>(*ptr_ - '0') <= 9u) ++ptr_;
                     break;
                 }
                 int_val = int_val * 10 + digit;
@@ -616,14 +1486,23 @@ private:
         constexpr int kMaxMantissaDigits = 19;  // max digits in uint64_t
         int total_digits = int_digits;  // reuse incrementally tracked count
 
-        if (ptr_ < end_ && *ptr_ == '.') {
+        if (more() && *ptr_ == '.') {
             is_float = true;
             ++ptr_;
-            if (JSON_UNLIKELY(ptr_ >= end_ || static_cast<unsigned>(*ptr_ - '0') > 9u)) {
-                error("expected digit after decimal point", errc::invalid_number);
+            if (JSON_UNLIKELY(!more() || static_cast<unsigned>(*ptr_ - '0') > 9u)) {
+                return error("expected digit after decimal point", errc::invalid_number);
+            }
+            // Accumulate fractional digits into mantissa, eight at a time
+            // while the result stays within kMaxMantissaDigits
+            while (total_digits <= kMaxMantissaDigits - 8 && end_ - ptr_ >= 8) {
+                const uint64_t chunk = simd::load_digits8(ptr_);
+                if (!simd::is_eight_digits(chunk)) break;
+                mantissa = mantissa * 100000000u + simd::parse_eight_digits(chunk);
+                ptr_ += 8;
+                frac_digits += 8;
+                total_digits += 8;
             }
-            // Accumulate fractional digits into mantissa
-            while (ptr_ < end_ && static_cast<unsigned>(*ptr_ - '0') <= 9u) {
+            while (more() && static_cast<unsigned>(*ptr_ - '0') <= 9u) {
                 uint64_t digit = static_cast<uint64_t>(*ptr_ - '0');
                 if (total_digits < kMaxMantissaDigits) {
                     mantissa = mantissa * 10 + digit;
@@ -636,18 +1515,18 @@ private:
             }
         }
 
-        if (ptr_ < end_ && (*ptr_ == 'e' || *ptr_ == 'E')) {
+        if (more() && (*ptr_ == 'e' || *ptr_ == 'E')) {
             is_float = true;
             ++ptr_;
             bool neg_exp = false;
-            if (ptr_ < end_ && (*ptr_ == '+' || *ptr_ == '-')) {
+            if (more() && (*ptr_ == '+' || *ptr_ == '-')) {
                 neg_exp = (*ptr_ == '-');
                 ++ptr_;
             }
-            if (JSON_UNLIKELY(ptr_ >= end_ || static_cast<unsigned>(*ptr_ - '0') > 9u)) {
-                error("expected digit in exponent", errc::invalid_number);
+            if (JSON_UNLIKELY(!more() || static_cast<unsigned>(*ptr_ - '0') > 9u)) {
+                return error("expected digit in exponent", errc::invalid_number);
             }
-            while (ptr_ < end_ && static_cast<unsigned>(*ptr_ - '0') <= 9u) {
+            while (more() && static_cast<unsigned>(*ptr_ - '0') <= 9u) {
                 explicit_exp = explicit_exp * 10 + (*ptr_ - '0');
                 if (explicit_exp > 400) explicit_exp = 400; // clamp for safety
                 ++ptr_;
@@ -660,7 +1539,7 @@ private:
                 constexpr uint64_t kMaxNeg =
                     static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1;
                 if (JSON_LIKELY(int_val <= kMaxNeg)) {
-                    return JsonValue(-static_cast<int64_t>(int_val));
+                    return JsonValue(static_cast<int64_t>(0 - int_val));  // no overflow at INT64_MIN
                 }
             } else {
                 if (JSON_LIKELY(int_val <= static_cast<uint64_t>(
@@ -675,8 +1554,10 @@ private:
         // Works when mantissa fits in uint64_t and exponent is moderate.
         if (JSON_LIKELY(!mantissa_overflow && !int_overflow)) {
             int32_t exp10 = explicit_exp - frac_digits;
-            // Common case: exp10 in [-22, +22] — exact powers of 10 in double
-            if (exp10 >= -22 && exp10 <= 22) {
+            // Clinger's fast path: mantissa and 10^|exp10| are both exact
+            // doubles, so one IEEE multiply/divide rounds correctly. A
+            // mantissa above 2^53 would round twice — leave it to Eisel-Lemire.
+            if (exp10 >= -22 && exp10 <= 22 && mantissa <= (uint64_t{1} << 53)) {
                 // Table of exact powers of 10 representable in double
                 static constexpr double kSmallPow10[] = {
                     1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
@@ -692,16 +1573,89 @@ private:
                 if (negative) d = -d;
                 return JsonValue(d);
             }
+            double d;
+            if (JSON_LIKELY(detail::eisel_lemire(mantissa, exp10, negative, d))) {
+                return JsonValue(d);
+            }
         }
 
-        // Fallback to full-precision parser (from_chars / strtod)
+        // More than 19 digits, undecided rounding or out of range
         return parse_float_slow(start);
     }
 
+    /// @brief ParseOptions::number_mode == raw: validate the number at ptr_
+    /// like parse_number() and keep its text as a Type::RawNumber. Hex
+    /// numbers and -Infinity are still converted. A token whose magnitude
+    /// may lie outside the double range is converted once to check it, so
+    /// it fails exactly as in NumberMode::convert; others never are.
+    JSON_NOINLINE JsonValue parse_raw_number() {
+        const char* start = ptr_;
+        bool negative = false;
+        if (*ptr_ == '-') {
+            negative = true;
+            ++ptr_;
+            if (JSON_UNLIKELY(!more()))
+                return error("invalid number", errc::invalid_number);
+            if (allow_nan_inf() && *ptr_ == 'I') return parse_infinity(true);
+        }
+        if (allow_hex_numbers() && *ptr_ == '0' &&
+            ptr_ + 1 < end_ && (ptr_[1] == 'x' || ptr_[1] == 'X')) {
+            return parse_hex_number(negative);
+        }
+        auto is_digit = [this] { return more() && static_cast<unsigned>(*ptr_ - '0') <= 9u; };
+        if (JSON_UNLIKELY(!is_digit())) return error("invalid number", errc::invalid_number);
+        // The value lies in [10^(exp - frac_digits), 10^(int_digits + exp))
+        // unless it is zero
+        int64_t int_digits = 0;
+        int64_t frac_digits = 0;
+        int64_t exp = 0;
+        if (*ptr_ == '0') {
+            ++ptr_;
+        } else {
+            const char* digits = ptr_;
+            while (is_digit()) ++ptr_;
+            int_digits = ptr_ - digits;
+        }
+        if (more() && *ptr_ == '.') {
+            ++ptr_;
+            if (JSON_UNLIKELY(!is_digit())) {
+                return error("expected digit after decimal point", errc::invalid_number);
+            }
+            const char* digits = ptr_;
+            while (is_digit()) ++ptr_;
+            frac_digits = ptr_ - digits;
+        }
+        if (more() && (*ptr_ == 'e' || *ptr_ == 'E')) {
+            ++ptr_;
+            bool neg_exp = false;
+            if (more() && (*ptr_ == '+' || *ptr_ == '-')) neg_exp = *ptr_++ == '-';
+            if (JSON_UNLIKELY(!is_digit())) {
+                return error("expected digit in exponent", errc::invalid_number);
+            }
+            while (is_digit()) {
+                if (exp < 100000) exp = exp * 10 + (*ptr_ - '0');
+                ++ptr_;
+            }
+            if (neg_exp) exp = -exp;
+        }
+        constexpr int64_t kSafeExp10 = 300;  // well inside DBL_MIN..DBL_MAX
+        if (JSON_UNLIKELY(int_digits + exp > kSafeExp10 || exp - frac_digits < -kSafeExp10)) {
+            const char* end = ptr_;
+            ptr_ = start;
+            (void)convert_number();
+            if (JSON_UNLIKELY(failed())) return {};
+            ptr_ = end;
+        }
+        // Stored exactly like an unescaped string value: inline, borrowed or copied
+        JsonValue v = input_string(start, static_cast<size_t>(ptr_ - start));
+        v.kind_ = Type::RawNumber;
+        return v;
+    }
+
     JSON_NOINLINE JsonValue parse_hex_number(bool negative) {
         ptr_ += 2; // skip 0x
         if (JSON_UNLIKELY(ptr_ >= end_))
-            error("incomplete hex number", errc::invalid_number);
+            return error("incomplete hex number", errc::invalid_number);
 
         uint64_t val = 0;
         bool has_digit = false;
@@ -719,327 +1673,1040 @@ private:
             } else {
                 val = (val << 4) | digit;
             }
-            ++ptr_;
+            ++ptr_;
+        }
+        if (JSON_UNLIKELY(!has_digit))
+            return error("expected hex digit", errc::invalid_number);
+        if (JSON_UNLIKELY(overflow))
+            return error("hex integer overflow", errc::integer_overflow);
+
+        if (negative) {
+            constexpr uint64_t kMaxNegAbs =
+                static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1u;
+            if (JSON_UNLIKELY(val > kMaxNegAbs))
+                return error("hex integer overflow", errc::integer_overflow);
+            if (val == kMaxNegAbs) {
+                return JsonValue(std::numeric_limits<int64_t>::min());
+            }
+            return JsonValue(-static_cast<int64_t>(val));
+        }
+        if (val <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+            return JsonValue(static_cast<int64_t>(val));
+        }
+        return JsonValue(val);
+    }
+
+    JSON_NOINLINE JsonValue parse_float_slow(const char* start) {
+        double d;
+        if (detail::parse_long_decimal(start, ptr_, d)) return JsonValue(d);
+
+        // Exact big-decimal path: rare halfway cases and range errors
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        double dbl_val = 0.0;
+        auto [p, ec] = std::from_chars(start, ptr_, dbl_val);
+        if (JSON_LIKELY(ec == std::errc{})) {
+            return JsonValue(dbl_val);
+        }
+        return error("invalid number", errc::invalid_number);
+#else
+        char buf[64];
+        size_t len = static_cast<size_t>(ptr_ - start);
+        if (JSON_LIKELY(len < sizeof(buf))) {
+            std::memcpy(buf, start, len);
+            buf[len] = '\0';
+            char* end_ptr = nullptr;
+            double dbl_val = std::strtod(buf, &end_ptr);
+            if (JSON_LIKELY(end_ptr == buf + len)) {
+                return JsonValue(dbl_val);
+            }
+        } else {
+            std::string num_str(start, ptr_);
+            char* end_ptr = nullptr;
+            double dbl_val = std::strtod(num_str.c_str(), &end_ptr);
+            if (end_ptr == num_str.c_str() + num_str.size()) {
+                return JsonValue(dbl_val);
+            }
+        }
+        return error("invalid number", errc::invalid_number);
+#endif
+    }
+
+    // ─── Array parsing ────────────────────────────────────────────────────
+
+    /// @brief Initial capacity for the container whose first element is at ptr_.
+    ///
+    /// Count-ahead heuristic: count the top-level commas in the next 512
+    /// bytes with the SIMD block scanner (simd::count_elements). Only at
+    /// shallow nesting (depth <= 2) AND remaining input > 256 bytes. For small
+    /// inputs (typical network messages ~100-150 bytes), the count-ahead scan
+    /// costs more than it saves — vector growth from 4→8 elements is cheaper
+    /// than double-scanning the entire message.
+    size_t estimate_element_count() const noexcept {
+        const size_t remaining = static_cast<size_t>(end_ - ptr_);
+        if (depth_ > 2 || remaining <= 256) return 8;
+        const size_t est = simd::count_elements(ptr_, end_, 512);
+        return est < 8 ? 8 : est;
+    }
+
+    JsonValue parse_array() {
+        ++ptr_;
+        push_depth();
+        skip_ws_and_comments();
+
+        if (JSON_UNLIKELY(ptr_ >= end_))
+            return error("unterminated array", errc::unterminated_array);
+
+        if (*ptr_ == ']') {
+            ++ptr_;
+            pop_depth();
+            return JsonValue(Array(resource_), arena_);
+        }
+
+        const size_t capacity = estimate_element_count();
+        Array arr(resource_);
+        if (JSON_UNLIKELY(opts_.packed_arrays) && opts_.number_mode == NumberMode::convert) {
+            // The first element decides whether the array is packed
+            JsonValue first = parse_value();
+            if (first.kind_ == Type::Integer) return parse_packed<int64_t>(first.u_.i, capacity);
+            if (first.kind_ == Type::Float) return parse_packed<double>(first.u_.d, capacity);
+            arr.reserve(capacity);
+            arr.push_back(std::move(first));
+        } else {
+            arr.reserve(capacity);
+            arr.push_back(parse_value());
+        }
+        return parse_array_rest(arr);
+    }
+
+    /// @brief After an array element: consume ',' (true: another element
+    /// follows) or the closing ']' (false). Also false on error.
+    bool next_array_element() {
+        skip_ws_and_comments();
+
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
+            error("unterminated array", errc::unterminated_array);
+            return false;
+        }
+
+        if (*ptr_ == ',') {
+            ++ptr_;
+            skip_ws_and_comments();
+            // Trailing comma
+            if (allow_trailing_commas() && ptr_ < end_ && *ptr_ == ']') {
+                ++ptr_;
+                pop_depth();
+                return false;
+            }
+            return true;
+        }
+        if (JSON_LIKELY(*ptr_ == ']')) {
+            ++ptr_;
+            pop_depth();
+            return false;
+        }
+        error("expected ',' or ']' in array");
+        return false;
+    }
+
+    /// @brief Parse the elements after the ones already in @p arr.
+    JsonValue parse_array_rest(Array& arr) {
+        while (next_array_element()) arr.push_back(parse_value());
+        if (JSON_UNLIKELY(failed())) return {};
+        return JsonValue(std::move(arr), arena_);
+    }
+
+    /// @brief Parse the elements after @p first into a packed int64_t[] or
+    /// double[] (ParseOptions::packed_arrays). The first element of another
+    /// kind turns the array into a regular one.
+    template <typename T>
+    JsonValue parse_packed(T first, size_t capacity) {
+        constexpr Type kind = std::is_same_v<T, double> ? Type::Float : Type::Integer;
+        std::pmr::vector<T> packed(resource_);
+        packed.reserve(capacity);
+        packed.push_back(first);
+        while (next_array_element()) {
+            JsonValue v = parse_value();
+            if (JSON_LIKELY(v.kind_ == kind)) {
+                if constexpr (kind == Type::Float) packed.push_back(v.u_.d);
+                else                               packed.push_back(v.u_.i);
+                continue;
+            }
+            Array arr(resource_);
+            arr.reserve(packed.capacity());
+            for (T x : packed) arr.emplace_back(x);
+            arr.push_back(std::move(v));
+            return parse_array_rest(arr);
+        }
+        if (JSON_UNLIKELY(failed())) return {};
+        return JsonValue::from_packed(std::move(packed), arena_);
+    }
+
+    // ─── Object parsing ──────────────────────────────────────────────────
+
+    /// @brief Check whether a character is a valid start of an unquoted key.
+    static bool is_ident_start(char c) noexcept {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+               c == '_' || c == '$';
+    }
+
+    static bool is_ident_char(char c) noexcept {
+        return is_ident_start(c) || (c >= '0' && c <= '9');
+    }
+
+    std::string_view scan_unquoted_key() {
+        const char* start = ptr_;
+        if (JSON_UNLIKELY(ptr_ >= end_ || !is_ident_start(*ptr_))) {
+            return error("expected identifier for unquoted key");
+        }
+        ++ptr_;
+        while (ptr_ < end_ && is_ident_char(*ptr_)) ++ptr_;
+        return std::string_view(start, static_cast<size_t>(ptr_ - start));
+    }
+
+    /// @brief Scan an object key (quoted, single-quoted or identifier).
+    /// The view follows scan_string() lifetime rules.
+    std::string_view scan_key() {
+        if (JSON_LIKELY(more() && *ptr_ == '"')) return scan_string();
+        if (allow_single_quotes() && ptr_ < end_ && *ptr_ == '\'') return scan_string();
+        if (allow_unquoted_keys() && ptr_ < end_ && is_ident_start(*ptr_)) {
+            return scan_unquoted_key();
+        }
+        return error("expected string key in object", errc::unterminated_object);
+    }
+
+    JsonValue parse_object() {
+        ++ptr_;
+        push_depth();
+        skip_ws_and_comments();
+
+        if (JSON_UNLIKELY(ptr_ >= end_))
+            return error("unterminated object", errc::unterminated_object);
+
+        if (*ptr_ == '}') {
+            ++ptr_;
+            pop_depth();
+            return JsonValue(Object(resource_), arena_);
+        }
+
+        Object obj(resource_);
+
+        obj.reserve(estimate_element_count());
+
+        // For detecting duplicate keys (only when disallowed),
+        // use a PMR hash set backed by temp_mr_ for O(1) lookup.
+        std::optional<SeenKeySet> seen_keys;
+        if (JSON_UNLIKELY(!allow_duplicate_keys())) {
+            seen_keys.emplace(0, detail::StringHash{}, detail::StringEqual{}, temp_mr_);
+        }
+
+        for (;;) {
+            skip_ws_and_comments();
+
+            std::string key(scan_key());
+
+            skip_ws_and_comments();
+            expect(':');
+
+            JsonValue value = parse_value();
+
+            if (JSON_LIKELY(allow_duplicate_keys())) {
+                // ── Fast path: direct emplace_back, NO duplicate checking ──
+                // Skip insert() entirely — it does linear scan for <16 entries
+                // and hash lookup for >=16. Instead, append directly and defer
+                // index building to after the closing '}'. This matches
+                // Boost.JSON's approach of batch construction.
+                obj.entries.emplace_back(std::move(key), std::move(value));
+            } else {
+                // Duplicate detection via PMR hash set with string_view.
+                if (JSON_UNLIKELY(!remember_key(*seen_keys, key))) {
+                    return error("duplicate key: \"%s\"", errc::duplicate_key, 0, 0, key);
+                }
+                obj.entries.emplace_back(std::move(key), std::move(value));
+            }
+
+            skip_ws_and_comments();
+            if (JSON_UNLIKELY(ptr_ >= end_))
+                return error("unterminated object", errc::unterminated_object);
+
+            if (*ptr_ == ',') {
+                ++ptr_;
+                skip_ws_and_comments();
+                if (allow_trailing_commas() && ptr_ < end_ && *ptr_ == '}') {
+                    ++ptr_;
+                    pop_depth();
+                    finalize_object(obj);
+                    return JsonValue(std::move(obj), arena_);
+                }
+                continue;
+            }
+            if (JSON_LIKELY(*ptr_ == '}')) {
+                ++ptr_;
+                pop_depth();
+                finalize_object(obj);
+                return JsonValue(std::move(obj), arena_);
+            }
+            return error("expected ',' or '}' in object");
+        }
+    }
+
+    using SeenKeySet = std::pmr::unordered_set<std::string_view,
+        detail::StringHash, detail::StringEqual>;
+
+    /// @brief Record @p key in @p seen; returns false if it was already there.
+    /// The key is copied into temp_mr_: views into scratch_ or into the
+    /// entries vector would not survive (short keys move on reallocation).
+    bool remember_key(SeenKeySet& seen, std::string_view key) {
+        auto* buf = static_cast<char*>(temp_mr_->allocate(key.size() + 1, 1));
+        std::memcpy(buf, key.data(), key.size());
+        return seen.emplace(std::string_view(buf, key.size())).second;
+    }
+
+    // ─── Iterative parsing (explicit frame stack) ───────────────────────────
+    //
+    // Same grammar, error messages and error positions as parse_value /
+    // parse_array / parse_object, but nesting is tracked in a frame stack
+    // allocated from temp_mr_ instead of on the native stack. Each container
+    // is created in the slot that will hold it (an array element or an
+    // object member value) and filled in place, so values are never
+    // returned by value through nested calls.
+
+    /// @brief Parse the top-level value with the core selected by ParseOptions.
+    JSON_ALWAYS_INLINE JsonValue parse_root() {
+        return opts_.iterative ? parse_value_iterative() : parse_value();
+    }
+
+    JsonValue parse_value_iterative() {
+        struct Frame {
+            JsonValue* container;            ///< Array or Object being filled
+            std::optional<SeenKeySet> seen;  ///< Duplicate detection (objects only)
+        };
+        std::pmr::vector<Frame> stack(temp_mr_);
+        stack.reserve(16);
+
+        JsonValue root;
+        JsonValue* slot = &root;  // receives the next container or top-level value
+
+        for (;;) {
+            // ── Parse the value for *slot. A non-empty container opens a
+            //    frame; its first element is then parsed like any other.
+            bool opened = false;
+            skip_ws_and_comments();
+            if (JSON_UNLIKELY(ptr_ >= end_)) return error_unexpected_end();
+            if (*ptr_ == '[') {
+                ++ptr_;
+                push_depth();
+                skip_ws_and_comments();
+                if (JSON_UNLIKELY(ptr_ >= end_))
+                    return error("unterminated array", errc::unterminated_array);
+                if (*ptr_ == ']') {
+                    ++ptr_;
+                    pop_depth();
+                    *slot = JsonValue(Array(resource_), arena_);
+                } else {
+                    Array arr(resource_);
+                    arr.reserve(estimate_element_count());
+                    *slot = JsonValue(std::move(arr), arena_);
+                    stack.push_back(Frame{slot, std::nullopt});
+                    opened = true;
+                }
+            } else if (*ptr_ == '{') {
+                ++ptr_;
+                push_depth();
+                skip_ws_and_comments();
+                if (JSON_UNLIKELY(ptr_ >= end_))
+                    return error("unterminated object", errc::unterminated_object);
+                if (*ptr_ == '}') {
+                    ++ptr_;
+                    pop_depth();
+                    *slot = JsonValue(Object(resource_), arena_);
+                } else {
+                    Object obj(resource_);
+                    obj.reserve(estimate_element_count());
+                    *slot = JsonValue(std::move(obj), arena_);
+                    Frame& f = stack.emplace_back(Frame{slot, std::nullopt});
+                    if (JSON_UNLIKELY(!allow_duplicate_keys())) {
+                        f.seen.emplace(0, detail::StringHash{}, detail::StringEqual{}, temp_mr_);
+                    }
+                    opened = true;
+                }
+            } else {
+                *slot = parse_value();
+            }
+
+            // ── Fill the innermost container. Scalars are appended directly;
+            //    a nested container gets a slot and the outer loop descends.
+            for (;;) {
+                if (stack.empty()) return root;
+                Frame& f = stack.back();
+
+                if (f.container->is_array()) {
+                    Array& arr = *f.container->u_.arr;
+                    if (!opened) {
+                        skip_ws_and_comments();
+                        if (JSON_UNLIKELY(ptr_ >= end_))
+                            return error("unterminated array", errc::unterminated_array);
+                        bool close = *ptr_ == ']';
+                        if (*ptr_ == ',') {
+                            ++ptr_;
+                            skip_ws_and_comments();
+                            // Trailing comma
+                            close = allow_trailing_commas() && ptr_ < end_ && *ptr_ == ']';
+                        } else if (JSON_UNLIKELY(!close)) {
+                            return error("expected ',' or ']' in array");
+                        }
+                        if (close) {
+                            ++ptr_;
+                            pop_depth();
+                            if (JSON_UNLIKELY(opts_.packed_arrays) &&
+                                opts_.number_mode == NumberMode::convert) {
+                                pack_if_uniform(*f.container);
+                            }
+                            stack.pop_back();
+                            continue;
+                        }
+                    }
+                    opened = false;
+                    if (ptr_ < end_ && (*ptr_ == '[' || *ptr_ == '{')) {
+                        slot = &arr.emplace_back();
+                        break;
+                    }
+                    arr.push_back(parse_value());
+                } else {
+                    Object& obj = *f.container->u_.obj;
+                    if (!opened) {
+                        if (JSON_UNLIKELY(f.seen.has_value())) {
+                            const std::string& key = obj.entries.back().first;
+                            if (JSON_UNLIKELY(!remember_key(*f.seen, key))) {
+                                return error("duplicate key: \"%s\"", errc::duplicate_key, 0, 0, key);
+                            }
+                        }
+                        skip_ws_and_comments();
+                        if (JSON_UNLIKELY(ptr_ >= end_))
+                            return error("unterminated object", errc::unterminated_object);
+                        bool close = *ptr_ == '}';
+                        if (*ptr_ == ',') {
+                            ++ptr_;
+                            skip_ws_and_comments();
+                            close = allow_trailing_commas() && ptr_ < end_ && *ptr_ == '}';
+                        } else if (JSON_UNLIKELY(!close)) {
+                            return error("expected ',' or '}' in object");
+                        }
+                        if (close) {
+                            ++ptr_;
+                            pop_depth();
+                            finalize_object(obj);
+                            stack.pop_back();
+                            continue;
+                        }
+                    }
+                    opened = false;
+                    skip_ws_and_comments();
+                    std::string key(scan_key());
+                    skip_ws_and_comments();
+                    expect(':');
+                    skip_ws_and_comments();
+                    if (ptr_ < end_ && (*ptr_ == '[' || *ptr_ == '{')) {
+                        slot = &obj.entries.emplace_back(std::move(key), JsonValue()).second;
+                        break;
+                    }
+                    obj.entries.emplace_back(std::move(key), parse_value());
+                }
+            }
+        }
+    }
+
+    /// @brief ParseOptions::packed_arrays in the iterative core: pack a
+    /// complete non-empty array whose elements are all Integer or all Float,
+    /// as parse_packed() would have.
+    void pack_if_uniform(JsonValue& v) {
+        const Array& arr = *v.u_.arr;
+        const Type kind = arr.front().kind_;
+        if (kind != Type::Integer && kind != Type::Float) return;
+        for (const JsonValue& e : arr) {
+            if (e.kind_ != kind) return;
+        }
+        if (kind == Type::Float) {
+            std::pmr::vector<double> packed(resource_);
+            packed.reserve(arr.size());
+            for (const JsonValue& e : arr) packed.push_back(e.u_.d);
+            v = JsonValue::from_packed(std::move(packed), arena_);
+        } else {
+            std::pmr::vector<int64_t> packed(resource_);
+            packed.reserve(arr.size());
+            for (const JsonValue& e : arr) packed.push_back(e.u_.i);
+            v = JsonValue::from_packed(std::move(packed), arena_);
+        }
+    }
+
+    // ─── Event-driven parsing (no DOM) ──────────────────────────────────────
+    //
+    // Mirrors parse_value/parse_array/parse_object token for token, so the
+    // accepted grammar and the error codes are identical. Scalars other than
+    // strings go through parse_value(): numbers and literals are trivially
+    // constructed JsonValues, which keeps the number semantics in one place.
+
+    template <typename Handler>
+    static constexpr bool kValidating = std::is_same_v<Handler, ValidateHandler>;
+
+    /// @brief Check the string at ptr_ (its opening quote) and move past it,
+    /// decoding nothing.
+    void check_string() {
+        const char quote = *ptr_++;
+        if (idx_ && quote == '"') {
+            if (const char* close = indexed_string_end()) {
+                ptr_ = close + 1;
+                return;
+            }
+        }
+        NullWriter sink;
+        parse_string_content_into(sink, quote);
+    }
+
+    template <typename Handler>
+    void walk_string(Handler& h) {
+        if constexpr (kValidating<Handler>) {
+            check_string();
+        } else {
+            const std::string_view sv = scan_string();
+            if (JSON_LIKELY(!failed())) h.on_string(sv);
+        }
+    }
+
+    template <typename Handler>
+    void walk_value(Handler& h) {
+        skip_ws_and_comments();
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
+            error_unexpected_end();
+            return;
+        }
+
+        switch (*ptr_) {
+            case '"':
+                walk_string(h);
+                return;
+            case '\'':
+                if (allow_single_quotes()) {
+                    walk_string(h);
+                    return;
+                }
+                error_unexpected_char();
+                return;
+            case '{': walk_object(h); return;
+            case '[': walk_array(h); return;
+            default: break;
+        }
+        const JsonValue v = parse_value();
+        if (JSON_UNLIKELY(failed())) return;
+        emit_scalar(h, v);
+    }
+
+    template <typename Handler>
+    static void emit_scalar(Handler& h, const JsonValue& v) {
+        switch (v.kind_) {
+            case Type::Null:     h.on_null(); return;
+            case Type::Bool:     h.on_bool(v.u_.b); return;
+            case Type::Integer:  h.on_int64(v.u_.i); return;
+            case Type::UInteger: h.on_uint64(v.u_.u); return;
+            case Type::Float:    h.on_double(v.u_.d); return;
+            // NumberMode::raw: handlers have no raw-number event
+            case Type::RawNumber: emit_scalar(h, v.converted_number()); return;
+            default:             return;  // unreachable: containers/strings handled above
+        }
+    }
+
+    template <typename Handler>
+    void walk_array(Handler& h) {
+        ++ptr_;
+        push_depth();
+        if (JSON_UNLIKELY(failed())) return;
+        h.start_array();
+        skip_ws_and_comments();
+
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
+            error("unterminated array", errc::unterminated_array);
+            return;
+        }
+
+        size_t count = 0;
+        if (*ptr_ == ']') {
+            ++ptr_;
+            pop_depth();
+            h.end_array(count);
+            return;
+        }
+
+        for (;;) {
+            walk_value(h);
+            ++count;
+            skip_ws_and_comments();
+
+            if (JSON_UNLIKELY(ptr_ >= end_)) {
+                error("unterminated array", errc::unterminated_array);
+                return;
+            }
+
+            if (*ptr_ == ',') {
+                ++ptr_;
+                skip_ws_and_comments();
+                if (allow_trailing_commas() && ptr_ < end_ && *ptr_ == ']') {
+                    ++ptr_;
+                    pop_depth();
+                    h.end_array(count);
+                    return;
+                }
+                continue;
+            }
+            if (JSON_LIKELY(*ptr_ == ']')) {
+                ++ptr_;
+                pop_depth();
+                h.end_array(count);
+                return;
+            }
+            error("expected ',' or ']' in array");
+            return;
+        }
+    }
+
+    template <typename Handler>
+    void walk_object(Handler& h) {
+        ++ptr_;
+        push_depth();
+        if (JSON_UNLIKELY(failed())) return;
+        h.start_object();
+        skip_ws_and_comments();
+
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
+            error("unterminated object", errc::unterminated_object);
+            return;
+        }
+
+        size_t count = 0;
+        if (*ptr_ == '}') {
+            ++ptr_;
+            pop_depth();
+            h.end_object(count);
+            return;
+        }
+
+        // Duplicate detection needs stable key storage: views may point into
+        // scratch_, so keys are copied into temp_mr_ (only when disallowed).
+        std::optional<SeenKeySet> seen_keys;
+        if (JSON_UNLIKELY(!allow_duplicate_keys())) {
+            seen_keys.emplace(0, detail::StringHash{}, detail::StringEqual{}, temp_mr_);
+        }
+
+        for (;;) {
+            skip_ws_and_comments();
+            std::string_view key;
+            if constexpr (kValidating<Handler>) {
+                // Nobody reads the key unless duplicates are checked
+                if (!seen_keys && more() && *ptr_ == '"') check_string();
+                else key = scan_key();
+            } else {
+                key = scan_key();
+            }
+            if (JSON_UNLIKELY(failed())) return;
+            std::string_view stored_key;
+            if (JSON_UNLIKELY(seen_keys.has_value())) {
+                auto* buf = static_cast<char*>(temp_mr_->allocate(key.size() + 1, 1));
+                std::memcpy(buf, key.data(), key.size());
+                stored_key = std::string_view(buf, key.size());
+            }
+            h.on_key(key);
+
+            skip_ws_and_comments();
+            expect(':');
+            walk_value(h);
+            ++count;
+
+            if (JSON_UNLIKELY(seen_keys.has_value())) {
+                if (JSON_UNLIKELY(!seen_keys->emplace(stored_key).second)) {
+                    error("duplicate key: \"%s\"", errc::duplicate_key, 0, 0, stored_key);
+                    return;
+                }
+            }
+
+            skip_ws_and_comments();
+            if (JSON_UNLIKELY(ptr_ >= end_)) {
+                error("unterminated object", errc::unterminated_object);
+                return;
+            }
+
+            if (*ptr_ == ',') {
+                ++ptr_;
+                skip_ws_and_comments();
+                if (allow_trailing_commas() && ptr_ < end_ && *ptr_ == '}') {
+                    ++ptr_;
+                    pop_depth();
+                    h.end_object(count);
+                    return;
+                }
+                continue;
+            }
+            if (JSON_LIKELY(*ptr_ == '}')) {
+                ++ptr_;
+                pop_depth();
+                h.end_object(count);
+                return;
+            }
+            error("expected ',' or '}' in object");
+            return;
+        }
+    }
+
+    // ─── Selective extraction ───────────────────────────────────────────────
+    //
+    // Follows parse_object/parse_array token for token at the levels a
+    // pointer passes through; everything else is skipped with skip_value().
+
+    /// @brief Skip one value at ptr_ without building it.
+    ///
+    /// Containers are passed 64 bytes at a time by simd::skip_container
+    /// unless comments or single quotes are enabled; the byte loop below
+    /// handles those and reports errors. Scalars run to the next structural
+    /// character. Only string termination and bracket balance are checked.
+    void skip_value() {
+        skip_ws_and_comments();
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
+            error_unexpected_end();
+            return;
+        }
+        const char open = *ptr_;
+        if ((open == '{' || open == '[') && !allow_comments() && !allow_single_quotes()) {
+            if (const char* after = simd::skip_container(ptr_, end_); JSON_LIKELY(after)) {
+                ptr_ = after;
+                return;
+            }
+        }
+        if (open != '{' && open != '[') {
+            if (open == '"' || (open == '\'' && allow_single_quotes())) {
+                skip_string();
+                return;
+            }
+            const char* start = ptr_;
+            while (ptr_ < end_) {
+                const char d = *ptr_;
+                if (d == ',' || d == ']' || d == '}' || d == ':' ||
+                    static_cast<unsigned char>(d) <= ' ' || (d == '/' && allow_comments())) {
+                    break;
+                }
+                ++ptr_;
+            }
+            if (JSON_UNLIKELY(ptr_ == start)) error_unexpected_char();
+            return;
         }
-        if (JSON_UNLIKELY(!has_digit))
-            error("expected hex digit", errc::invalid_number);
-        if (JSON_UNLIKELY(overflow))
-            error("hex integer overflow", errc::integer_overflow);
-
-        if (negative) {
-            constexpr uint64_t kMaxNegAbs =
-                static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1u;
-            if (JSON_UNLIKELY(val > kMaxNegAbs))
-                error("hex integer overflow", errc::integer_overflow);
-            if (val == kMaxNegAbs) {
-                return JsonValue(std::numeric_limits<int64_t>::min());
+        size_t depth = 0;
+        while (ptr_ < end_) {
+            const char d = *ptr_;
+            if (d == '"' || (d == '\'' && allow_single_quotes())) {
+                skip_string();
+                continue;
             }
-            return JsonValue(-static_cast<int64_t>(val));
+            if (d == '{' || d == '[') {
+                ++depth;
+            } else if (d == '}' || d == ']') {
+                if (--depth == 0) {
+                    ++ptr_;
+                    return;
+                }
+            } else if (d == '/' && allow_comments()) {
+                const char* before = ptr_;
+                skip_comments();
+                if (ptr_ != before) continue;
+            }
+            ++ptr_;
         }
-        if (val <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
-            return JsonValue(static_cast<int64_t>(val));
+        if (open == '{') {
+            error("unterminated object", errc::unterminated_object);
+            return;
         }
-        return JsonValue(val);
+        error("unterminated array", errc::unterminated_array);
     }
 
-    JSON_NOINLINE JsonValue parse_float_slow(const char* start) {
-#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
-        double dbl_val = 0.0;
-        auto [p, ec] = std::from_chars(start, ptr_, dbl_val);
-        if (JSON_LIKELY(ec == std::errc{})) {
-            return JsonValue(dbl_val);
-        }
-        error("invalid number", errc::invalid_number);
-#else
-        char buf[64];
-        size_t len = static_cast<size_t>(ptr_ - start);
-        if (JSON_LIKELY(len < sizeof(buf))) {
-            std::memcpy(buf, start, len);
-            buf[len] = '\0';
-            char* end_ptr = nullptr;
-            double dbl_val = std::strtod(buf, &end_ptr);
-            if (JSON_LIKELY(end_ptr == buf + len)) {
-                return JsonValue(dbl_val);
+    /// @brief ptr_ at an opening quote; moves one past the closing quote.
+    void skip_string() {
+        const char quote = *ptr_++;
+        for (;;) {
+            if (quote == '"') {
+                ptr_ = simd::find_string_delimiter(ptr_, end_);
+            } else {
+                while (ptr_ < end_ && *ptr_ != quote && *ptr_ != '\\') ++ptr_;
             }
-        } else {
-            std::string num_str(start, ptr_);
-            char* end_ptr = nullptr;
-            double dbl_val = std::strtod(num_str.c_str(), &end_ptr);
-            if (end_ptr == num_str.c_str() + num_str.size()) {
-                return JsonValue(dbl_val);
+            if (JSON_UNLIKELY(ptr_ >= end_)) {
+                error("unterminated string", errc::unterminated_string);
+                return;
+            }
+            if (*ptr_ == quote) {
+                ++ptr_;
+                return;
             }
+            ptr_ += 2;  // backslash + escaped character
         }
-        error("invalid number", errc::invalid_number);
-#endif
     }
 
-    // ─── Array parsing ────────────────────────────────────────────────────
+    template <typename Trie, typename Slots>
+    void extract_value(const Trie& trie, uint32_t node, Slots& slots) {
+        skip_ws_and_comments();
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
+            error_unexpected_end();
+            return;
+        }
+        trie.enter(node, slots);
+        if (trie.terminal(node)) {
+            trie.found(node, parse_root(), slots);
+        } else if (*ptr_ == '{') {
+            extract_object(trie, node, slots);
+        } else if (*ptr_ == '[') {
+            extract_array(trie, node, slots);
+        } else {
+            skip_value();
+        }
+    }
 
-    JsonValue parse_array() {
+    template <typename Trie, typename Slots>
+    void extract_array(const Trie& trie, uint32_t node, Slots& slots) {
         ++ptr_;
         push_depth();
         skip_ws_and_comments();
 
-        if (JSON_UNLIKELY(ptr_ >= end_))
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
             error("unterminated array", errc::unterminated_array);
-
+            return;
+        }
         if (*ptr_ == ']') {
             ++ptr_;
             pop_depth();
-            return JsonValue(Array(resource_), arena_);
-        }
-
-        Array arr(resource_);
-
-        // ── Count-ahead heuristic: estimate array size from commas ───────
-        // Only at shallow nesting (depth <= 2) AND remaining input > 256 bytes.
-        // For small inputs (typical network messages ~100-150 bytes), the
-        // count-ahead scan costs more than it saves — vector growth from 4→8
-        // elements is cheaper than double-scanning the entire message.
-        const size_t remaining = static_cast<size_t>(end_ - ptr_);
-        if (depth_ <= 2 && remaining > 256) {
-            int est = 1;
-            int depth_scan = 0;
-            const size_t scan_max = remaining < 512 ? remaining : 512;
-            for (size_t i = 0; i < scan_max; ++i) {
-                char ch = ptr_[i];
-                if (ch == '{' || ch == '[') ++depth_scan;
-                else if (ch == '}' || ch == ']') {
-                    if (depth_scan == 0) break;
-                    --depth_scan;
-                }
-                else if (ch == ',' && depth_scan == 0) ++est;
-                else if (ch == '"') {
-                    for (++i; i < scan_max && ptr_[i] != '"'; ++i) {
-                        if (ptr_[i] == '\\') ++i;
-                    }
-                }
-            }
-            arr.reserve(static_cast<size_t>(est < 8 ? 8 : est));
-        } else {
-            arr.reserve(8);
+            return;
         }
 
-        for (;;) {
-            arr.push_back(parse_value());
+        for (size_t index = 0;; ++index) {
+            const uint32_t child = trie.element(node, index);
+            if (child != Trie::kNoNode) extract_value(trie, child, slots);
+            else skip_value();
             skip_ws_and_comments();
 
-            if (JSON_UNLIKELY(ptr_ >= end_))
+            if (JSON_UNLIKELY(ptr_ >= end_)) {
                 error("unterminated array", errc::unterminated_array);
+                return;
+            }
 
             if (*ptr_ == ',') {
                 ++ptr_;
                 skip_ws_and_comments();
-                // Trailing comma
-                if (opts_.allow_trailing_commas && ptr_ < end_ && *ptr_ == ']') {
+                if (allow_trailing_commas() && ptr_ < end_ && *ptr_ == ']') {
                     ++ptr_;
                     pop_depth();
-                    return JsonValue(std::move(arr), arena_);
+                    return;
                 }
                 continue;
             }
             if (JSON_LIKELY(*ptr_ == ']')) {
                 ++ptr_;
                 pop_depth();
-                return JsonValue(std::move(arr), arena_);
+                return;
             }
             error("expected ',' or ']' in array");
+            return;
         }
     }
 
-    // ─── Object parsing ──────────────────────────────────────────────────
-
-    /// @brief Check whether a character is a valid start of an unquoted key.
-    static bool is_ident_start(char c) noexcept {
-        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
-               c == '_' || c == '$';
-    }
-
-    static bool is_ident_char(char c) noexcept {
-        return is_ident_start(c) || (c >= '0' && c <= '9');
-    }
-
-    std::string parse_unquoted_key() {
-        const char* start = ptr_;
-        if (JSON_UNLIKELY(ptr_ >= end_ || !is_ident_start(*ptr_))) {
-            error("expected identifier for unquoted key");
-        }
-        ++ptr_;
-        while (ptr_ < end_ && is_ident_char(*ptr_)) ++ptr_;
-        return std::string(start, static_cast<size_t>(ptr_ - start));
-    }
-
-    JsonValue parse_object() {
+    template <typename Trie, typename Slots>
+    void extract_object(const Trie& trie, uint32_t node, Slots& slots) {
         ++ptr_;
         push_depth();
         skip_ws_and_comments();
 
-        if (JSON_UNLIKELY(ptr_ >= end_))
+        if (JSON_UNLIKELY(ptr_ >= end_)) {
             error("unterminated object", errc::unterminated_object);
-
+            return;
+        }
         if (*ptr_ == '}') {
             ++ptr_;
             pop_depth();
-            return JsonValue(Object(resource_), arena_);
-        }
-
-        Object obj(resource_);
-
-        // ── Count-ahead heuristic: estimate object size from commas ──────
-        // Only at shallow nesting (depth <= 2) AND remaining input > 256 bytes.
-        // For small inputs (typical network messages ~100-150 bytes), skip
-        // the pre-scan — it costs more than letting vector grow naturally.
-        const size_t obj_remaining = static_cast<size_t>(end_ - ptr_);
-        if (depth_ <= 2 && obj_remaining > 256) {
-            int est = 1;
-            int depth_scan = 0;
-            const size_t scan_max = obj_remaining < 512 ? obj_remaining : 512;
-            for (size_t i = 0; i < scan_max; ++i) {
-                char ch = ptr_[i];
-                if (ch == '{' || ch == '[') ++depth_scan;
-                else if (ch == '}' || ch == ']') {
-                    if (depth_scan == 0) break;
-                    --depth_scan;
-                }
-                else if (ch == ',' && depth_scan == 0) ++est;
-                else if (ch == '"') {
-                    for (++i; i < scan_max && ptr_[i] != '"'; ++i) {
-                        if (ptr_[i] == '\\') ++i;
-                    }
-                }
-            }
-            obj.reserve(static_cast<size_t>(est < 8 ? 8 : est));
-        } else {
-            obj.reserve(8);
-        }
-
-        // For detecting duplicate keys (only when disallowed),
-        // use a PMR hash set backed by temp_mr_ for O(1) lookup.
-        using seen_set_t = std::pmr::unordered_set<std::string_view,
-            detail::StringHash, detail::StringEqual>;
-        std::optional<seen_set_t> seen_keys;
-        if (JSON_UNLIKELY(!opts_.allow_duplicate_keys)) {
-            seen_keys.emplace(0, detail::StringHash{}, detail::StringEqual{}, temp_mr_);
+            return;
         }
 
         for (;;) {
             skip_ws_and_comments();
-
-            // Parse key
-            std::string key;
-            if (ptr_ < end_ && *ptr_ == '"') {
-                key = parse_string();
-            } else if (opts_.allow_single_quotes && ptr_ < end_ && *ptr_ == '\'') {
-                key = parse_string_sq();
-            } else if (opts_.allow_unquoted_keys && ptr_ < end_ && is_ident_start(*ptr_)) {
-                key = parse_unquoted_key();
-            } else {
-                error("expected string key in object", errc::unterminated_object);
-            }
-
+            // The key view may live in scratch_: match it before the value
+            const uint32_t child = trie.child(node, scan_key());
             skip_ws_and_comments();
             expect(':');
-
-            JsonValue value = parse_value();
-
-            if (JSON_LIKELY(opts_.allow_duplicate_keys)) {
-                // ── Fast path: direct emplace_back, NO duplicate checking ──
-                // Skip insert() entirely — it does linear scan for <16 entries
-                // and hash lookup for >=16. Instead, append directly and defer
-                // index building to after the closing '}'. This matches
-                // Boost.JSON's approach of batch construction.
-                obj.entries.emplace_back(std::move(key), std::move(value));
-            } else {
-                // Duplicate detection via PMR hash set with string_view.
-                obj.entries.emplace_back(std::move(key), std::move(value));
-                auto [it, inserted] = seen_keys->emplace(
-                    std::string_view(obj.entries.back().first));
-                if (JSON_UNLIKELY(!inserted)) {
-                    std::string dup_key(obj.entries.back().first);
-                    obj.entries.pop_back();
-                    error("duplicate key: \"" + dup_key + "\"", errc::duplicate_key);
-                }
-            }
+            if (child != Trie::kNoNode) extract_value(trie, child, slots);
+            else skip_value();
 
             skip_ws_and_comments();
-            if (JSON_UNLIKELY(ptr_ >= end_))
+            if (JSON_UNLIKELY(ptr_ >= end_)) {
                 error("unterminated object", errc::unterminated_object);
+                return;
+            }
 
             if (*ptr_ == ',') {
                 ++ptr_;
                 skip_ws_and_comments();
-                if (opts_.allow_trailing_commas && ptr_ < end_ && *ptr_ == '}') {
+                if (allow_trailing_commas() && ptr_ < end_ && *ptr_ == '}') {
                     ++ptr_;
                     pop_depth();
-                    finalize_object(obj);
-                    return JsonValue(std::move(obj), arena_);
+                    return;
                 }
                 continue;
             }
             if (JSON_LIKELY(*ptr_ == '}')) {
                 ++ptr_;
                 pop_depth();
-                finalize_object(obj);
-                return JsonValue(std::move(obj), arena_);
+                return;
             }
             error("expected ',' or '}' in object");
+            return;
         }
     }
+};
 
-    /// @brief Finalize a parsed object: build hash index and dedup if needed.
-    ///
-    /// Called once after the closing '}' instead of per-entry insert().
-    /// For large objects (>= kIndexThreshold): builds the hash index in a
-    /// single pass. The index naturally maps to the last occurrence of each
-    /// key, providing "last-value-wins" semantics.
-    /// If duplicates exist (index_.size() < entries.size()), compacts the
-    /// entries vector to remove earlier duplicates.
+/// @brief Parser entry points: select a BasicParser instantiation once per
+/// call (see with_parser_policy) and forward to it.
+class Parser : public ParserBase {
+public:
+    /// @brief Parse a JSON string (see BasicParser::parse for @p ec).
+    [[nodiscard]] static JsonValue parse(std::string_view input,
+                                         const ParseOptions& opts = {},
+                                         std::error_code* ec = nullptr) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse(input, opts, ec);
+        });
+    }
+
+    /// @brief Parse @p input, which is followed by YAJSON_PADDING readable
+    /// bytes whose first byte is NUL (see PaddedStringView).
+    [[nodiscard]] static JsonValue parse_padded(std::string_view input,
+                                                const ParseOptions& opts = {},
+                                                std::error_code* ec = nullptr) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<PaddedInput<decltype(policy)>>::parse(input, opts, ec);
+        });
+    }
+
+    /// @brief See BasicParser::parse_with_scratch.
+    [[nodiscard]] static JsonValue parse_with_scratch(std::string_view input,
+                                                      const ParseOptions& opts,
+                                                      std::pmr::memory_resource& scratch,
+                                                      std::error_code* ec = nullptr) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse_with_scratch(input, opts, scratch, ec);
+        });
+    }
+
+    /// @brief See BasicParser::parse_at.
+    [[nodiscard]] static JsonValue parse_at(std::string_view input, const ParseOptions& opts,
+                                            std::pmr::memory_resource& scratch,
+                                            const SourceLocation& origin) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse_at(input, opts, scratch, origin);
+        });
+    }
+
+    /// @brief See BasicParser::parse_batch.
+    static size_t parse_batch(const std::string_view* inputs, size_t count,
+                              const ParseOptions& opts, result<JsonValue>* out) noexcept {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse_batch(inputs, count, opts, out);
+        });
+    }
+
+    /// @brief Parse a JSON string (no exceptions, error_code).
     ///
-    /// For small objects (< kIndexThreshold): does a lightweight O(n²)
-    /// reverse-dedup (n < 16, at most ~120 comparisons).
-    void finalize_object(Object& obj) {
-        auto& entries = obj.entries;
-        const size_t n = entries.size();
+    /// Syntax errors take the error-code path of the parser: no ParseError
+    /// is built or thrown, and no message or line/column is computed. Only
+    /// failures outside the grammar (bad_alloc) are caught.
+    [[nodiscard]] static result<JsonValue> try_parse(
+            std::string_view input, const ParseOptions& opts = {}) noexcept {
+        return capture([&](std::error_code* ec) { return parse(input, opts, ec); });
+    }
 
-        if (n >= Object::kIndexThreshold) {
-            // Build hash index (single pass). (*index_)[key] = i iterates
-            // forward, so the last index for each key wins.
-            obj.rebuild_index();
+    /// @brief try_parse() over parse_padded().
+    [[nodiscard]] static result<JsonValue> try_parse_padded(
+            std::string_view input, const ParseOptions& opts = {}) noexcept {
+        return capture([&](std::error_code* ec) { return parse_padded(input, opts, ec); });
+    }
 
-            // Check for duplicates: index has fewer entries than the vector.
-            if (obj.index_->size() < n) {
-                // Compact: keep only entries whose index matches their position.
-                size_t write = 0;
-                for (size_t i = 0; i < entries.size(); ++i) {
-                    auto it = obj.index_->find(std::string_view(entries[i].first));
-                    if (it->second == i) {
-                        if (write != i) entries[write] = std::move(entries[i]);
-                        ++write;
-                    }
-                }
-                entries.resize(write);
-                // Re-index after compaction (indices changed).
-                obj.rebuild_index();
-            }
-        } else if (n >= 2) {
-            // Small object: O(n²) dedup, last-value-wins (n < 16).
-            // For the common case (no duplicates): inner loop finds no matches.
-            for (size_t i = 0; i < entries.size(); ) {
-                bool has_later_dup = false;
-                for (size_t j = i + 1; j < entries.size(); ++j) {
-                    if (entries[i].first == entries[j].first) {
-                        has_later_dup = true;
-                        break;
-                    }
-                }
-                if (JSON_UNLIKELY(has_later_dup)) {
-                    entries.erase(entries.begin() + static_cast<ptrdiff_t>(i));
-                } else {
-                    ++i;
-                }
-            }
+    /// @brief Run @p fn (a parse taking std::error_code*) as a try_* call.
+    template <typename Fn>
+    static result<JsonValue> capture(Fn&& fn) noexcept {
+        std::error_code ec;
+        try {
+            JsonValue v = fn(&ec);
+            return {std::move(v), ec};
+        } catch (const ParseError& e) {
+            return {JsonValue{}, e.code()};
+        } catch (...) {
+            return {JsonValue{}, make_error_code(errc::unexpected_character)};
         }
     }
+
+    /// @brief See BasicParser::parse_insitu.
+    [[nodiscard]] static JsonValue parse_insitu(char* buf, size_t len,
+                                                const ParseOptions& opts = {},
+                                                std::error_code* ec = nullptr) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse_insitu(buf, len, opts, ec);
+        });
+    }
+
+    /// @brief See BasicParser::parse_subrange.
+    [[nodiscard]] static JsonValue parse_subrange(const char* doc_begin, const char* first,
+                                                  const char* last, const ParseOptions& opts) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse_subrange(doc_begin, first, last, opts);
+        });
+    }
+
+    /// @brief See BasicParser::parse_array_chunk.
+    static void parse_array_chunk(const char* doc_begin, const char* first, const char* last,
+                                  bool final_chunk, bool after_comma,
+                                  const ParseOptions& opts, Array& out) {
+        with_parser_policy(opts, [&](auto policy) {
+            BasicParser<decltype(policy)>::parse_array_chunk(doc_begin, first, last, final_chunk,
+                                                             after_comma, opts, out);
+        });
+    }
+
+    /// @brief See BasicParser::parse_token_events.
+    template <typename Handler>
+    static const char* parse_token_events(const char* text_begin, const char* first,
+                                          const char* last, bool key, Handler& handler,
+                                          const ParseOptions& opts,
+                                          const SourceLocation& origin) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::parse_token_events(
+                text_begin, first, last, key, handler, opts, origin);
+        });
+    }
+
+    /// @brief See BasicParser::parse_events.
+    template <typename Handler>
+    static void parse_events(std::string_view input, Handler& handler,
+                             const ParseOptions& opts = {},
+                             std::error_code* ec = nullptr) {
+        with_parser_policy(opts, [&](auto policy) {
+            BasicParser<decltype(policy)>::parse_events(input, handler, opts, ec);
+        });
+    }
+
+    /// @brief See BasicParser::validate.
+    [[nodiscard]] static result<void> validate(std::string_view input,
+                                               const ParseOptions& opts) {
+        return with_parser_policy(opts, [&](auto policy) {
+            return BasicParser<decltype(policy)>::validate(input, opts);
+        });
+    }
+
+    /// @brief See BasicParser::extract.
+    template <typename Trie, typename Slots>
+    static void extract(std::string_view input, const ParseOptions& opts,
+                        const Trie& trie, Slots& slots) {
+        with_parser_policy(opts, [&](auto policy) {
+            BasicParser<decltype(policy)>::extract(input, opts, trie, slots);
+        });
+    }
 };
 
 } // namespace detail
@@ -1068,4 +2735,74 @@ private:
     return detail::Parser::try_parse(input, opts);
 }
 
+/// @brief Parse JSON in place, overwriting @p buf.
+///
+/// Strings with escapes are decoded over their own bytes (the decoded form
+/// is never longer), so no temporary string builder is used. String values
+/// longer than SSO are views into @p buf, as with
+/// ParseOptions::borrow_strings: @p buf must outlive the result. Object keys
+/// are copied. After the call the contents of @p buf are unspecified, also
+/// on error; error offsets are exact, but lines and columns are counted
+/// over the partially decoded buffer. structural_index is ignored.
+/// @throws ParseError on invalid JSON.
+[[nodiscard]] inline JsonValue parse_insitu(char* buf, size_t len,
+                                            const ParseOptions& opts = {}) {
+    return detail::Parser::parse_insitu(buf, len, opts);
+}
+
+/// @brief Parse JSON in place (no exceptions); see parse_insitu.
+[[nodiscard]] inline result<JsonValue> try_parse_insitu(char* buf, size_t len,
+                                                        const ParseOptions& opts = {}) noexcept {
+    return detail::Parser::capture([&](std::error_code* ec) {
+        return detail::Parser::parse_insitu(buf, len, opts, ec);
+    });
+}
+
+/// @brief Check that @p input is valid JSON under @p opts without building
+/// a value (no exceptions).
+///
+/// Accepts exactly what try_parse() accepts and reports the same error code,
+/// plus the error location. Strings are checked without being decoded, by
+/// the same scan the parser uses, and nothing is allocated, except key
+/// copies when allow_duplicate_keys is off; if those cannot be allocated,
+/// the error is std::errc::not_enough_memory. With
+/// ParseOptions::validate_utf8 the input is also checked to be UTF-8.
+[[nodiscard]] inline result<void> validate(std::string_view input,
+                                           const ParseOptions& opts = {}) noexcept {
+    try {
+        return detail::Parser::validate(input, opts);
+    } catch (...) {
+        return {std::make_error_code(std::errc::not_enough_memory), {}};
+    }
+}
+
+/// @brief Find the end of the JSON value at @p p without parsing it.
+///
+/// Leading whitespace is skipped. Objects and arrays are passed 64 bytes at
+/// a time with SIMD quote/backslash/bracket masks (detail::simd::skip_container),
+/// strings with the SIMD delimiter search, and scalars up to the next
+/// structural character or whitespace. Only strict JSON is understood
+/// (double-quoted strings, no comments) and the value is not validated.
+/// @return One past the value's last byte, or nullptr if no value starts
+///         at @p p or the input ends inside a string or container.
+[[nodiscard]] inline const char* skip_value(const char* p, const char* end) noexcept {
+    p = detail::simd::skip_whitespace(p, end);
+    if (p >= end) return nullptr;
+    if (*p == '{' || *p == '[') return detail::simd::skip_container(p, end);
+    if (*p == '"') {
+        for (++p;;) {
+            p = detail::simd::find_string_delimiter(p, end);
+            if (p >= end) return nullptr;
+            if (*p == '"') return p + 1;
+            p += 2;  // backslash + escaped character
+        }
+    }
+    const char* start = p;
+    while (p < end && *p != ',' && *p != ']' && *p != '}' && *p != ':' &&
+           static_cast<unsigned char>(*p) > ' ') {
+        ++p;
+    }
+    return p == start ? nullptr : p;
+}
+
 } // namespace yajson
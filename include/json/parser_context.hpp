@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file parser_context.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Reusable parser scratch state for high-rate parsing of many documents.
+///
+/// Every yajson::parse() call sets up a fresh 4 KB stack resource for parser
+/// temporaries (decoded escaped strings, duplicate-key sets, the iterative
+/// frame stack, the structural index window) and spills to the heap when a
+/// document needs more. A ParserContext owns that scratch memory and keeps
+/// it across calls, growing it to the high-water mark, so after warm-up a
+/// parse performs no scratch allocations at all:
+///
+/// @code
+///   thread_local yajson::ParserContext ctx;   // one per thread
+///   for (auto msg : messages) {
+///       auto v = ctx.parse(msg);               // scratch reused, not reallocated
+///       handle(v);
+///   }
+/// @endcode
+///
+/// Combine with ArenaScope (or parse into an ArenaDocument-style arena) to
+/// also remove the allocations of the resulting tree; the context then only
+/// supplies the structural index window, since arena parsing keeps its
+/// temporaries in the arena. Values returned by parse() never point into
+/// the context. A context is not thread-safe.
+
+#include "arena.hpp"
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace yajson {
+
+/// @brief Scratch memory for the parser, retained between parse() calls.
+class ParserContext {
+public:
+    /// Default initial scratch size; grows to fit the largest document seen.
+    static constexpr size_t kDefaultScratchSize = 16 * 1024;
+
+    explicit ParserContext(size_t scratch_size = kDefaultScratchSize)
+        : scratch_(std::make_unique<detail::BufferedArena>(scratch_size < 256 ? 256 : scratch_size)) {}
+
+    ParserContext(ParserContext&&) noexcept = default;
+    ParserContext& operator=(ParserContext&&) noexcept = default;
+    ParserContext(const ParserContext&) = delete;
+    ParserContext& operator=(const ParserContext&) = delete;
+
+    /// @brief Parse a JSON string (same result and errors as yajson::parse()).
+    /// @throws ParseError on invalid JSON.
+    [[nodiscard]] JsonValue parse(std::string_view input, const ParseOptions& opts = {}) {
+        detail::rewind_or_grow(scratch_);
+        return detail::Parser::parse_with_scratch(input, opts, scratch_->arena);
+    }
+
+    /// @brief Parse a JSON string (no exceptions, error_code).
+    [[nodiscard]] result<JsonValue> try_parse(std::string_view input,
+                                              const ParseOptions& opts = {}) noexcept {
+        return detail::Parser::capture([&](std::error_code* ec) {
+            detail::rewind_or_grow(scratch_);
+            return detail::Parser::parse_with_scratch(input, opts, scratch_->arena, ec);
+        });
+    }
+
+    /// @brief Current size of the retained scratch buffer in bytes.
+    [[nodiscard]] size_t scratch_capacity() const noexcept { return scratch_->size; }
+
+    /// @brief Scratch bytes used by the most recent parse().
+    [[nodiscard]] size_t scratch_used() const noexcept { return scratch_->arena.bytes_used(); }
+
+private:
+    std::unique_ptr<detail::BufferedArena> scratch_;
+};
+
+} // namespace yajson
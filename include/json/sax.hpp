@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file sax.hpp
+/// @author Aleksandr Loshkarev
+/// @brief SAX-style event parsing: drive a user handler without building a DOM.
+///
+/// The input-side counterpart of JsonWriter. The parser calls back into a
+/// handler for every token; no JsonValue nodes are allocated.
+///
+/// @code
+///   struct CountStrings : yajson::SaxHandler {
+///       size_t n = 0;
+///       void on_string(std::string_view) { ++n; }
+///   };
+///   CountStrings h;
+///   yajson::parse_sax(R"({"a":["x","y"]})", h);   // h.n == 2
+/// @endcode
+///
+/// Handler interface (all callbacks are required; derive from SaxHandler
+/// to get no-op defaults and override only what you need):
+///   on_null(), on_bool(bool), on_int64(int64_t), on_uint64(uint64_t),
+///   on_double(double), on_string(std::string_view), on_key(std::string_view),
+///   start_object(), end_object(size_t members),
+///   start_array(),  end_array(size_t elements)
+///
+/// Calls are dispatched statically (the handler is a template parameter), so
+/// SaxHandler's members need not be virtual and unused callbacks cost nothing.
+///
+/// String views point directly into the input when the string contains no
+/// escape sequences; otherwise they point into a scratch buffer holding the
+/// decoded text. In both cases a view is only valid during its callback.
+///
+/// The accepted grammar, ParseOptions handling and error codes are exactly
+/// those of yajson::parse(). Events already delivered before a syntax error
+/// are not retracted.
+
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+namespace yajson {
+
+/// @brief Base class with no-op callbacks for SAX handlers.
+struct SaxHandler {
+    void on_null() {}
+    void on_bool(bool) {}
+    void on_int64(int64_t) {}
+    void on_uint64(uint64_t) {}
+    void on_double(double) {}
+    void on_string(std::string_view) {}
+    void on_key(std::string_view) {}
+    void start_object() {}
+    void end_object(size_t) {}
+    void start_array() {}
+    void end_array(size_t) {}
+};
+
+/// @brief Parse JSON and report it as events to @p handler.
+/// @throws ParseError on invalid JSON.
+template <typename Handler>
+inline void parse_sax(std::string_view input, Handler& handler,
+                      const ParseOptions& opts = {}) {
+    detail::Parser::parse_events(input, handler, opts);
+}
+
+/// @brief Parse JSON into handler events (no exceptions from the parser).
+/// Exceptions thrown by the handler itself propagate unchanged.
+template <typename Handler>
+[[nodiscard]] inline std::error_code try_parse_sax(std::string_view input, Handler& handler,
+                                                   const ParseOptions& opts = {}) {
+    std::error_code ec;
+    detail::Parser::parse_events(input, handler, opts, &ec);
+    return ec;
+}
+
+} // namespace yajson
@@ -23,6 +23,8 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 namespace yajson {
 
@@ -211,6 +213,7 @@ public:
 
     void serialize(const JsonValue& value) {
         current_indent_ = 0;
+        depth_ = 0;
         write_value(value);
     }
 
@@ -218,6 +221,7 @@ private:
     Output& out_;
     const SerializeOptions& opts_;
     int current_indent_ = 0;
+    size_t depth_ = 0;  // containers entered by write_value (see write_deep)
 
     // Pre-built indent buffer (256 spaces) for bulk write.
     // Covers indent depths up to 256 in a single write() call.
@@ -275,18 +279,118 @@ private:
             case Type::Float:
                 write_float(v.as_float());
                 break;
+            case Type::RawNumber: {
+                // Original token text: byte-exact, no dtoa
+                const std::string_view t = v.as_raw_number();
+                out_.write(t.data(), t.size());
+                break;
+            }
             case Type::String:
-                write_string(v.as_string_view());
+                if constexpr (!EnsureAscii) {
+                    // Never-read lazy string: its input bytes are already escaped
+                    if (JSON_UNLIKELY(v.is_raw())) {
+                        const std::string_view raw = v.raw_view();
+                        out_.write('"');
+                        out_.write(raw.data(), raw.size());
+                        out_.write('"');
+                        break;
+                    }
+                }
+                if (JSON_UNLIKELY(v.is_raw())) {
+                    std::string scratch;  // decoded without modifying the value
+                    write_string(v.decoded_view(scratch));
+                    break;
+                }
+                write_string(v.str_view());
                 break;
             case Type::Array:
+                if (JSON_UNLIKELY(v.is_packed())) {
+                    if (v.pad_[0] & JsonValue::kFloatsFlag) write_array(v.as_double_span());
+                    else                                    write_array(v.as_int64_span());
+                    break;
+                }
+                if (JSON_UNLIKELY(depth_ >= YAJSON_MAX_DEPTH)) { write_deep(v); break; }
+                ++depth_;
                 write_array(v.as_array());
+                --depth_;
                 break;
             case Type::Object:
+                if (JSON_UNLIKELY(depth_ >= YAJSON_MAX_DEPTH)) { write_deep(v); break; }
+                ++depth_;
                 write_object(v.as_object());
+                --depth_;
                 break;
         }
     }
 
+    /// Containers nested deeper than YAJSON_MAX_DEPTH (possible with
+    /// ParseOptions::iterative): the layout of write_array / write_object,
+    /// driven by an explicit stack instead of native recursion.
+    JSON_NOINLINE void write_deep(const JsonValue& root) {
+        struct Frame {
+            const JsonValue* v;
+            size_t next;                // next element / member
+            std::vector<size_t> order;  // sort_keys: member order
+        };
+        std::vector<Frame> stack;
+
+        // Write a scalar, packed array or empty container; open the others.
+        auto visit = [&](const JsonValue& v) {
+            const Type t = v.type();
+            if ((t != Type::Array && t != Type::Object) || v.is_packed()) {
+                write_value(v);
+                return;
+            }
+            Frame f{&v, 0, {}};
+            if (t == Type::Array) {
+                if (v.as_array().empty()) { out_.write("[]", 2); return; }
+                out_.write('[');
+            } else {
+                const auto& storage = v.as_object().storage();
+                if (storage.empty()) { out_.write("{}", 2); return; }
+                out_.write('{');
+                if (opts_.sort_keys) {
+                    f.order.resize(storage.size());
+                    for (size_t i = 0; i < f.order.size(); ++i) f.order[i] = i;
+                    std::sort(f.order.begin(), f.order.end(),
+                              [&storage](size_t a, size_t b) {
+                                  return storage[a].first < storage[b].first;
+                              });
+                }
+            }
+            if constexpr (Pretty) current_indent_ += opts_.indent;
+            write_newline();
+            stack.push_back(std::move(f));
+        };
+
+        visit(root);
+        while (!stack.empty()) {
+            Frame& f = stack.back();
+            const bool is_array = f.v->type() == Type::Array;
+            const size_t n = is_array ? f.v->as_array().size() : f.v->as_object().storage().size();
+            if (f.next == n) {
+                if constexpr (Pretty) current_indent_ -= opts_.indent;
+                write_newline();
+                write_indent();
+                out_.write(is_array ? ']' : '}');
+                stack.pop_back();
+                continue;
+            }
+            const size_t i = f.next++;
+            if (i > 0) { out_.write(','); write_newline(); }
+            write_indent();
+            if (is_array) {
+                visit(f.v->as_array()[i]);  // may invalidate f
+                continue;
+            }
+            const auto& member = f.v->as_object().storage()[f.order.empty() ? i : f.order[i]];
+            write_string(std::string_view(member.first));
+            out_.write(':');
+            if constexpr (Pretty) out_.write(' ');
+            visit(member.second);
+        }
+    }
+
     void write_integer(int64_t val) {
         char buf[21];
         char* p = buf;
@@ -401,6 +505,26 @@ private:
         out_.write(']');
     }
 
+    /// Packed array: the same layout as write_array(const Array&), one
+    /// number per element without the per-element type dispatch.
+    template <typename T>
+    void write_array(Span<const T> arr) {
+        if (arr.empty()) { out_.write("[]", 2); return; }
+        out_.write('[');
+        if constexpr (Pretty) current_indent_ += opts_.indent;
+        write_newline();
+        for (size_t i = 0; i < arr.size(); ++i) {
+            if (i > 0) { out_.write(','); write_newline(); }
+            write_indent();
+            if constexpr (std::is_same_v<T, double>) write_float(arr[i]);
+            else                                     write_integer(arr[i]);
+        }
+        if constexpr (Pretty) current_indent_ -= opts_.indent;
+        write_newline();
+        write_indent();
+        out_.write(']');
+    }
+
     void write_object(const Object& obj) {
         if (obj.empty()) { out_.write("{}", 2); return; }
         out_.write('{');
@@ -503,8 +627,7 @@ inline size_t serialization_size_hint(const JsonValue& value) noexcept {
     switch (value.type()) {
         case Type::Array: {
             // ~64 bytes per element is a reasonable estimate for mixed JSON
-            const auto& arr = value.as_array();
-            return arr.size() * 64 + 2;
+            return value.size() * 64 + 2;
         }
         case Type::Object: {
             // ~80 bytes per key-value pair (key + colon + value + comma)
@@ -512,7 +635,8 @@ inline size_t serialization_size_hint(const JsonValue& value) noexcept {
             return obj.size() * 80 + 2;
         }
         case Type::String:
-            return value.as_string_view().size() + 2;
+            if (value.is_lazy_string()) return 16;
+            return value.get_or<std::string_view>({}).size() + 2;
         default:
             return 16;
     }
@@ -12,12 +12,14 @@
 /// to efficient chunked reading.
 
 #include "error.hpp"
+#include "padded_string.hpp"
 #include "parse_options.hpp"
 #include "parser.hpp"
 #include "value.hpp"
 
 #include <fstream>
 #include <istream>
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -39,6 +41,11 @@ namespace detail {
 #if defined(YAJSON_HAS_MMAP)
 
 /// @brief RAII wrapper for memory-mapped file regions.
+///
+/// The mapping is over-allocated so that at least YAJSON_PADDING zero bytes
+/// follow the file contents (a padded input, see padded_string.hpp): an
+/// anonymous zero-page reservation is made first and the file is mapped
+/// over its start. The kernel zero-fills the tail of the last file page.
 class MappedFile {
 public:
     MappedFile() = default;
@@ -48,23 +55,26 @@ public:
         struct stat st;
         if (fstat(fd, &st) != 0 || st.st_size <= 0) return false;
 
-        size_ = static_cast<size_t>(st.st_size);
-        data_ = static_cast<const char*>(
-            ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0));
-
-        if (data_ == MAP_FAILED) {
-            data_ = nullptr;
-            size_ = 0;
+        const auto size = static_cast<size_t>(st.st_size);
+        const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t map_size = (size + YAJSON_PADDING + page - 1) / page * page;
+        void* base = ::mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) return false;
+        if (::mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            ::munmap(base, map_size);
             return false;
         }
 
+        data_ = static_cast<const char*>(base);
+        size_ = size;
+        map_size_ = map_size;
         // Advise the kernel that we'll read sequentially
-        ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+        ::madvise(base, size_, MADV_SEQUENTIAL);
         return true;
     }
 
     ~MappedFile() {
-        if (data_) ::munmap(const_cast<char*>(data_), size_);
+        if (data_) ::munmap(const_cast<char*>(data_), map_size_);
     }
 
     MappedFile(const MappedFile&) = delete;
@@ -78,9 +88,15 @@ public:
         return {data_, size_};
     }
 
+    /// The contents followed by the zero padding.
+    [[nodiscard]] PaddedStringView padded_view() const noexcept {
+        return {data_, size_, map_size_};
+    }
+
 private:
     const char* data_ = nullptr;
     size_t size_ = 0;
+    size_t map_size_ = 0;
 };
 
 #endif // YAJSON_HAS_MMAP
@@ -128,6 +144,7 @@ inline std::string read_stream(std::istream& is) {
 ///   - Zero-copy: file data is read directly from the OS page cache
 ///   - No peak memory doubling (no intermediate string buffer)
 ///   - Automatic prefetching by the OS via MADV_SEQUENTIAL
+///   - The mapping is padded, so the sentinel parser (parse_padded) is used
 ///
 /// Falls back gracefully on failure (e.g., empty file, /proc files).
 [[nodiscard]] inline JsonValue parse_file(const char* path,
@@ -141,7 +158,7 @@ inline std::string read_stream(std::istream& is) {
     detail::MappedFile mf;
     if (mf.open(fd)) {
         ::close(fd);
-        return parse(mf.view(), opts);
+        return parse_padded(mf.padded_view(), detail::copying_strings(opts));
     }
 
     // mmap failed — fall back to read()
@@ -154,7 +171,7 @@ inline std::string read_stream(std::istream& is) {
                          errc::unexpected_end_of_input);
     }
     std::string content = detail::read_stream(ifs);
-    return parse(std::string_view(content), opts);
+    return parse(std::string_view(content), detail::copying_strings(opts));
 }
 
 /// @brief Overload accepting std::string path.
@@ -174,7 +191,7 @@ inline std::string read_stream(std::istream& is) {
                          errc::unexpected_end_of_input);
     }
     std::string content = detail::read_stream(ifs);
-    return parse(std::string_view(content), opts);
+    return parse(std::string_view(content), detail::copying_strings(opts));
 }
 
 [[nodiscard]] inline JsonValue parse_file(const std::string& path,
@@ -184,6 +201,76 @@ inline std::string read_stream(std::istream& is) {
 
 #endif // YAJSON_HAS_MMAP
 
+/// @brief A parsed file that keeps its contents alive for the parsed value.
+///
+/// With ParseOptions::borrow_strings the string values of root() point
+/// into the file mapping instead of being copied out of it:
+///
+/// @code
+///   yajson::ParseOptions opts;
+///   opts.borrow_strings = true;
+///   yajson::FileDocument doc("config.json", opts);
+///   std::string_view name = doc.root()["name"].as_string_view();  // no copy
+/// @endcode
+///
+/// root() and the views it hands out are valid for the lifetime of the
+/// document; moving the document keeps them valid.
+class FileDocument {
+public:
+    /// @throws ParseError if the file cannot be opened or is invalid JSON.
+    explicit FileDocument(const char* path, const ParseOptions& opts = {}) {
+#if defined(YAJSON_HAS_MMAP)
+        int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw ParseError("cannot open file", SourceLocation{},
+                             errc::unexpected_end_of_input);
+        }
+        auto mf = std::make_unique<detail::MappedFile>();
+        const bool mapped = mf->open(fd);
+        ::close(fd);
+        if (mapped) {
+            root_ = parse_padded(mf->padded_view(), opts);
+            file_ = std::move(mf);
+            return;
+        }
+#endif
+        std::ifstream ifs(path, std::ios::binary);
+        if (!ifs) {
+            throw ParseError("cannot open file", SourceLocation{},
+                             errc::unexpected_end_of_input);
+        }
+        buffer_ = PaddedString(detail::read_stream(ifs));
+        root_ = parse_padded(buffer_, opts);
+    }
+
+    explicit FileDocument(const std::string& path, const ParseOptions& opts = {})
+        : FileDocument(path.c_str(), opts) {}
+
+    FileDocument(FileDocument&&) noexcept = default;
+    FileDocument& operator=(FileDocument&&) noexcept = default;
+    FileDocument(const FileDocument&) = delete;
+    FileDocument& operator=(const FileDocument&) = delete;
+
+    [[nodiscard]] JsonValue& root() noexcept { return root_; }
+    [[nodiscard]] const JsonValue& root() const noexcept { return root_; }
+
+    /// The file contents.
+    [[nodiscard]] std::string_view text() const noexcept {
+#if defined(YAJSON_HAS_MMAP)
+        if (file_) return file_->view();
+#endif
+        return buffer_.view();
+    }
+
+private:
+    // Declared before root_, so root_ is destroyed first
+#if defined(YAJSON_HAS_MMAP)
+    std::unique_ptr<detail::MappedFile> file_;
+#endif
+    PaddedString buffer_;
+    JsonValue root_;
+};
+
 /// @brief Parse JSON from an input stream.
 [[nodiscard]] inline JsonValue parse(std::istream& is,
                                      const ParseOptions& opts = {}) {
@@ -194,7 +281,7 @@ inline std::string read_stream(std::istream& is) {
                          SourceLocation{}, errc::unexpected_end_of_input);
     }
 
-    return parse(std::string_view(content), opts);
+    return parse(std::string_view(content), detail::copying_strings(opts));
 }
 
 /// @brief Parse JSON from a stream (no exceptions).
@@ -0,0 +1,555 @@
+#pragma once
+
+/// @file tape.hpp
+/// @author Aleksandr Loshkarev
+/// @brief Immutable tape representation of a parsed JSON document.
+///
+/// An alternative to the JsonValue DOM for read-only workloads. The whole
+/// document lives in two contiguous buffers:
+///   - a tape of 64-bit words (8-bit tag + 56-bit payload), one word per
+///     scalar/container boundary, plus one extra word for numbers;
+///   - a string buffer holding every key and string value as
+///     [uint32 length][bytes]['\0'].
+///
+/// Parsing allocates nothing per node: a reused TapeDocument allocates
+/// nothing at all once its buffers have grown. Traversal is linear in
+/// memory and pointer-chasing-free.
+///
+/// @code
+///   yajson::TapeDocument doc;
+///   doc.parse(R"({"route":"/api","weights":[1,2,3]})");
+///   auto root = doc.root();
+///   std::string_view route = root["route"].as_string_view();
+///   for (auto w : root["weights"].as_array()) sum += w.as_integer();
+/// @endcode
+///
+/// Tape word layout (tag in the top byte):
+///   'n' 't' 'f'      null / true / false
+///   'l' 'u' 'd'      int64 / uint64 / double; the raw bits follow in the next word
+///   '"'              string; payload = offset into the string buffer
+///   '{' '['          container start; payload = index past the matching end word
+///                    (low 32 bits) | element count (next 24 bits, saturating)
+///   '}' ']'          container end; payload = index of the matching start word
+///
+/// Object members are stored as key ('"' word) followed by the value. Like the
+/// DOM, lookups honor "last value wins" for duplicate keys.
+///
+/// Limits: string lengths and container end indices are 32-bit. The tape
+/// holds at most one word per input byte plus one, so TapeDocument rejects
+/// inputs longer than TapeDocument::kMaxInputSize with errc::input_too_large
+/// instead of truncating them.
+
+#include "config.hpp"
+#include "error.hpp"
+#include "parse_options.hpp"
+#include "parser.hpp"
+#include "value.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace yajson {
+
+class TapeDocument;
+class TapeArray;
+class TapeObject;
+
+namespace detail {
+
+/// Tape word helpers (tag in bits 56..63, payload in bits 0..55).
+namespace tape {
+
+inline constexpr uint64_t kPayloadMask = (uint64_t{1} << 56) - 1;
+inline constexpr uint64_t kCountMax = (uint64_t{1} << 24) - 1;
+
+inline constexpr uint64_t word(char tag, uint64_t payload) noexcept {
+    return (static_cast<uint64_t>(static_cast<unsigned char>(tag)) << 56) | payload;
+}
+inline constexpr char tag(uint64_t w) noexcept { return static_cast<char>(w >> 56); }
+inline constexpr uint64_t payload(uint64_t w) noexcept { return w & kPayloadMask; }
+
+} // namespace tape
+
+/// @brief Parser event handler that appends to a tape.
+class TapeBuilder {
+public:
+    TapeBuilder(std::vector<uint64_t>& tape, std::vector<char>& strings,
+                std::vector<uint32_t>& stack) noexcept
+        : tape_(tape), strings_(strings), stack_(stack) {}
+
+    void on_null() { tape_.push_back(tape::word('n', 0)); }
+    void on_bool(bool b) { tape_.push_back(tape::word(b ? 't' : 'f', 0)); }
+    void on_int64(int64_t v) { push_number('l', static_cast<uint64_t>(v)); }
+    void on_uint64(uint64_t v) { push_number('u', v); }
+    void on_double(double v) {
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        push_number('d', bits);
+    }
+    void on_string(std::string_view s) { push_string(s); }
+    void on_key(std::string_view s) { push_string(s); }
+
+    void start_object() { open('{'); }
+    void end_object(size_t n) { close('{', '}', n); }
+    void start_array() { open('['); }
+    void end_array(size_t n) { close('[', ']', n); }
+
+private:
+    std::vector<uint64_t>& tape_;
+    std::vector<char>& strings_;
+    std::vector<uint32_t>& stack_;
+
+    void push_number(char t, uint64_t bits) {
+        tape_.push_back(tape::word(t, 0));
+        tape_.push_back(bits);
+    }
+
+    void push_string(std::string_view s) {
+        const size_t off = strings_.size();
+        const auto len = static_cast<uint32_t>(s.size());  // <= TapeDocument::kMaxInputSize
+        strings_.resize(off + sizeof(len) + s.size() + 1);
+        char* dst = strings_.data() + off;
+        std::memcpy(dst, &len, sizeof(len));
+        std::memcpy(dst + sizeof(len), s.data(), s.size());
+        dst[sizeof(len) + s.size()] = '\0';
+        tape_.push_back(tape::word('"', off));
+    }
+
+    void open(char t) {
+        stack_.push_back(static_cast<uint32_t>(tape_.size()));  // see kMaxInputSize
+        tape_.push_back(tape::word(t, 0));
+    }
+
+    void close(char open_tag, char close_tag, size_t n) {
+        const uint32_t start = stack_.back();
+        stack_.pop_back();
+        const uint64_t count = n < tape::kCountMax ? n : tape::kCountMax;
+        const uint64_t past_end = tape_.size() + 1;
+        tape_[start] = tape::word(open_tag, past_end | (count << 32));
+        tape_.push_back(tape::word(close_tag, start));
+    }
+};
+
+} // namespace detail
+
+// ─── TapeValue ───────────────────────────────────────────────────────────────
+
+/// @brief Read-only cursor to one value on a TapeDocument's tape.
+///
+/// A trivially copyable (document pointer, tape index) pair. Valid until the
+/// owning document is parsed into again or destroyed. The accessors mirror
+/// JsonValue and throw TypeError / OutOfRangeError the same way.
+class TapeValue {
+public:
+    TapeValue() noexcept = default;
+
+    [[nodiscard]] Type type() const noexcept;
+    [[nodiscard]] bool is_null()    const noexcept { return tag() == 'n'; }
+    [[nodiscard]] bool is_bool()    const noexcept { return tag() == 't' || tag() == 'f'; }
+    [[nodiscard]] bool is_integer() const noexcept { return tag() == 'l'; }
+    [[nodiscard]] bool is_uinteger() const noexcept { return tag() == 'u'; }
+    [[nodiscard]] bool is_float()   const noexcept { return tag() == 'd'; }
+    [[nodiscard]] bool is_number()  const noexcept { return is_integer() || is_uinteger() || is_float(); }
+    [[nodiscard]] bool is_string()  const noexcept { return tag() == '"'; }
+    [[nodiscard]] bool is_array()   const noexcept { return tag() == '['; }
+    [[nodiscard]] bool is_object()  const noexcept { return tag() == '{'; }
+
+    [[nodiscard]] bool as_bool() const {
+        if (JSON_UNLIKELY(!is_bool())) type_error("bool");
+        return tag() == 't';
+    }
+    [[nodiscard]] int64_t as_integer() const {
+        if (is_integer()) return static_cast<int64_t>(next_word());
+        if (is_uinteger() && next_word() <= static_cast<uint64_t>(INT64_MAX))
+            return static_cast<int64_t>(next_word());
+        type_error("integer");
+    }
+    [[nodiscard]] uint64_t as_uinteger() const {
+        if (is_uinteger()) return next_word();
+        if (is_integer() && static_cast<int64_t>(next_word()) >= 0) return next_word();
+        type_error("uinteger");
+    }
+    [[nodiscard]] double as_float() const {
+        if (is_float()) {
+            double d;
+            const uint64_t bits = next_word();
+            std::memcpy(&d, &bits, sizeof(d));
+            return d;
+        }
+        if (is_integer()) return static_cast<double>(static_cast<int64_t>(next_word()));
+        if (is_uinteger()) return static_cast<double>(next_word());
+        type_error("number");
+    }
+    [[nodiscard]] std::string_view as_string_view() const {
+        if (JSON_UNLIKELY(!is_string())) type_error("string");
+        return string_at(detail::tape::payload(word()));
+    }
+    [[nodiscard]] std::string as_string() const { return std::string(as_string_view()); }
+
+    [[nodiscard]] TapeArray as_array() const;
+    [[nodiscard]] TapeObject as_object() const;
+
+    /// Number of elements/members (0 for scalars).
+    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept {
+        if (is_null()) return true;
+        if (is_array() || is_object()) return size() == 0;
+        return false;
+    }
+
+    /// Array element access, O(index).
+    [[nodiscard]] TapeValue operator[](size_t index) const;
+    [[nodiscard]] TapeValue operator[](int index) const {
+        return operator[](static_cast<size_t>(index));
+    }
+    /// Object member access, O(members). Throws OutOfRangeError if missing.
+    [[nodiscard]] TapeValue operator[](std::string_view key) const;
+    [[nodiscard]] TapeValue operator[](const char* key) const {
+        return operator[](std::string_view(key));
+    }
+
+    /// Object member lookup; nullopt if not an object or key is missing.
+    [[nodiscard]] std::optional<TapeValue> find(std::string_view key) const noexcept;
+    [[nodiscard]] bool contains(std::string_view key) const noexcept {
+        return find(key).has_value();
+    }
+
+    /// Materialize this subtree as a JsonValue (honors an active ArenaScope).
+    [[nodiscard]] JsonValue to_value() const;
+
+    /// Tape index of this value (stable for the lifetime of the parse).
+    [[nodiscard]] size_t tape_index() const noexcept { return idx_; }
+
+private:
+    friend class TapeDocument;
+    friend class TapeArray;
+    friend class TapeObject;
+
+    const TapeDocument* doc_ = nullptr;
+    size_t idx_ = 0;
+
+    TapeValue(const TapeDocument* doc, size_t idx) noexcept : doc_(doc), idx_(idx) {}
+
+    uint64_t word() const noexcept;
+    uint64_t next_word() const noexcept;
+    char tag() const noexcept { return doc_ ? detail::tape::tag(word()) : 'n'; }
+    std::string_view string_at(uint64_t offset) const noexcept;
+    std::string_view as_key() const noexcept { return string_at(detail::tape::payload(word())); }
+
+    /// Index of the value following this one on the tape.
+    size_t after() const noexcept;
+
+    [[noreturn]] void type_error(const char* expected) const {
+        throw TypeError(std::string("expected ") + expected + ", got " +
+                        std::string(type_name(type())));
+    }
+};
+
+// ─── TapeArray / TapeObject ranges ───────────────────────────────────────────
+
+/// @brief Iterable view of a tape array (elements are TapeValue).
+class TapeArray {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TapeValue;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = TapeValue;
+
+        iterator() noexcept = default;
+        TapeValue operator*() const noexcept { return TapeValue(doc_, idx_); }
+        iterator& operator++() noexcept {
+            idx_ = TapeValue(doc_, idx_).after();
+            return *this;
+        }
+        iterator operator++(int) noexcept { auto t = *this; ++*this; return t; }
+        bool operator==(const iterator& o) const noexcept { return idx_ == o.idx_; }
+        bool operator!=(const iterator& o) const noexcept { return idx_ != o.idx_; }
+
+    private:
+        friend class TapeArray;
+        const TapeDocument* doc_ = nullptr;
+        size_t idx_ = 0;
+        iterator(const TapeDocument* d, size_t i) noexcept : doc_(d), idx_(i) {}
+    };
+
+    [[nodiscard]] iterator begin() const noexcept { return {doc_, begin_}; }
+    [[nodiscard]] iterator end() const noexcept { return {doc_, end_}; }
+    [[nodiscard]] size_t size() const noexcept { return TapeValue(doc_, begin_ - 1).size(); }
+    [[nodiscard]] bool empty() const noexcept { return begin_ == end_; }
+    [[nodiscard]] TapeValue operator[](size_t index) const {
+        return TapeValue(doc_, begin_ - 1)[index];
+    }
+
+private:
+    friend class TapeValue;
+    const TapeDocument* doc_;
+    size_t begin_;  ///< First element
+    size_t end_;    ///< Closing ']' word
+    TapeArray(const TapeDocument* d, size_t b, size_t e) noexcept : doc_(d), begin_(b), end_(e) {}
+};
+
+/// @brief Iterable view of a tape object (members are key/value pairs).
+class TapeObject {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string_view, TapeValue>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        iterator() noexcept = default;
+        value_type operator*() const noexcept {
+            return {TapeValue(doc_, idx_).as_key(), TapeValue(doc_, idx_ + 1)};
+        }
+        iterator& operator++() noexcept {
+            idx_ = TapeValue(doc_, idx_ + 1).after();
+            return *this;
+        }
+        iterator operator++(int) noexcept { auto t = *this; ++*this; return t; }
+        bool operator==(const iterator& o) const noexcept { return idx_ == o.idx_; }
+        bool operator!=(const iterator& o) const noexcept { return idx_ != o.idx_; }
+
+    private:
+        friend class TapeObject;
+        const TapeDocument* doc_ = nullptr;
+        size_t idx_ = 0;  ///< Key word of the current member
+        iterator(const TapeDocument* d, size_t i) noexcept : doc_(d), idx_(i) {}
+    };
+
+    [[nodiscard]] iterator begin() const noexcept { return {doc_, begin_}; }
+    [[nodiscard]] iterator end() const noexcept { return {doc_, end_}; }
+    [[nodiscard]] size_t size() const noexcept { return TapeValue(doc_, begin_ - 1).size(); }
+    [[nodiscard]] bool empty() const noexcept { return begin_ == end_; }
+    [[nodiscard]] std::optional<TapeValue> find(std::string_view key) const noexcept {
+        return TapeValue(doc_, begin_ - 1).find(key);
+    }
+
+private:
+    friend class TapeValue;
+    const TapeDocument* doc_;
+    size_t begin_;  ///< First key word
+    size_t end_;    ///< Closing '}' word
+    TapeObject(const TapeDocument* d, size_t b, size_t e) noexcept : doc_(d), begin_(b), end_(e) {}
+};
+
+// ─── TapeDocument ────────────────────────────────────────────────────────────
+
+/// @brief Owns the tape and string buffer of one parsed document.
+///
+/// Reuse one TapeDocument across parses to keep its buffers warm: after the
+/// first few documents, parsing performs no allocations at all.
+class TapeDocument {
+public:
+    TapeDocument() = default;
+
+    /// @brief Parse input into the document, replacing previous content.
+    /// @throws ParseError on invalid JSON (the document is left empty).
+    void parse(std::string_view input, const ParseOptions& opts = {}) {
+        parse(input, opts, nullptr);
+    }
+
+    /// @brief Parse input (no exceptions); returns the error code on failure,
+    /// std::errc::not_enough_memory if the buffers cannot grow.
+    [[nodiscard]] std::error_code try_parse(std::string_view input,
+                                            const ParseOptions& opts = {}) noexcept {
+        std::error_code ec;
+        try {
+            parse(input, opts, &ec);
+            return ec;
+        } catch (const std::bad_alloc&) {
+            return std::make_error_code(std::errc::not_enough_memory);
+        } catch (const std::length_error&) {
+            return std::make_error_code(std::errc::not_enough_memory);
+        }
+    }
+
+    /// Longest input parse() accepts: string lengths and container end
+    /// indices (at most input size + 1) must fit in 32 bits.
+    static constexpr size_t kMaxInputSize = std::numeric_limits<uint32_t>::max() - 2;
+
+    /// @brief Root value (null if the document is empty).
+    [[nodiscard]] TapeValue root() const noexcept {
+        return tape_.empty() ? TapeValue() : TapeValue(this, 0);
+    }
+
+    /// @brief Drop content but keep buffer capacity.
+    void clear() noexcept {
+        tape_.clear();
+        strings_.clear();
+        stack_.clear();
+    }
+
+    /// Number of 64-bit words on the tape.
+    [[nodiscard]] size_t tape_size() const noexcept { return tape_.size(); }
+    /// Bytes used in the string buffer.
+    [[nodiscard]] size_t string_bytes() const noexcept { return strings_.size(); }
+
+private:
+    friend class TapeValue;
+    /// @brief parse(), reporting errors in @p ec when given.
+    void parse(std::string_view input, const ParseOptions& opts, std::error_code* ec) {
+        clear();
+        if (JSON_UNLIKELY(input.size() > kMaxInputSize)) {
+            if (ec) {
+                *ec = make_error_code(errc::input_too_large);
+                return;
+            }
+            throw ParseError("input exceeds TapeDocument::kMaxInputSize",
+                             SourceLocation{}, errc::input_too_large);
+        }
+        // Typical documents produce ~1 tape word per 6 bytes and strings
+        // totalling well under the input size; reserve so most parses
+        // never regrow.
+        tape_.reserve(input.size() / 4 + 2);
+        strings_.reserve(input.size() + 16);
+        detail::TapeBuilder builder(tape_, strings_, stack_);
+        try {
+            detail::Parser::parse_events(input, builder, opts, ec);
+        } catch (...) {
+            clear();
+            throw;
+        }
+        if (ec && *ec) clear();
+    }
+
+    std::vector<uint64_t> tape_;
+    std::vector<char> strings_;
+    std::vector<uint32_t> stack_;  ///< Open-container stack (parse-time only)
+};
+
+/// @brief Parse JSON into a new TapeDocument (with exceptions).
+[[nodiscard]] inline TapeDocument parse_tape(std::string_view input,
+                                             const ParseOptions& opts = {}) {
+    TapeDocument doc;
+    doc.parse(input, opts);
+    return doc;
+}
+
+// ─── TapeValue out-of-line members ───────────────────────────────────────────
+
+inline uint64_t TapeValue::word() const noexcept { return doc_->tape_[idx_]; }
+inline uint64_t TapeValue::next_word() const noexcept { return doc_->tape_[idx_ + 1]; }
+
+inline std::string_view TapeValue::string_at(uint64_t offset) const noexcept {
+    const char* p = doc_->strings_.data() + offset;
+    uint32_t len;
+    std::memcpy(&len, p, sizeof(len));
+    return {p + sizeof(len), len};
+}
+
+inline Type TapeValue::type() const noexcept {
+    switch (tag()) {
+        case 't': case 'f': return Type::Bool;
+        case 'l': return Type::Integer;
+        case 'u': return Type::UInteger;
+        case 'd': return Type::Float;
+        case '"': return Type::String;
+        case '[': return Type::Array;
+        case '{': return Type::Object;
+        default:  return Type::Null;
+    }
+}
+
+inline size_t TapeValue::after() const noexcept {
+    switch (tag()) {
+        case 'l': case 'u': case 'd': return idx_ + 2;
+        case '[': case '{': return static_cast<uint32_t>(detail::tape::payload(word()));
+        default: return idx_ + 1;
+    }
+}
+
+inline size_t TapeValue::size() const noexcept {
+    if (!is_array() && !is_object()) return 0;
+    const uint64_t count = detail::tape::payload(word()) >> 32;
+    if (JSON_LIKELY(count < detail::tape::kCountMax)) return static_cast<size_t>(count);
+    // Saturated count: walk the container.
+    size_t n = 0;
+    const size_t end = after() - 1;
+    for (size_t i = idx_ + 1; i < end; ++n) {
+        if (is_object()) ++i;  // key
+        i = TapeValue(doc_, i).after();
+    }
+    return n;
+}
+
+inline TapeArray TapeValue::as_array() const {
+    if (JSON_UNLIKELY(!is_array())) type_error("array");
+    return TapeArray(doc_, idx_ + 1, after() - 1);
+}
+
+inline TapeObject TapeValue::as_object() const {
+    if (JSON_UNLIKELY(!is_object())) type_error("object");
+    return TapeObject(doc_, idx_ + 1, after() - 1);
+}
+
+inline TapeValue TapeValue::operator[](size_t index) const {
+    const TapeArray arr = as_array();
+    size_t i = arr.begin_;
+    for (size_t n = 0; i < arr.end_; ++n) {
+        if (n == index) return TapeValue(doc_, i);
+        i = TapeValue(doc_, i).after();
+    }
+    throw OutOfRangeError("array index " + std::to_string(index) +
+                          " out of range (size=" + std::to_string(size()) + ")");
+}
+
+inline std::optional<TapeValue> TapeValue::find(std::string_view key) const noexcept {
+    if (!is_object()) return std::nullopt;
+    std::optional<TapeValue> found;
+    const size_t end = after() - 1;
+    for (size_t i = idx_ + 1; i < end;) {
+        const TapeValue value(doc_, i + 1);
+        if (string_at(detail::tape::payload(doc_->tape_[i])) == key) found = value;
+        i = value.after();
+    }
+    return found;
+}
+
+inline TapeValue TapeValue::operator[](std::string_view key) const {
+    if (JSON_UNLIKELY(!is_object())) type_error("object");
+    auto v = find(key);
+    if (JSON_UNLIKELY(!v)) throw OutOfRangeError("key not found: \"" + std::string(key) + "\"");
+    return *v;
+}
+
+inline JsonValue TapeValue::to_value() const {
+    switch (tag()) {
+        case 't': return JsonValue(true);
+        case 'f': return JsonValue(false);
+        case 'l': return JsonValue(as_integer());
+        case 'u': return JsonValue(as_uinteger());
+        case 'd': return JsonValue(as_float());
+        case '"': return JsonValue(as_string_view());
+        case '[': {
+            Array arr(detail::current_resource());
+            arr.reserve(size());
+            for (TapeValue v : as_array()) arr.push_back(v.to_value());
+            return JsonValue(std::move(arr), detail::current_arena);
+        }
+        case '{': {
+            Object obj(detail::current_resource());
+            obj.reserve(size());
+            for (auto [k, v] : as_object()) obj.entries.emplace_back(std::string(k), v.to_value());
+            detail::ParserBase::finalize_object(obj);  // duplicate keys as in parse()
+            return JsonValue(std::move(obj), detail::current_arena);
+        }
+        default: return JsonValue(nullptr);
+    }
+}
+
+} // namespace yajson
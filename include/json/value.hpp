@@ -9,6 +9,9 @@
 ///   - Small String Optimization (SSO) for strings up to 15 characters
 ///   - Manual resource management (copy/move/destroy)
 ///   - Support for all JSON types: null, bool, int64_t, uint64_t, double, string, array, object
+///   - Raw numbers (ParseOptions::number_mode): the token text, converted on access
+///   - Packed arrays (ParseOptions::packed_arrays): all-integer or all-float arrays
+///     stored as a contiguous int64_t[] / double[], expanded only by non-const access
 ///   - O(1) object key lookup via a lazy hash index
 ///   - Arena-aware allocation: when a MonotonicArena is active (via ArenaScope),
 ///     strings, arrays, and objects are allocated from the arena instead of the heap
@@ -19,23 +22,64 @@
 #include "config.hpp"
 #include "error.hpp"
 #include "fwd.hpp"
+#include "detail/fast_float.hpp"
+#include "detail/utf8.hpp"
 
+#include <atomic>
 #include <charconv>
 #include <cmath>
 #include <cstring>
 #include <memory_resource>
 #include <new>
 #include <limits>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace yajson {
-namespace detail { class Parser; } // forward declaration
+namespace detail {
+template <typename Policy> class BasicParser;  // forward declaration
+template <typename Output, bool Pretty, bool EnsureAscii> class SerializerCore;
+
+/// @brief Per-thread state of one recursive JsonValue traversal (copy,
+/// comparison). Native recursion is bounded: a container
+/// YAJSON_MAX_DEPTH levels below the outermost call is queued for that
+/// call, which visits it once its own recursion has unwound. Values built
+/// by the iterative parser can therefore be nested to any depth.
+template <typename Item>
+struct DeferredTraversal {
+    size_t depth = 0;                    ///< Containers entered, outermost = 1
+    std::vector<Item>* queue = nullptr;  ///< Owned by the outermost call
+};
+
+/// Marks the outermost call of a traversal; resets it on return or throw.
+template <typename Item>
+class TraversalScope {
+public:
+    TraversalScope(DeferredTraversal<Item>& t, std::vector<Item>& queue) noexcept : t_(t) {
+        t_.depth = 1;
+        t_.queue = &queue;
+    }
+    ~TraversalScope() {
+        t_.depth = 0;
+        t_.queue = nullptr;
+    }
+    TraversalScope(const TraversalScope&) = delete;
+    TraversalScope& operator=(const TraversalScope&) = delete;
+
+private:
+    DeferredTraversal<Item>& t_;
+};
+} // namespace detail
 
 class JsonValue {
-    friend class detail::Parser;  // Zero-copy arena string construction
+    template <typename Policy>
+    friend class detail::BasicParser;  // Zero-copy arena string construction
+    template <typename Output, bool Pretty, bool EnsureAscii>
+    friend class detail::SerializerCore;  // Raw (still escaped) string output
 public:
     JsonValue() noexcept : kind_(Type::Null), sso_len_(0) { u_.i = 0; }
     JsonValue(std::nullptr_t) noexcept : kind_(Type::Null), sso_len_(0) { u_.i = 0; }
@@ -148,6 +192,14 @@ public:
     }
 
     [[nodiscard]] static JsonValue array() { return JsonValue(Array(detail::current_resource())); }
+
+    /// @brief A packed array holding a copy of @p values (see is_packed()).
+    [[nodiscard]] static JsonValue packed_array(Span<const int64_t> values) {
+        return make_packed(values);
+    }
+    [[nodiscard]] static JsonValue packed_array(Span<const double> values) {
+        return make_packed(values);
+    }
     [[nodiscard]] static JsonValue object() { return JsonValue(Object(detail::current_resource())); }
 
     [[nodiscard]] Type type() const noexcept { return kind_; }
@@ -159,7 +211,10 @@ public:
     [[nodiscard]] bool is_array()   const noexcept { return kind_ == Type::Array; }
     [[nodiscard]] bool is_object()   const noexcept { return kind_ == Type::Object; }
     [[nodiscard]] bool is_uinteger() const noexcept { return kind_ == Type::UInteger; }
-    [[nodiscard]] bool is_number()   const noexcept { return is_integer() || is_uinteger() || is_float(); }
+    [[nodiscard]] bool is_raw_number() const noexcept { return kind_ == Type::RawNumber; }
+    [[nodiscard]] bool is_number()   const noexcept {
+        return is_integer() || is_uinteger() || is_float() || is_raw_number();
+    }
 
     bool as_bool() const {
         if (JSON_UNLIKELY(!is_bool()))
@@ -168,12 +223,14 @@ public:
     }
     int64_t as_integer() const {
         if (is_integer()) return u_.i;
+        if (JSON_UNLIKELY(is_raw_number())) return converted_number().as_integer();
         if (is_uinteger() && u_.u <= static_cast<uint64_t>(INT64_MAX))
             return static_cast<int64_t>(u_.u);
         throw TypeError("expected integer, got " + std::string(type_name(type())));
     }
     uint64_t as_uinteger() const {
         if (is_uinteger()) return u_.u;
+        if (JSON_UNLIKELY(is_raw_number())) return converted_number().as_uinteger();
         if (is_integer() && u_.i >= 0) return static_cast<uint64_t>(u_.i);
         throw TypeError("expected uinteger, got " + std::string(type_name(type())));
     }
@@ -181,29 +238,89 @@ public:
         if (is_float()) return u_.d;
         if (is_integer()) return static_cast<double>(u_.i);
         if (is_uinteger()) return static_cast<double>(u_.u);
+        if (is_raw_number()) {
+            const std::string_view t = str_view();
+            return detail::decimal_to_double(t.data(), t.data() + t.size());
+        }
         throw TypeError("expected number, got " + std::string(type_name(type())));
     }
     double as_number() const { return as_float(); }
 
+    /// @brief Original text of a raw number (ParseOptions::number_mode).
+    [[nodiscard]] std::string_view as_raw_number() const {
+        if (JSON_UNLIKELY(!is_raw_number()))
+            throw TypeError("expected raw number, got " + std::string(type_name(type())));
+        return str_view();
+    }
+
+    /// @brief True for a string parsed with ParseOptions::lazy_unescape whose
+    /// escapes are not decoded yet. Const as_string_view() and
+    /// get_or<std::string_view>() throw for it; the non-const ones decode it.
+    [[nodiscard]] bool is_lazy_string() const noexcept { return is_string() && is_raw(); }
+
+    /// @throws TypeError if not a string, or if it is a lazily unescaped
+    /// string not yet decoded (ParseOptions::lazy_unescape): a const value is
+    /// never modified, so decode it through the non-const overload first.
     [[nodiscard]] std::string_view as_string_view() const {
         if (JSON_UNLIKELY(!is_string()))
             throw TypeError("expected string, got " + std::string(type_name(type())));
+        if (JSON_UNLIKELY(is_raw())) throw_undecoded();
         return str_view();
     }
+    /// @brief As above; a lazily unescaped string is decoded in place first.
+    [[nodiscard]] std::string_view as_string_view() {
+        if (JSON_UNLIKELY(is_raw())) return unescape_raw();
+        return std::as_const(*this).as_string_view();
+    }
+    /// @brief Copy of the string (a lazy one is decoded into the copy).
     [[nodiscard]] std::string as_string() const {
-        return std::string(as_string_view());
+        if (JSON_UNLIKELY(!is_string()))
+            throw TypeError("expected string, got " + std::string(type_name(type())));
+        std::string scratch;
+        const std::string_view sv = decoded_view(scratch);
+        if (sv.data() == scratch.data()) return scratch;
+        return std::string(sv);
     }
 
+    /// @brief The elements. A packed array stays packed: the first const
+    /// access builds an equivalent regular Array kept alongside it (safe
+    /// with concurrent const readers), so prefer as_int64_span(),
+    /// as_double_span() or element() where a copy of the elements matters.
     [[nodiscard]] const Array& as_array() const {
         if (JSON_UNLIKELY(!is_array()))
             throw TypeError("expected array, got " + std::string(type_name(type())));
+        if (JSON_UNLIKELY(is_packed())) return packed_view();
         return *u_.arr;
     }
+    /// @brief The elements as a mutable Array; a packed array is unpack()ed.
     Array& as_array() {
         if (JSON_UNLIKELY(!is_array()))
             throw TypeError("expected array, got " + std::string(type_name(type())));
+        if (JSON_UNLIKELY(is_packed())) return unpack_packed();
         return *u_.arr;
     }
+    /// @brief Convert a packed array into the equivalent regular Array in
+    /// place, in the same arena (or on the heap), and return it. A regular
+    /// array is returned as is.
+    Array& unpack() { return as_array(); }
+
+    /// @brief True for an array stored as a contiguous int64_t[] or double[]
+    /// (ParseOptions::packed_arrays, packed_array()). type() is still Array.
+    [[nodiscard]] bool is_packed() const noexcept {
+        return is_array() && (pad_[0] & kPackedFlag);
+    }
+    /// @brief The elements of a packed integer array, without expanding it.
+    [[nodiscard]] Span<const int64_t> as_int64_span() const {
+        if (JSON_UNLIKELY(!is_packed() || (pad_[0] & kFloatsFlag)))
+            throw TypeError("expected packed integer array, got " + packed_type_name());
+        return {u_.ints->values.data(), u_.ints->values.size()};
+    }
+    /// @brief The elements of a packed float array, without expanding it.
+    [[nodiscard]] Span<const double> as_double_span() const {
+        if (JSON_UNLIKELY(!is_packed() || !(pad_[0] & kFloatsFlag)))
+            throw TypeError("expected packed float array, got " + packed_type_name());
+        return {u_.floats->values.data(), u_.floats->values.size()};
+    }
     [[nodiscard]] const Object& as_object() const {
         if (JSON_UNLIKELY(!is_object()))
             throw TypeError("expected object, got " + std::string(type_name(type())));
@@ -228,8 +345,14 @@ public:
         else static_assert(sizeof(T) == 0, "Unsupported type for get<T>()");
     }
     /// Type-safe value access with fallback — no exceptions, no overhead.
+    /// The one exception: get_or<std::string_view>() on a lazy string not
+    /// yet decoded (is_lazy_string()) throws TypeError like const
+    /// as_string_view(), as it has no decoded text to view.
     template <typename T>
-    [[nodiscard]] T get_or(const T& dv) const noexcept {
+    [[nodiscard]] T get_or(const T& dv) const noexcept(!std::is_same_v<T, std::string_view>) {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            if (JSON_UNLIKELY(is_raw_number())) return converted_number().get_or(dv);
+        }
         if constexpr (std::is_same_v<T, bool>) {
             return is_bool() ? u_.b : dv;
         } else if constexpr (std::is_same_v<T, uint64_t>) {
@@ -247,13 +370,23 @@ public:
             if (is_uinteger()) return static_cast<T>(u_.u);
             return dv;
         } else if constexpr (std::is_same_v<T, std::string>) {
-            return is_string() ? std::string(str_view()) : dv;
+            return is_string() ? as_string() : dv;
         } else if constexpr (std::is_same_v<T, std::string_view>) {
-            return is_string() ? str_view() : dv;
+            if (!is_string()) return dv;
+            if (JSON_UNLIKELY(is_raw())) throw_undecoded();
+            return str_view();
         } else {
             static_assert(sizeof(T) == 0, "Unsupported type for get_or<T>()");
         }
     }
+    /// @brief As above; a lazily unescaped string is decoded in place first.
+    template <typename T>
+    [[nodiscard]] T get_or(const T& dv) noexcept(!std::is_same_v<T, std::string_view>) {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            if (JSON_UNLIKELY(is_lazy_string())) return unescape_raw();
+        }
+        return std::as_const(*this).get_or(dv);
+    }
 
     JsonValue& operator[](size_t index) {
         auto& a = as_array();
@@ -267,6 +400,14 @@ public:
             throw OutOfRangeError("array index " + size_to_string(index) + " out of range (size=" + size_to_string(a.size()) + ")");
         return a[index];
     }
+    /// @brief Copy of array element @p index. Reads a packed array directly,
+    /// without building its element view (the element is an Integer or Float).
+    [[nodiscard]] JsonValue element(size_t index) const {
+        if (JSON_LIKELY(!is_packed())) return (*this)[index];
+        if (JSON_UNLIKELY(index >= packed_size()))
+            throw OutOfRangeError("array index " + size_to_string(index) + " out of range (size=" + size_to_string(packed_size()) + ")");
+        return packed_at(index);
+    }
     JsonValue& operator[](int index) { return operator[](static_cast<size_t>(index)); }
     const JsonValue& operator[](int index) const { return operator[](static_cast<size_t>(index)); }
 
@@ -306,12 +447,14 @@ public:
     }
 
     [[nodiscard]] size_t size() const noexcept {
+        if (JSON_UNLIKELY(is_packed())) return packed_size();
         if (is_array())  return u_.arr->size();
         if (is_object()) return u_.obj->size();
         return 0;
     }
     [[nodiscard]] bool empty() const noexcept {
         if (is_null()) return true;
+        if (JSON_UNLIKELY(is_packed())) return packed_size() == 0;
         if (is_array())  return u_.arr->empty();
         if (is_object()) return u_.obj->empty();
         return false;
@@ -332,11 +475,17 @@ public:
     }
     bool erase(std::string_view key) { return as_object().erase(key); }
     void clear() {
-        if (is_array())  { u_.arr->clear(); return; }
+        if (is_array())  { as_array().clear(); return; }
         if (is_object()) { u_.obj->clear(); return; }
     }
 
     [[nodiscard]] bool operator==(const JsonValue& other) const {
+        if (JSON_UNLIKELY(is_raw_number() || other.is_raw_number())) {
+            if (!is_number() || !other.is_number()) return false;
+            if (kind_ == other.kind_ && str_view() == other.str_view()) return true;
+            return (is_raw_number() ? converted_number() : *this) ==
+                   (other.is_raw_number() ? other.converted_number() : other);
+        }
         if (kind_ != other.kind_) {
             if (is_number() && other.is_number()) {
                 // Exact int/uint comparison without double-precision loss
@@ -361,9 +510,17 @@ public:
                 const double b = other.u_.d;
                 return !(a < b) && !(a > b);
             }
-            case Type::String:  return str_view() == other.str_view();
-            case Type::Array:   return *u_.arr == *other.u_.arr;
-            case Type::Object:  return *u_.obj == *other.u_.obj;
+            case Type::String:
+                if (JSON_UNLIKELY(is_raw() || other.is_raw())) {
+                    std::string a, b;
+                    return decoded_view(a) == other.decoded_view(b);
+                }
+                return str_view() == other.str_view();
+            case Type::RawNumber: return str_view() == other.str_view();
+            case Type::Array:
+                if (JSON_UNLIKELY(is_packed() || other.is_packed())) return packed_equal(other);
+                return containers_equal(other);
+            case Type::Object:  return containers_equal(other);
         }
         return false;
     }
@@ -373,6 +530,21 @@ public:
     [[nodiscard]] std::string dump(const struct SerializeOptions& opts) const;
 
 private:
+    /// Packed array payload: the numbers, and the regular Array that const
+    /// element access reads, built from them on first use (packed_view()).
+    template <typename T>
+    struct Packed {
+        std::pmr::vector<T> values;
+        mutable std::atomic<Array*> view{nullptr};
+
+        explicit Packed(std::pmr::vector<T>&& v) noexcept : values(std::move(v)) {}
+        Packed(const Packed&) = delete;
+        Packed& operator=(const Packed&) = delete;
+        ~Packed() { delete view.load(std::memory_order_acquire); }
+    };
+    using PackedInts = Packed<int64_t>;
+    using PackedFloats = Packed<double>;
+
     Type kind_;
     uint8_t sso_len_;
     uint8_t pad_[6] = {};
@@ -380,18 +552,146 @@ private:
         bool b; int64_t i; uint64_t u; double d;
         char sso_buf[16];
         std::string* str_ptr;
-        const char* arena_str;  ///< For arena-allocated strings: raw char* into arena
+        const char* arena_str;  ///< Arena-allocated or borrowed string: not owned
+        struct {
+            const char* data;       ///< Escaped content in the input (not owned)
+            MonotonicArena* arena;  ///< Arena for the decoded copy, or null (heap)
+        } raw;                      ///< Not yet unescaped (kRawFlag)
         Array* arr;
         Object* obj;
+        PackedInts* ints;      ///< Packed integer array (kPackedFlag)
+        PackedFloats* floats;  ///< Packed float array (kPackedFlag | kFloatsFlag)
     } u_;
 
     static constexpr size_t kSsoMax = 15;
     static constexpr uint8_t kHeapTag = 0xFF;
     static constexpr uint8_t kArenaFlag = 0x01;
+    static constexpr uint8_t kRawFlag = 0x02;  ///< With kArenaFlag: u_.raw, decoded on access
+    static constexpr uint8_t kPackedFlag = 0x04;  ///< Array: u_.ints or u_.floats, expanded on access
+    static constexpr uint8_t kFloatsFlag = 0x08;  ///< With kPackedFlag: u_.floats
     static constexpr size_t kArenaMaxStringLen = static_cast<size_t>(std::numeric_limits<uint32_t>::max());
 
     bool is_sso() const noexcept { return sso_len_ != kHeapTag; }
 
+    /// @brief The Integer, UInteger or Float value a raw number's text
+    /// converts to — the value it would have been parsed as.
+    JsonValue converted_number() const noexcept {
+        const std::string_view t = str_view();
+        const char* first = t.data();
+        const char* last = first + t.size();
+        if (t.find_first_of(".eE") == std::string_view::npos) {
+            int64_t i;
+            if (std::from_chars(first, last, i).ec == std::errc{}) return JsonValue(i);
+            uint64_t u;
+            if (*first != '-' && std::from_chars(first, last, u).ec == std::errc{}) {
+                return JsonValue(u);
+            }
+        }
+        return JsonValue(detail::decimal_to_double(first, last));
+    }
+
+    /// @brief Take ownership of packed numbers (int64_t or double), placing
+    /// them in @p arena if not null.
+    template <typename T>
+    void init_packed(std::pmr::vector<T>&& v, MonotonicArena* arena) {
+        auto* p = arena ? arena->construct<Packed<T>>(std::pmr::vector<T>(std::move(v), arena))
+                        : new Packed<T>(std::move(v));
+        if constexpr (std::is_same_v<T, double>) {
+            u_.floats = p;
+            pad_[0] |= kPackedFlag | kFloatsFlag;
+        } else {
+            static_assert(std::is_same_v<T, int64_t>, "not a packed element type");
+            u_.ints = p;
+            pad_[0] |= kPackedFlag;
+        }
+        if (arena) pad_[0] |= kArenaFlag;
+    }
+
+    template <typename V>
+    static JsonValue from_packed(V&& v, MonotonicArena* arena) {
+        JsonValue out;
+        out.kind_ = Type::Array;
+        out.init_packed(std::forward<V>(v), arena);
+        return out;
+    }
+
+    template <typename T>
+    static JsonValue make_packed(Span<const T> values) {
+        return from_packed(std::pmr::vector<T>(values.begin(), values.end(), detail::current_resource()),
+                           detail::current_arena);
+    }
+
+    size_t packed_size() const noexcept {
+        return (pad_[0] & kFloatsFlag) ? u_.floats->values.size() : u_.ints->values.size();
+    }
+
+    /// Element @p i of a packed array as an Integer or Float value.
+    JsonValue packed_at(size_t i) const noexcept {
+        if (pad_[0] & kFloatsFlag) return JsonValue(u_.floats->values[i]);
+        return JsonValue(u_.ints->values[i]);
+    }
+
+    /// The regular Array that const access reads for a packed array. Built
+    /// on the heap on first use and published with a compare-exchange, so
+    /// concurrent const readers are safe; the packed form is not modified.
+    const Array& packed_view() const {
+        auto& slot = (pad_[0] & kFloatsFlag) ? u_.floats->view : u_.ints->view;
+        if (Array* v = slot.load(std::memory_order_acquire)) return *v;
+        return build_packed_view(slot);
+    }
+
+    JSON_NOINLINE const Array& build_packed_view(std::atomic<Array*>& slot) const {
+        auto fresh = std::make_unique<Array>(std::pmr::new_delete_resource());
+        const size_t n = packed_size();
+        fresh->reserve(n);
+        for (size_t i = 0; i < n; ++i) fresh->push_back(packed_at(i));
+        Array* published = nullptr;
+        if (slot.compare_exchange_strong(published, fresh.get(),
+                                         std::memory_order_acq_rel, std::memory_order_acquire))
+            return *fresh.release();
+        return *published;  // another reader got there first
+    }
+
+    std::string packed_type_name() const {
+        if (!is_packed()) return type_name(type());
+        return (pad_[0] & kFloatsFlag) ? "packed float array" : "packed integer array";
+    }
+
+    /// Array equality where at least one side is packed.
+    bool packed_equal(const JsonValue& o) const {
+        if (!is_packed()) return o.packed_equal(*this);
+        const size_t n = packed_size();
+        if (n != o.size()) return false;
+        for (size_t i = 0; i < n; ++i) {
+            if (o.is_packed() ? packed_at(i) != o.packed_at(i) : packed_at(i) != (*o.u_.arr)[i])
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief Replace a packed array with the equivalent regular Array, in the
+    /// same arena (or on the heap); see unpack().
+    JSON_NOINLINE Array& unpack_packed() {
+        const bool arena = is_arena();
+        std::pmr::memory_resource* mr = (pad_[0] & kFloatsFlag)
+            ? u_.floats->values.get_allocator().resource() : u_.ints->values.get_allocator().resource();
+        Array arr(mr);
+        arr.reserve(packed_size());
+        if (pad_[0] & kFloatsFlag) { for (double d : u_.floats->values) arr.emplace_back(d); }
+        else                       { for (int64_t i : u_.ints->values) arr.emplace_back(i); }
+        Array* p;
+        if (arena) {
+            auto* a = static_cast<MonotonicArena*>(mr);
+            p = a->construct<Array>(std::move(arr), a);
+        } else {
+            p = new Array(std::move(arr));
+        }
+        destroy();
+        pad_[0] &= static_cast<uint8_t>(~(kPackedFlag | kFloatsFlag));
+        u_.arr = p;
+        return *p;
+    }
+
     /// Check if this value has arena-allocated payload.
     bool is_arena() const noexcept { return pad_[0] & kArenaFlag; }
 
@@ -421,10 +721,70 @@ private:
         return len;
     }
 
-    std::string_view str_view() const noexcept {
+    /// Stored text of a string or raw number; never called on a raw string.
+    std::string_view str_view() const {
         if (is_sso()) return {u_.sso_buf, sso_len_};
-        if (JSON_UNLIKELY(is_arena()))
-            return {u_.arena_str, arena_str_len()};
+        if (JSON_UNLIKELY(is_arena())) return {u_.arena_str, arena_str_len()};
+        return {u_.str_ptr->data(), u_.str_ptr->size()};
+    }
+
+    /// Text of a string without modifying it: a raw string is decoded into
+    /// @p scratch, anything else is viewed in place.
+    std::string_view decoded_view(std::string& scratch) const {
+        if (JSON_LIKELY(!is_raw())) return str_view();
+        const std::string_view raw = raw_view();
+        scratch.resize(raw.size());
+        scratch.resize(detail::utf8::unescape(raw.data(), raw.size(), scratch.data()));
+        return scratch;
+    }
+
+    [[noreturn]] JSON_NOINLINE static void throw_undecoded() {
+        throw TypeError("lazily unescaped string read through a const value: "
+                        "decode it with non-const as_string_view() first");
+    }
+
+    /// True for a string still holding its escaped input bytes.
+    bool is_raw() const noexcept { return pad_[0] & kRawFlag; }
+
+    /// Escaped content of a raw string (valid JSON string content).
+    std::string_view raw_view() const noexcept { return {u_.raw.data, arena_str_len()}; }
+
+    /// @brief Store escaped string content [p, p + len) to be decoded on first
+    /// access, into @p arena if not null (see ParseOptions::lazy_unescape).
+    void set_raw_str(const char* p, uint32_t len, MonotonicArena* arena) noexcept {
+        pad_[0] |= kArenaFlag | kRawFlag;
+        std::memcpy(&pad_[1], &len, sizeof(uint32_t));
+        u_.raw.data = p;
+        u_.raw.arena = arena;
+    }
+
+    /// @brief Decode a raw string in place: into SSO if short, else into its
+    /// arena or a heap string. Only reachable through non-const access.
+    JSON_NOINLINE std::string_view unescape_raw() {
+        const std::string_view raw = raw_view();
+        MonotonicArena* arena = u_.raw.arena;
+        if (raw.size() <= kSsoMax + 1) {
+            char buf[kSsoMax + 1];
+            const size_t len = detail::utf8::unescape(raw.data(), raw.size(), buf);
+            if (len <= kSsoMax) {
+                pad_[0] = 0;
+                sso_len_ = static_cast<uint8_t>(len);
+                std::memcpy(u_.sso_buf, buf, len);
+                u_.sso_buf[len] = '\0';
+                return {u_.sso_buf, len};
+            }
+        }
+        if (arena) {
+            auto* buf = static_cast<char*>(arena->allocate(raw.size(), 1));
+            const size_t len = detail::utf8::unescape(raw.data(), raw.size(), buf);
+            pad_[0] &= static_cast<uint8_t>(~kRawFlag);
+            set_arena_str(buf, static_cast<uint32_t>(len));
+            return {buf, len};
+        }
+        auto s = std::make_unique<std::string>(raw.size(), '\0');
+        s->resize(detail::utf8::unescape(raw.data(), raw.size(), s->data()));
+        pad_[0] = 0;
+        u_.str_ptr = s.release();
         return {u_.str_ptr->data(), u_.str_ptr->size()};
     }
 
@@ -468,10 +828,12 @@ private:
         auto* mr = detail::current_resource();
         switch (o.kind_) {
             case Type::String:
+            case Type::RawNumber:  // the token text is stored like a string
                 if (o.is_sso()) {
                     std::memcpy(u_.sso_buf, o.u_.sso_buf, sizeof(u_.sso_buf));
                 } else {
-                    auto sv = o.str_view();
+                    std::string scratch;
+                    auto sv = o.decoded_view(scratch);
                     if (JSON_UNLIKELY(arena != nullptr && can_store_arena_len(sv.size()))) {
                         sso_len_ = kHeapTag;
                         auto* buf = static_cast<char*>(arena->allocate(sv.size(), 1));
@@ -483,20 +845,15 @@ private:
                 }
                 break;
             case Type::Array:
-                if (JSON_UNLIKELY(arena != nullptr)) {
-                    u_.arr = arena->construct<Array>(o.u_.arr->begin(), o.u_.arr->end(), mr);
-                    pad_[0] |= kArenaFlag;
+                if (JSON_UNLIKELY(o.is_packed())) {
+                    if (o.pad_[0] & kFloatsFlag) init_packed(std::pmr::vector<double>(o.u_.floats->values, mr), arena);
+                    else                         init_packed(std::pmr::vector<int64_t>(o.u_.ints->values, mr), arena);
                 } else {
-                    u_.arr = new Array(*o.u_.arr);
+                    copy_container(o);
                 }
                 break;
             case Type::Object:
-                if (JSON_UNLIKELY(arena != nullptr)) {
-                    u_.obj = arena->construct<Object>(*o.u_.obj);
-                    pad_[0] |= kArenaFlag;
-                } else {
-                    u_.obj = new Object(*o.u_.obj);
-                }
+                copy_container(o);
                 break;
             default:
                 std::memcpy(&u_, &o.u_, sizeof(u_));
@@ -504,26 +861,187 @@ private:
         }
     }
 
+    // ─── Containers: recursion bounded by kMaxNativeDepth ───────────────
+    //
+    // destroy, copy and comparison recurse through nested containers with
+    // native frames up to kMaxNativeDepth levels below the outermost call.
+    // Deeper containers are queued for that call (detail::DeferredTraversal)
+    // when copying or comparing, and freed by free_subtree() when destroying.
+
+    static constexpr size_t kMaxNativeDepth = YAJSON_MAX_DEPTH;
+    static inline thread_local size_t destroy_depth_ = 0;
+    static inline thread_local detail::DeferredTraversal<std::pair<JsonValue*, const JsonValue*>> copying_;
+    static inline thread_local detail::DeferredTraversal<std::pair<const JsonValue*, const JsonValue*>> comparing_;
+
+    /// Copy the Array or Object payload of @p o (kind_ is already o.kind_).
+    void copy_container(const JsonValue& o) {
+        auto& t = copying_;
+        if (JSON_UNLIKELY(t.depth >= kMaxNativeDepth)) {
+            kind_ = Type::Null;  // until the outermost call copies it
+            t.queue->emplace_back(this, &o);
+            return;
+        }
+        if (JSON_LIKELY(t.depth != 0)) {
+            ++t.depth;
+            clone_container(o);
+            --t.depth;
+            return;
+        }
+        std::vector<std::pair<JsonValue*, const JsonValue*>> queue;
+        detail::TraversalScope<std::pair<JsonValue*, const JsonValue*>> scope(t, queue);
+        clone_container(o);
+        try {
+            // Element addresses are stable: no container is resized meanwhile
+            while (!queue.empty()) {
+                const auto [dst, src] = queue.back();
+                queue.pop_back();
+                dst->clone_container(*src);
+                dst->kind_ = src->kind_;
+            }
+        } catch (...) {
+            destroy();
+            kind_ = Type::Null;
+            throw;
+        }
+    }
+
+    void clone_container(const JsonValue& o) {
+        auto* arena = detail::current_arena;
+        if (o.kind_ == Type::Array) {
+            if (JSON_UNLIKELY(arena != nullptr)) {
+                u_.arr = arena->construct<Array>(o.u_.arr->begin(), o.u_.arr->end(),
+                                                 detail::current_resource());
+                pad_[0] |= kArenaFlag;
+            } else {
+                u_.arr = new Array(*o.u_.arr);
+            }
+        } else if (JSON_UNLIKELY(arena != nullptr)) {
+            u_.obj = arena->construct<Object>(*o.u_.obj);
+            pad_[0] |= kArenaFlag;
+        } else {
+            u_.obj = new Object(*o.u_.obj);
+        }
+    }
+
+    /// Equality of two non-packed Arrays or two Objects.
+    bool containers_equal(const JsonValue& o) const {
+        auto& t = comparing_;
+        if (JSON_UNLIKELY(t.depth >= kMaxNativeDepth)) {
+            t.queue->emplace_back(this, &o);  // the outermost call compares it
+            return true;
+        }
+        if (JSON_LIKELY(t.depth != 0)) {
+            ++t.depth;
+            const bool eq = elements_equal(o);
+            --t.depth;
+            return eq;
+        }
+        std::vector<std::pair<const JsonValue*, const JsonValue*>> queue;
+        detail::TraversalScope<std::pair<const JsonValue*, const JsonValue*>> scope(t, queue);
+        if (!elements_equal(o)) return false;
+        while (!queue.empty()) {
+            const auto [a, b] = queue.back();
+            queue.pop_back();
+            if (!a->elements_equal(*b)) return false;
+        }
+        return true;
+    }
+
+    bool elements_equal(const JsonValue& o) const {
+        return kind_ == Type::Array ? *u_.arr == *o.u_.arr : *u_.obj == *o.u_.obj;
+    }
+
+    /// Free the Array or Object payload.
+    void destroy_container() noexcept {
+        size_t& depth = destroy_depth_;
+        if (JSON_UNLIKELY(depth >= kMaxNativeDepth)) {
+            free_subtree(std::move(*this));
+            return;
+        }
+        ++depth;
+        free_container();
+        --depth;
+    }
+
+    /// Free the container @p v and everything below it with neither
+    /// recursion nor allocation (destruction is noexcept). Walks down through
+    /// the last element of each container, parking the way back up in the
+    /// slot it came from (pointer reversal); a container is freed once all
+    /// its elements have been popped.
+    static void free_subtree(JsonValue v) noexcept {
+        JsonValue up;  // v's parent; its last slot holds v's grandparent
+        for (;;) {
+            JsonValue* last = v.last_slot();
+            if (last == nullptr) {
+                v.free_container();
+                v.kind_ = Type::Null;
+                if (up.kind_ == Type::Null) return;
+                v = std::move(up);
+                up = std::move(*v.last_slot());
+                v.pop_slot();
+            } else if (last->kind_ == Type::Object ||
+                       (last->kind_ == Type::Array && !(last->pad_[0] & kPackedFlag))) {
+                JsonValue child = std::move(*last);
+                *last = std::move(up);
+                up = std::move(v);
+                v = std::move(child);
+            } else {
+                v.pop_slot();  // scalar or packed array: freed in place
+            }
+        }
+    }
+
+    /// Last element of a non-packed Array or an Object, nullptr when empty.
+    JsonValue* last_slot() noexcept {
+        if (kind_ == Type::Object) {
+            auto& entries = u_.obj->storage();
+            return entries.empty() ? nullptr : &entries.back().second;
+        }
+        // An arena array in moved-from state has no elements to visit
+        return u_.arr->empty() || u_.arr->data() == nullptr ? nullptr : &u_.arr->back();
+    }
+
+    void pop_slot() noexcept {
+        if (kind_ == Type::Object) u_.obj->storage().pop_back();
+        else                       u_.arr->pop_back();
+    }
+
+    void free_container() noexcept {
+        const bool arena = is_arena();
+        if (kind_ == Type::Object) {
+            if (arena) u_.obj->~Object();
+            else       delete u_.obj;
+        } else if (arena) {
+            // Skip destructor if vector is in moved-from state (avoids crash on reset).
+            if (u_.arr->data() != nullptr || u_.arr->size() == 0)
+                u_.arr->~Array();
+        } else {
+            delete u_.arr;
+        }
+    }
+
     void destroy() noexcept {
         const bool arena = is_arena();
         switch (kind_) {
             case Type::String:
+            case Type::RawNumber:
                 // Arena strings: raw char* in arena, nothing to free.
                 // Heap strings: delete the std::string object.
                 if (!is_sso() && !arena) delete u_.str_ptr;
                 break;
             case Type::Array:
-                if (arena) {
-                    // Skip destructor if vector is in moved-from state (avoids crash on reset).
-                    if (u_.arr->data() != nullptr || u_.arr->size() == 0)
-                        u_.arr->~Array();
+                if (JSON_UNLIKELY(pad_[0] & kPackedFlag)) {
+                    if (pad_[0] & kFloatsFlag) {
+                        if (arena) u_.floats->~PackedFloats(); else delete u_.floats;
+                    } else {
+                        if (arena) u_.ints->~PackedInts(); else delete u_.ints;
+                    }
                 } else {
-                    delete u_.arr;
+                    destroy_container();
                 }
                 break;
             case Type::Object:
-                if (arena) u_.obj->~Object();
-                else       delete u_.obj;
+                destroy_container();
                 break;
             default: break;
         }
@@ -537,8 +1055,11 @@ static_assert(sizeof(JsonValue) == 24, "JsonValue must be exactly 24 bytes");
 // ─── Object special member functions ─────────────────────────────────────
 
 inline Object::~Object() = default;
+// Like Array, a copy takes its storage from the current arena (or the heap),
+// not from o's resource: a copy made outside any ArenaScope must not point
+// into the arena o lives in.
 inline Object::Object(const Object& o)
-    : entries(o.entries, o.get_resource()) {}
+    : entries(o.entries, detail::current_resource()) {}
 inline Object::Object(Object&& o) noexcept
     : entries(std::move(o.entries)), index_(std::move(o.index_)) {}
 inline Object& Object::operator=(const Object& o) {
@@ -7,8 +7,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 using namespace yajson;
@@ -106,6 +111,19 @@ TEST(MonotonicArena, ResetFreesOverflowBlocks) {
     EXPECT_EQ(arena.bytes_remaining(), sizeof(buf));
 }
 
+TEST(MonotonicArena, ResetRestartsBlockGrowth) {
+    alignas(16) char buf[64];
+    MonotonicArena arena(buf, sizeof(buf));
+
+    // Each cycle overflows into a few blocks; reset must not let the next
+    // block size keep doubling from cycle to cycle.
+    for (int cycle = 0; cycle < 64; ++cycle) {
+        for (int i = 0; i < 4; ++i) ASSERT_NE(arena.allocate(3000, 1), nullptr);
+        EXPECT_LT(arena.bytes_allocated(), 64u * 1024) << cycle;
+        arena.reset();
+    }
+}
+
 TEST(MonotonicArena, Construct) {
     MonotonicArena arena(4096);
     auto* s = arena.construct<std::string>("hello world");
@@ -283,6 +301,20 @@ TEST(ArenaJsonValue, CopyFromArenaProducesIndependentValue) {
     EXPECT_EQ(copy_outside.as_string(), long_str);
 }
 
+TEST(ArenaJsonValue, ObjectCopyOutsideArenaIsHeapAllocated) {
+    MonotonicArena arena(4096);
+    JsonValue copy;
+    {
+        auto v = parse(R"({"key":{"a":1},"list":[1,2]})", arena);
+        copy = v;  // no ArenaScope active here
+        EXPECT_NE(copy.as_object().get_resource(), static_cast<std::pmr::memory_resource*>(&arena));
+    }
+    arena.reset();
+    (void)parse(R"({"zzz":[9,9,9,9,9,9,9,9],"yyy":"overwrite the arena buffer"})", arena);
+
+    EXPECT_EQ(copy, parse(R"({"key":{"a":1},"list":[1,2]})"));
+}
+
 TEST(ArenaJsonValue, SwapPreservesFlags) {
     MonotonicArena arena(4096);
     ArenaScope scope(arena);
@@ -547,3 +579,195 @@ TEST(ArenaDocument, TryParse) {
     res = doc.try_parse("invalid");
     EXPECT_FALSE(res);
 }
+
+// =============================================================================
+// Borrowed strings (ParseOptions::borrow_strings)
+// =============================================================================
+
+namespace {
+
+ParseOptions borrowing() {
+    ParseOptions opts;
+    opts.borrow_strings = true;
+    return opts;
+}
+
+bool points_into(std::string_view s, const std::string& buf) {
+    return s.data() >= buf.data() && s.data() + s.size() <= buf.data() + buf.size();
+}
+
+} // namespace
+
+TEST(BorrowStrings, LongUnescapedStringsReferenceInput) {
+    const std::string input =
+        R"({"long": "a string well past the SSO limit", "short": "tiny",)"
+        R"( "escaped": "line one\nline two, also long", "arr": ["another long string value"]})";
+    for (bool indexed : {false, true}) {
+        ParseOptions opts = borrowing();
+        opts.structural_index = indexed;
+        auto v = parse(input, opts);
+        EXPECT_TRUE(points_into(v["long"].as_string_view(), input));
+        EXPECT_TRUE(points_into(v["arr"][0].as_string_view(), input));
+        EXPECT_FALSE(points_into(v["short"].as_string_view(), input));
+        EXPECT_FALSE(points_into(v["escaped"].as_string_view(), input));
+        EXPECT_EQ(v, parse(input));
+    }
+}
+
+TEST(BorrowStrings, CopiesOwnTheirStrings) {
+    std::string input = R"(["a string well past the SSO limit"])";
+    JsonValue copy;
+    {
+        auto v = parse(input, borrowing());
+        copy = v;
+        JsonValue moved = std::move(v);
+        EXPECT_TRUE(points_into(moved[0].as_string_view(), input));
+    }
+    EXPECT_FALSE(points_into(copy[0].as_string_view(), input));
+    input.assign(input.size(), 'x');
+    EXPECT_EQ(copy[0].as_string(), "a string well past the SSO limit");
+}
+
+TEST(BorrowStrings, AssignmentReplacesBorrowedString) {
+    const std::string input = R"({"k": "a string well past the SSO limit"})";
+    auto v = parse(input, borrowing());
+    v["k"] = "replaced by an owned string, also long";
+    EXPECT_FALSE(points_into(v["k"].as_string_view(), input));
+    EXPECT_EQ(v["k"].as_string(), "replaced by an owned string, also long");
+}
+
+TEST(BorrowStrings, IgnoredForStreams) {
+    std::istringstream is(R"(["a string well past the SSO limit"])");
+    auto v = parse(is, borrowing());
+    EXPECT_EQ(v[0].as_string(), "a string well past the SSO limit");
+}
+
+TEST(BorrowStrings, FileDocumentKeepsContents) {
+    const std::string path = ::testing::TempDir() + "yajson_borrow_test.json";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << R"({"name": "a string well past the SSO limit", "n": 1})";
+    }
+    FileDocument doc(path, borrowing());
+    FileDocument moved = std::move(doc);
+    const auto name = moved.root()["name"].as_string_view();
+    EXPECT_EQ(name, "a string well past the SSO limit");
+    EXPECT_GE(name.data(), moved.text().data());
+    EXPECT_LE(name.data() + name.size(), moved.text().data() + moved.text().size());
+    std::remove(path.c_str());
+    EXPECT_THROW(FileDocument{path}, ParseError);
+}
+
+// =============================================================================
+// Lazy unescaping (ParseOptions::lazy_unescape)
+// =============================================================================
+
+namespace {
+
+ParseOptions lazy() {
+    ParseOptions opts = borrowing();
+    opts.lazy_unescape = true;
+    return opts;
+}
+
+const char* const kEscapedDoc = R"({
+    "trace": "at f()\n\tat g()\n\tat \"main\" (file.cpp:12)\n",
+    "html": "<a href=\"\/x\">café 😀<\/a>",
+    "short": "a\nb",
+    "list": ["x\\y is a longer escaped element \ud83d\ude00\u00E9", "plain"]
+})";
+
+} // namespace
+
+TEST(LazyUnescape, DecodesOnAccess) {
+    for (bool with_arena : {false, true}) {
+        MonotonicArena arena(4096);
+        std::optional<ArenaScope> scope;
+        if (with_arena) scope.emplace(arena);
+        auto v = parse(kEscapedDoc, lazy());
+        const auto want = parse(kEscapedDoc);
+        EXPECT_EQ(v["html"].as_string_view(), "<a href=\"/x\">caf\xC3\xA9 \xF0\x9F\x98\x80</a>");
+        EXPECT_EQ(v["html"].as_string_view(), want["html"].as_string_view());  // cached
+        EXPECT_EQ(v, want);
+        EXPECT_EQ(v["list"][0].as_string(), "x\\y is a longer escaped element \xF0\x9F\x98\x80\xC3\xA9");
+    }
+}
+
+TEST(LazyUnescape, ConstAccessDoesNotModify) {
+    const auto v = parse(kEscapedDoc, lazy());
+    const JsonValue& html = v["html"];
+    EXPECT_TRUE(html.is_lazy_string());
+    EXPECT_THROW((void)html.as_string_view(), TypeError);
+    EXPECT_THROW((void)html.get_or<std::string_view>("none"), TypeError);  // present, never the default
+    EXPECT_EQ(v["list"].get_or<std::string_view>("none"), "none");
+    EXPECT_EQ(html.as_string(), "<a href=\"/x\">caf\xC3\xA9 \xF0\x9F\x98\x80</a>");
+    EXPECT_EQ(html.get_or<std::string>(""), html.as_string());
+    EXPECT_EQ(v, parse(kEscapedDoc));
+    // Still raw: serialized from its original escaped bytes
+    EXPECT_NE(v.dump().find(R"(<\/a>)"), std::string::npos);
+    EXPECT_THROW((void)html.as_string_view(), TypeError);
+
+    // Concurrent const readers only ever decode into temporaries
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&v] {
+            for (int i = 0; i < 200; ++i) {
+                EXPECT_EQ(v["trace"].as_string(), "at f()\n\tat g()\n\tat \"main\" (file.cpp:12)\n");
+                EXPECT_NE(v.dump().find(R"(\"main\")"), std::string::npos);
+            }
+        });
+    }
+    for (auto& r : readers) r.join();
+}
+
+TEST(LazyUnescape, GetOrStringViewDecodesNonConst) {
+    auto v = parse(kEscapedDoc, lazy());
+    JsonValue& html = v["html"];
+    ASSERT_TRUE(html.is_lazy_string());
+    EXPECT_EQ(html.get_or<std::string_view>("none"), "<a href=\"/x\">caf\xC3\xA9 \xF0\x9F\x98\x80</a>");
+    EXPECT_FALSE(html.is_lazy_string());
+    EXPECT_EQ(std::as_const(html).get_or<std::string_view>("none"), html.as_string_view());
+    EXPECT_EQ(v["short"].get_or<std::string_view>("none"), "a\nb");
+    EXPECT_EQ(JsonValue(1).get_or<std::string_view>("none"), "none");
+}
+
+TEST(LazyUnescape, SerializesRawBytes) {
+    auto v = parse(kEscapedDoc, lazy());
+    const std::string out = v.dump();
+    EXPECT_NE(out.find(R"("<a href=\"\/x\">café 😀<\/a>")"), std::string::npos);
+    EXPECT_EQ(parse(out), parse(kEscapedDoc));
+
+    // Once decoded, the value is serialized normally
+    (void)v["html"].as_string_view();
+    EXPECT_NE(v.dump().find("caf\xC3\xA9"), std::string::npos);
+
+    // ensure_ascii always re-escapes
+    SerializeOptions ascii;
+    ascii.ensure_ascii = true;
+    const auto w = parse(kEscapedDoc, lazy());
+    EXPECT_EQ(w.dump(ascii), parse(kEscapedDoc).dump(ascii));
+}
+
+TEST(LazyUnescape, CopiesAreDecoded) {
+    std::string input = kEscapedDoc;
+    JsonValue copy;
+    {
+        const auto v = parse(input, lazy());
+        copy = v["trace"];
+    }
+    input.assign(input.size(), ' ');
+    EXPECT_EQ(copy.as_string(), "at f()\n\tat g()\n\tat \"main\" (file.cpp:12)\n");
+}
+
+TEST(LazyUnescape, EscapesAreStillValidated) {
+    for (const char* doc : {R"(["a long string with a bad escape \q"])",
+                            R"(["a long string with \ud800 lone surrogate"])",
+                            R"(["a long string with \u12G4 bad hex"])",
+                            "[\"a long string with a raw \x01 control char\"]"}) {
+        auto want = try_parse(doc);
+        ASSERT_FALSE(want) << doc;
+        auto got = try_parse(doc, lazy());
+        EXPECT_FALSE(got) << doc;
+        EXPECT_EQ(got.ec, want.ec) << doc;
+    }
+}
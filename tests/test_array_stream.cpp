@@ -0,0 +1,175 @@
+/// @file test_array_stream.cpp
+/// @brief Unit tests for ArrayStreamReader (root arrays read from a stream).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+/// Array whose strings are full of characters that look structural.
+std::string make_tricky_array(size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    const char* const pieces[] = {",", "]", "[", "{", "}", "\\\"", "\\\\", ":", " ", "x"};
+    std::string s = "  [\n";
+    for (size_t i = 0; i < n; ++i) {
+        if (i) s += i % 7 == 0 ? " ,\n " : ",";
+        switch (rng() % 5) {
+            case 0: s += std::to_string(rng() % 100000); break;
+            case 1: {
+                s += '"';
+                const size_t len = rng() % 40;
+                for (size_t k = 0; k < len; ++k) s += pieces[rng() % 10];
+                s += '"';
+                break;
+            }
+            case 2: s += R"({"k":[1,"]",{"a":"\\"}],"s":"a,b"})"; break;
+            case 3: s += "[[],[[]],{},\"[\"]"; break;
+            default: s += "true"; break;
+        }
+    }
+    s += "\n]  ";
+    return s;
+}
+
+std::vector<JsonValue> read_all(const std::string& input, const ParseOptions& opts = {},
+                                size_t chunk = ArrayStreamReader::kDefaultChunkSize) {
+    std::istringstream in(input);
+    ArrayStreamReader reader(in, opts, chunk);
+    std::vector<JsonValue> out;
+    while (reader.next()) out.push_back(reader.value());  // heap copy
+    return out;
+}
+
+/// Error code and offset of parse(input) and of reading it as a stream.
+void expect_same_error(const std::string& input, const ParseOptions& opts = {}) {
+    SCOPED_TRACE(input);
+    SourceLocation want_loc;
+    std::error_code want;
+    try {
+        (void)parse(input, opts);
+    } catch (const ParseError& e) {
+        want = e.code();
+        want_loc = e.location();
+    }
+    ASSERT_TRUE(want);
+
+    std::istringstream in(input);
+    ArrayStreamReader reader(in, opts, 64);
+    try {
+        while (reader.next()) {}
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), want);
+        EXPECT_EQ(e.location().offset, want_loc.offset);
+        EXPECT_EQ(e.location().line, want_loc.line);
+        EXPECT_EQ(e.location().column, want_loc.column);
+    }
+}
+
+} // namespace
+
+TEST(ArrayStream, MatchesParse) {
+    const std::string input = make_tricky_array(3000, 7);
+    const JsonValue want = parse(input);
+    for (size_t chunk : {64u, 100u, 4096u, 1u << 20}) {
+        const auto got = read_all(input, {}, chunk);
+        ASSERT_EQ(got.size(), want.size()) << chunk;
+        for (size_t i = 0; i < got.size(); ++i) {
+            ASSERT_EQ(got[i], want[i]) << "chunk " << chunk << ", element " << i;
+        }
+    }
+}
+
+TEST(ArrayStream, EmptyAndTrailingComma) {
+    EXPECT_TRUE(read_all("[]").empty());
+    EXPECT_TRUE(read_all(" \n[ \t]\n").empty());
+    EXPECT_EQ(read_all("[1]").size(), 1u);
+    EXPECT_THROW(read_all("[1,]"), ParseError);
+    EXPECT_EQ(read_all("[1,]", ParseOptions::lenient()).size(), 1u);
+}
+
+TEST(ArrayStream, Comments) {
+    const std::string input =
+        "// header\n[ /* a, ] */ 1, // x ]\n \"y\" /* } */, [2,/*]*/3] ]\n// end";
+    const auto got = read_all(input, ParseOptions::json5(), 64);
+    ASSERT_EQ(got.size(), 3u);
+    EXPECT_EQ(got[0].as_integer(), 1);
+    EXPECT_EQ(got[1].as_string(), "y");
+    EXPECT_EQ(got[2][1].as_integer(), 3);
+}
+
+TEST(ArrayStream, ErrorsMatchParse) {
+    expect_same_error("");
+    expect_same_error("  @");
+    expect_same_error("[1, 2");
+    expect_same_error("[1, \"abc");
+    expect_same_error("[1, {\"a\": tru}]");
+    expect_same_error("[1,\n 2,\n 3x]");
+    expect_same_error("[1] 2");
+    expect_same_error("[1,, 2]");
+    expect_same_error("[1, 2 3");
+
+    std::istringstream in(R"({"a":1})");
+    ArrayStreamReader reader(in);
+    EXPECT_THROW(reader.next(), ParseError);
+    EXPECT_FALSE(reader.next());
+}
+
+TEST(ArrayStream, ContinuesAfterBadElement) {
+    std::istringstream in("[1, {\"a\":}, 3]");
+    ArrayStreamReader reader(in);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.value().as_integer(), 1);
+    EXPECT_THROW(reader.next(), ParseError);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.value().as_integer(), 3);
+    EXPECT_FALSE(reader.next());
+    EXPECT_EQ(reader.count(), 3u);
+}
+
+TEST(ArrayStream, WindowBoundedByLargestElement) {
+    std::string input = "[";
+    for (int i = 0; i < 20000; ++i) {
+        if (i) input += ',';
+        input += R"({"id":)" + std::to_string(i) + R"(,"name":"a string that is longer than SSO"})";
+    }
+    input += ']';
+
+    std::istringstream in(input);
+    ArrayStreamReader reader(in, {}, 4096);
+    int64_t sum = 0;
+    while (reader.next()) sum += reader.value()["id"].as_integer();
+    EXPECT_EQ(sum, int64_t{20000} * 19999 / 2);
+    EXPECT_LE(reader.buffer_capacity(), 8192u);
+    EXPECT_EQ(reader.offset(), input.size());
+
+    // One element larger than the chunk grows the window to fit it
+    const std::string big = "[\"" + std::string(50000, 'x') + "\", 1]";
+    const auto got = read_all(big, {}, 4096);
+    ASSERT_EQ(got.size(), 2u);
+    EXPECT_EQ(got[0].as_string().size(), 50000u);
+}
+
+TEST(ArrayStream, OpenFile) {
+    const std::string path = testing::TempDir() + "yajson_array_stream_test.json";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "[{\"id\":1},{\"id\":2},{\"id\":4}]\n";
+    }
+    int64_t sum = 0;
+    for (const auto& v : ArrayStreamReader::open(path)) sum += v["id"].as_integer();
+    EXPECT_EQ(sum, 7);
+    std::remove(path.c_str());
+
+    EXPECT_THROW((void)ArrayStreamReader::open(path + ".missing"), ParseError);
+}
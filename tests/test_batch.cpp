@@ -0,0 +1,100 @@
+/// @file test_batch.cpp
+/// @brief Unit tests for parse_batch() and ParallelBatch.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+std::vector<std::string> make_messages(size_t n) {
+    std::vector<std::string> msgs;
+    msgs.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        switch (i % 6) {
+            case 0: msgs.push_back(R"({"id":)" + std::to_string(i) + R"(,"ok":true})"); break;
+            case 1: msgs.push_back(R"(["a\n)" + std::to_string(i) + R"(",2.5,null])"); break;
+            case 2: msgs.push_back("[1, 2, ]"); break;
+            case 3: msgs.push_back(R"({"k":"a long string that does not fit in SSO storage"})"); break;
+            case 4: msgs.push_back(""); break;
+            default: msgs.push_back(std::to_string(i) + " extra"); break;
+        }
+    }
+    return msgs;
+}
+
+std::vector<std::string_view> views_of(const std::vector<std::string>& msgs) {
+    return std::vector<std::string_view>(msgs.begin(), msgs.end());
+}
+
+} // namespace
+
+TEST(Batch, MatchesTryParse) {
+    const auto msgs = make_messages(60);
+    const auto views = views_of(msgs);
+    MonotonicArena arena(1024);
+    std::vector<result<JsonValue>> out(views.size());
+
+    const size_t failed = parse_batch(views.data(), views.size(), arena, out.data());
+
+    size_t expected_failed = 0;
+    for (size_t i = 0; i < views.size(); ++i) {
+        const auto want = try_parse(views[i]);
+        if (!want) ++expected_failed;
+        EXPECT_EQ(out[i].ec, want.ec) << views[i];
+        EXPECT_EQ(out[i].value, want.value) << views[i];
+    }
+    EXPECT_EQ(failed, expected_failed);
+    EXPECT_GT(failed, 0u);
+    EXPECT_GT(arena.bytes_used(), 0u);
+}
+
+TEST(Batch, OptionsApplyToEveryDocument) {
+    ParseOptions opts;
+    opts.allow_duplicate_keys = false;
+    opts.structural_index = true;
+    const std::vector<std::string_view> views = {
+        R"({"a":1,"b":2})", R"({"a":1,"a":2})", R"({"x":[1,{"y":"z"}]})"};
+    MonotonicArena arena(1024);
+    std::vector<result<JsonValue>> out;
+
+    EXPECT_EQ(parse_batch(views, arena, out, opts), 1u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_TRUE(out[0]);
+    EXPECT_EQ(out[1].ec, make_error_code(errc::duplicate_key));
+    EXPECT_TRUE(out[1].value.is_null());
+    ASSERT_TRUE(out[2]);
+    EXPECT_EQ(out[2].value["x"][1]["y"].as_string(), "z");
+}
+
+TEST(Batch, EmptyBatch) {
+    MonotonicArena arena(256);
+    EXPECT_EQ(parse_batch(nullptr, 0, arena, nullptr), 0u);
+}
+
+TEST(Batch, ParallelMatchesSerial) {
+    const auto msgs = make_messages(1000);
+    const auto views = views_of(msgs);
+    MonotonicArena arena(4096);
+    std::vector<result<JsonValue>> serial;
+    const size_t serial_failed = parse_batch(views, arena, serial);
+
+    ParallelBatch batch;
+    for (size_t threads : {1u, 3u, 8u}) {
+        EXPECT_EQ(batch.parse(views, threads), serial_failed) << threads;
+        ASSERT_EQ(batch.results().size(), views.size());
+        for (size_t i = 0; i < views.size(); ++i) {
+            EXPECT_EQ(batch.results()[i].ec, serial[i].ec) << i;
+            EXPECT_EQ(batch.results()[i].value, serial[i].value) << i;
+        }
+    }
+    EXPECT_GT(batch.bytes_allocated(), 0u);
+    batch.reset();
+    EXPECT_TRUE(batch.results().empty());
+}
@@ -9,7 +9,11 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <random>
 #include <string>
 
 using namespace yajson;
@@ -57,6 +61,32 @@ TEST(ConformanceNumbers, IntegerOverflowBecomesFloatOrUint) {
         EXPECT_TRUE(v.is_uinteger() && v.as_uinteger() == 9223372036854775808ULL);
 }
 
+TEST(ConformanceNumbers, IntegersOfEveryLength) {
+    // Covers the eight-digit chunks, the scalar tail and the 20-digit limit
+    std::mt19937_64 rng(5);
+    for (int len = 1; len <= 20; ++len) {
+        for (int iter = 0; iter < 200; ++iter) {
+            std::string digits(1, static_cast<char>('1' + rng() % 9));
+            for (int i = 1; i < len; ++i) digits += static_cast<char>('0' + rng() % 10);
+            if (iter == 0) digits.assign(static_cast<size_t>(len), '9');
+            if (len == 20 && digits > "18446744073709551615") continue;
+            const uint64_t want = std::strtoull(digits.c_str(), nullptr, 10);
+
+            const auto v = parse("[" + digits + ",-" + digits + "," + digits + ".5]");
+            EXPECT_EQ(v[0].as_uinteger(), want) << digits;
+            if (want <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                EXPECT_EQ(v[1].as_integer(), -static_cast<int64_t>(want)) << digits;
+            }
+            EXPECT_EQ(v[2].as_float(), std::strtod((digits + ".5").c_str(), nullptr)) << digits;
+            EXPECT_EQ(parse(digits).as_uinteger(), want) << digits;
+        }
+    }
+    EXPECT_EQ(parse("18446744073709551615").as_uinteger(), UINT64_MAX);
+    EXPECT_TRUE(parse("18446744073709551616").is_float());
+    EXPECT_TRUE(parse("123456789012345678901234").is_float());
+    EXPECT_THROW(parse("12345678x"), ParseError);
+}
+
 TEST(ConformanceNumbers, SmallFloat) {
     auto v = parse("1e-308");
     EXPECT_TRUE(v.is_float());
@@ -75,6 +105,63 @@ TEST(ConformanceNumbers, FloatExponentPlus) {
     EXPECT_DOUBLE_EQ(v.as_float(), 100.0);
 }
 
+namespace {
+
+/// Parsed double must be bit-identical to strtod (correctly rounded).
+void expect_strtod_bits(const std::string& text) {
+    const double want = std::strtod(text.c_str(), nullptr);
+    const auto got = try_parse(text);
+    ASSERT_TRUE(got) << text;
+    const double d = got.value.as_float();
+    EXPECT_EQ(std::memcmp(&d, &want, sizeof(d)), 0)
+        << text << ": got " << d << ", want " << want;
+}
+
+} // namespace
+
+TEST(ConformanceNumbers, FloatHardRoundingCases) {
+    for (const char* text : {
+             "0.1", "1e23", "8.988465674311579e307", "1.7976931348623157e308",
+             "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9406564584124654e-324",
+             "2.4703282292062328e-324", "1e-320", "7.2057594037927933e16",
+             "1.00000000000000011102230246251565404236316680908203125",
+             "1.00000000000000011102230246251565404236316680908203124",
+             "1.00000000000000011102230246251565404236316680908203126",
+             "123456789012345678901234567890", "9223372036854775807.5",
+             "0.000000000000000000000000000001234567890123456789012", "0e-999", "-0e50"}) {
+        expect_strtod_bits(text);
+    }
+}
+
+TEST(ConformanceNumbers, FloatMantissaAbove2Pow53RoundsOnce) {
+    // Halfway between 2^53 and 2^53 + 2: ties to even gives 2^53. A double
+    // conversion of the mantissa followed by a division rounds up instead.
+    EXPECT_EQ(parse("9007199254740993.0").as_float(), 9007199254740992.0);
+    EXPECT_EQ(parse("90071992547409930e-1").as_float(), 9007199254740992.0);
+    EXPECT_EQ(parse("-65.613616999999977").as_float(), -65.613616999999977);
+}
+
+TEST(ConformanceNumbers, FloatRandomMatchesStrtod) {
+    std::mt19937_64 rng(2024);
+    char buf[64];
+    for (int i = 0; i < 200000; ++i) {
+        const uint64_t bits = rng();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        if (!std::isfinite(d)) continue;
+        std::snprintf(buf, sizeof(buf), "%.*g", static_cast<int>(1 + rng() % 19), d);
+        expect_strtod_bits(buf);
+        if (HasFailure()) return;
+    }
+}
+
+TEST(ConformanceNumbers, FloatOutOfRangeRejected) {
+    for (const char* text : {"1e400", "-1e309", "1e-400", "123e-999"}) {
+        const auto r = try_parse(text);
+        EXPECT_EQ(r.ec, make_error_code(errc::invalid_number)) << text;
+    }
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Strings — edge cases and escapes
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,155 @@
+/// @file test_extract.cpp
+/// @brief Unit tests for yajson::extract (single-pass JSON Pointer extraction).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+const char* const kDoc = R"({
+    "user": {"id": 42, "name": "Ann \"A\" é", "tags": ["x", "y", {"deep": [1, 2]}]},
+    "items": [{"price": 1.5, "qty": 2}, {"price": 2.25, "qty": 1}],
+    "skip": {"a": [[[{"b": "}]\"["}]]], "c": null, "d": true, "e": -1e10},
+    "a/b": {"~": 7},
+    "0": "key zero",
+    "empty": {},
+    "list": []
+})";
+
+std::vector<JsonPointer> pointers(const std::vector<std::string>& paths) {
+    std::vector<JsonPointer> out;
+    for (const auto& p : paths) out.emplace_back(p);
+    return out;
+}
+
+/// extract() must agree with parse() + try_resolve() for every pointer.
+void expect_matches_dom(std::string_view input, const std::vector<std::string>& paths,
+                        const ParseOptions& opts = {}) {
+    auto ptrs = pointers(paths);
+    auto got = extract(input, ptrs, opts);
+    auto dom = parse(input, opts);
+    ASSERT_EQ(got.size(), ptrs.size());
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+        const JsonValue* want = ptrs[i].try_resolve(dom);
+        ASSERT_EQ(got[i].has_value(), want != nullptr) << paths[i];
+        if (want) {
+            EXPECT_EQ(*got[i], *want) << paths[i];
+        }
+    }
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Matching
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Extract, MatchesParseAndResolve) {
+    expect_matches_dom(kDoc, {"/user/id", "/user/name", "/user/tags/2/deep/1",
+                              "/items/1/price", "/a~1b/~0", "/0", "/empty", "/list",
+                              "/skip/c", "/skip/e"});
+}
+
+TEST(Extract, MissingPathsStayEmpty) {
+    expect_matches_dom(kDoc, {"/nope", "/user/id/x", "/items/2", "/items/-", "/items/01",
+                              "/list/0", "/user/tags/9", "/empty/a"});
+}
+
+TEST(Extract, RootAndOverlappingPointers) {
+    expect_matches_dom(kDoc, {"", "/user"});
+    expect_matches_dom(kDoc, {"/user/tags/2/deep", "/user", "/user/tags/0", "/user"});
+    expect_matches_dom(kDoc, {"/items/0", "/items/0/price", "/items"});
+}
+
+TEST(Extract, DuplicateKeysLastWins) {
+    const char* doc = R"({"a": {"b": 1}, "x": 0, "a": {"c": 2}, "k": 1, "k": [5]})";
+    expect_matches_dom(doc, {"/a/b", "/a/c", "/a", "/k", "/k/0"});
+}
+
+TEST(Extract, ScalarAndNonContainerRoots) {
+    expect_matches_dom("  17 ", {"", "/a"});
+    expect_matches_dom(R"("str")", {"/0"});
+    expect_matches_dom("[[1,2],[3,[4]]]", {"/1/1/0", "/0", "/0/5"});
+}
+
+TEST(Extract, ExtractorReusesSlots) {
+    Extractor ex(pointers({"/id", "/v"}));
+    EXPECT_EQ(ex.size(), 2u);
+    std::vector<std::optional<JsonValue>> out;
+    ex.extract(R"({"id": 1, "v": "a"})", out);
+    ASSERT_TRUE(out[0] && out[1]);
+    EXPECT_EQ(out[0]->as_integer(), 1);
+    ex.extract(R"({"id": 2})", out);
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(out[0]->as_integer(), 2);
+    EXPECT_FALSE(out[1].has_value());
+}
+
+TEST(Extract, LenientOptions) {
+    const char* doc = R"({
+        // comment
+        skip: {'a': [1, 2, /* ] */ 3,], "b": 'x}y',},
+        keep: 'yes', /* trailing */
+    })";
+    expect_matches_dom(doc, {"/keep", "/skip/b", "/skip/a/2"}, ParseOptions::lenient());
+}
+
+TEST(Extract, ResultsUseCurrentArena) {
+    MonotonicArena arena(4096);
+    ArenaScope scope(arena);
+    auto r = extract(kDoc, pointers({"/user/tags"}));
+    ASSERT_TRUE(r[0]);
+    EXPECT_EQ(r[0]->size(), 3u);
+    EXPECT_GT(arena.bytes_used(), 0u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Errors
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Extract, MalformedInputThrowsLikeParse) {
+    auto ptrs = pointers({"/a"});
+    const std::vector<std::pair<const char*, errc>> cases = {
+        {R"({"a": 1)", errc::unterminated_object},
+        {R"({"x": [1, 2)", errc::unterminated_array},
+        {R"({"x": {"y": 1)", errc::unterminated_object},
+        {R"({"x": "abc)", errc::unterminated_string},
+        {R"({"x": })", errc::unexpected_character},
+        {R"({"a": 1} x)", errc::trailing_content},
+        {R"({"a": tru})", errc::invalid_literal},
+    };
+    for (const auto& [input, code] : cases) {
+        try {
+            (void)extract(input, ptrs);
+            ADD_FAILURE() << input;
+        } catch (const ParseError& e) {
+            EXPECT_EQ(e.code(), code) << input << ": " << e.what();
+        }
+    }
+    // Errors on the walked path are the parser's own
+    for (const char* input : {R"({"a": 1,})", R"({"a" 1})", "[1 2]", ""}) {
+        auto want = try_parse(input);
+        ASSERT_FALSE(want) << input;
+        try {
+            (void)extract(input, ptrs);
+            ADD_FAILURE() << input;
+        } catch (const ParseError& e) {
+            EXPECT_EQ(e.code(), want.ec) << input;
+        }
+    }
+}
+
+TEST(Extract, DuplicateKeyRejectionInsideTargets) {
+    ParseOptions opts;
+    opts.allow_duplicate_keys = false;
+    auto ptrs = pointers({"/a"});
+    EXPECT_THROW((void)extract(R"({"a": {"k": 1, "k": 2}})", ptrs, opts), ParseError);
+    EXPECT_NO_THROW((void)extract(R"({"b": {"k": 1, "k": 2}, "a": 1})", ptrs, opts));
+}
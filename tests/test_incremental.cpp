@@ -0,0 +1,296 @@
+/// @file test_incremental.cpp
+/// @brief Unit tests for the resumable push parser (IncrementalParser).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+struct Recorder {
+    std::vector<std::string> events;
+    void on_null() { events.push_back("null"); }
+    void on_bool(bool b) { events.push_back(b ? "true" : "false"); }
+    void on_int64(int64_t v) { events.push_back("i:" + std::to_string(v)); }
+    void on_uint64(uint64_t v) { events.push_back("u:" + std::to_string(v)); }
+    void on_double(double v) { events.push_back("d:" + std::to_string(v)); }
+    void on_string(std::string_view s) { events.push_back("s:" + std::string(s)); }
+    void on_key(std::string_view s) { events.push_back("k:" + std::string(s)); }
+    void start_object() { events.push_back("{"); }
+    void end_object(size_t n) { events.push_back("}" + std::to_string(n)); }
+    void start_array() { events.push_back("["); }
+    void end_array(size_t n) { events.push_back("]" + std::to_string(n)); }
+};
+
+/// Feed @p input split at @p cut, then finish; return the error code.
+std::error_code feed_split(IncrementalParser& p, const std::string& input, size_t cut) {
+    try {
+        p.feed(std::string_view(input).substr(0, cut));
+        p.feed(std::string_view(input).substr(cut));
+        p.finish();
+    } catch (const ParseError& e) {
+        return e.code();
+    }
+    return {};
+}
+
+std::vector<JsonValue> drain(IncrementalParser& p) {
+    std::vector<JsonValue> out;
+    while (auto v = p.next()) out.push_back(std::move(*v));
+    return out;
+}
+
+const char* const kDocs[] = {
+    R"({"a":[1,-2,18446744073709551615,0.5,1e300,"x",true,false,null],"b":{}})",
+    R"(  [ "esc\"aped\\", "é😀", "tab\tand\nnewline", "" ]  )",
+    R"({"nested":{"deep":[[[{"k":"v"}]]]},"empty":[],"num":-0.0})",
+    "12345678901234567890123",
+    "\"top level string\"",
+    "true",
+};
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Chunk boundaries
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Incremental, EverySplitMatchesParse) {
+    for (const char* doc : kDocs) {
+        const std::string input = doc;
+        const JsonValue expected = parse(input);
+        for (size_t cut = 0; cut <= input.size(); ++cut) {
+            IncrementalParser p;
+            ASSERT_FALSE(feed_split(p, input, cut)) << doc << " @" << cut;
+            auto values = drain(p);
+            ASSERT_EQ(values.size(), 1u) << doc << " @" << cut;
+            EXPECT_EQ(values[0], expected) << doc << " @" << cut;
+        }
+    }
+}
+
+TEST(Incremental, DuplicateKeysMatchParse) {
+    std::string big = "{";  // indexed object (>= 16 keys)
+    for (int i = 0; i < 40; ++i) big += "\"k" + std::to_string(i % 25) + "\":" + std::to_string(i) + ",";
+    big.back() = '}';
+    for (const std::string& input :
+         {std::string(R"({"k":1,"a":2,"k":3})"), std::string(R"([{"x":{"k":[]},"x":null}])"), big}) {
+        const std::string expected = parse(input).dump();
+        for (size_t cut = 0; cut <= input.size(); ++cut) {
+            IncrementalParser p;
+            ASSERT_FALSE(feed_split(p, input, cut)) << input << " @" << cut;
+            auto values = drain(p);
+            ASSERT_EQ(values.size(), 1u) << input << " @" << cut;
+            EXPECT_EQ(values[0].dump(), expected) << input << " @" << cut;
+        }
+    }
+    IncrementalParser p;
+    p.feed(R"({"k":1,"a":2,"k":3})");
+    EXPECT_EQ(p.next()->dump(), R"({"a":2,"k":3})");
+}
+
+TEST(Incremental, ByteAtATimeEventsMatchParseSax) {
+    for (const char* doc : kDocs) {
+        Recorder whole;
+        parse_sax(doc, whole);
+
+        Recorder bytes;
+        IncrementalSaxParser<Recorder> p(bytes);
+        for (const char* c = doc; *c; ++c) p.feed(std::string_view(c, 1));
+        p.finish();
+        EXPECT_EQ(bytes.events, whole.events) << doc;
+    }
+}
+
+TEST(Incremental, ValuesAreReportedWhenTheyClose) {
+    IncrementalParser p;
+    p.feed(R"({"id":1,"na)");
+    EXPECT_FALSE(p.has_value());
+    EXPECT_EQ(p.depth(), 1u);
+    p.feed(R"(me":"x"} [2)");
+    auto first = p.next();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ((*first)["name"].as_string(), "x");
+    EXPECT_FALSE(p.has_value());
+    p.feed("] 7");
+    ASSERT_TRUE(p.has_value());
+    EXPECT_EQ(*p.next(), parse("[2]"));
+    EXPECT_FALSE(p.has_value());  // 7 could still be 70
+    p.feed("\n");
+    EXPECT_EQ(p.next()->as_integer(), 7);
+    p.finish();
+    EXPECT_FALSE(p.has_value());
+}
+
+TEST(Incremental, StreamOfValues) {
+    IncrementalParser p;
+    p.feed("{\"a\":1}{\"a\":2}\n[3] \"s\" 4 null");
+    p.finish();
+    auto values = drain(p);
+    ASSERT_EQ(values.size(), 6u);
+    EXPECT_EQ(values[1]["a"].as_integer(), 2);
+    EXPECT_EQ(values[4].as_integer(), 4);
+    EXPECT_TRUE(values[5].is_null());
+
+    IncrementalParser empty;
+    empty.feed("  \n ");
+    EXPECT_NO_THROW(empty.finish());
+    EXPECT_FALSE(empty.has_value());
+}
+
+TEST(Incremental, BufferIsBoundedByLargestSplitToken) {
+    std::string big(10000, 'x');
+    IncrementalParser p;
+    p.feed("[\"" + big.substr(0, 5000));
+    EXPECT_EQ(p.buffered_bytes(), 5001u);
+    p.feed(big.substr(5000) + "\", 1, 2,");
+    EXPECT_EQ(p.buffered_bytes(), 0u);
+    p.feed(" 3]");
+    p.finish();
+    auto v = p.next();
+    ASSERT_TRUE(v.has_value());
+    EXPECT_EQ((*v)[0].as_string().size(), 10000u);
+    EXPECT_EQ((*v).size(), 4u);
+}
+
+TEST(Incremental, CleanStringsInsideAChunkAreViews) {
+    struct Check : SaxHandler {
+        const std::string* chunk = nullptr;
+        int views = 0;
+        void on_string(std::string_view s) {
+            if (s.data() >= chunk->data() && s.data() < chunk->data() + chunk->size()) ++views;
+        }
+    };
+    const std::string chunk = R"(["alpha","beta","gamma"])";
+    Check c;
+    c.chunk = &chunk;
+    IncrementalSaxParser<Check> p(c);
+    p.feed(chunk);
+    p.finish();
+    EXPECT_EQ(c.views, 3);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Options and errors
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Incremental, Json5AcrossEverySplit) {
+    const std::string input =
+        "// header\n{key: 'v\\'q', /* block * comment */ \"n\": [0x1F, NaN, -Infinity,],}";
+    const JsonValue expected = parse(input, ParseOptions::json5());
+    for (size_t cut = 0; cut <= input.size(); ++cut) {
+        IncrementalParser p(ParseOptions::json5());
+        ASSERT_FALSE(feed_split(p, input, cut)) << cut;
+        auto v = p.next();
+        ASSERT_TRUE(v.has_value()) << cut;
+        EXPECT_EQ(v->dump(), expected.dump()) << cut;
+    }
+}
+
+TEST(Incremental, ErrorCodesMatchParseForEverySplit) {
+    for (const char* bad : {"[1,]", R"({"a":1,})", "[1 2]", R"({"a" 1})", "nul", "[tru]",
+                            R"(["\u12"])", "-", "{\"a\":\"\x01\"}", "[1.5.3]",
+                            "[truex]", "{1:2}", "[", "{\"a\"", "{\"a\":", "[1,", "\"abc",
+                            "{\"a\":1", "/", "]"}) {
+        const std::string input = bad;
+        const std::error_code expected = try_parse(input).ec;
+        ASSERT_TRUE(expected) << bad;
+        for (size_t cut = 0; cut <= input.size(); ++cut) {
+            IncrementalParser p;
+            EXPECT_EQ(feed_split(p, input, cut), expected) << bad << " @" << cut;
+        }
+    }
+}
+
+TEST(Incremental, Utf8ValidatedAcrossEverySplit) {
+    ParseOptions opts;
+    opts.validate_utf8 = true;
+    for (const char* bad : {"[\"\xff\xfe\"]", "[\"ok\xe2\x28\xa1\"]", "[\"\xf0\x9f\x98\"]",
+                            "{\"\xc0\xaf\":1}", "[\"\xed\xa0\x80\"]", "\"\xe2\x82",
+                            "[1] \xf0"}) {
+        const std::string input = bad;
+        ParseError expected("", {});
+        try {
+            (void)parse(input, opts);
+            FAIL() << "expected ParseError";
+        } catch (const ParseError& e) {
+            expected = e;
+        }
+        ASSERT_EQ(expected.code(), make_error_code(errc::invalid_utf8)) << bad;
+        for (size_t cut = 0; cut <= input.size(); ++cut) {
+            IncrementalParser p(opts);
+            try {
+                p.feed(std::string_view(input).substr(0, cut));
+                p.feed(std::string_view(input).substr(cut));
+                p.finish();
+                ADD_FAILURE() << "accepted " << bad << " @" << cut;
+            } catch (const ParseError& e) {
+                EXPECT_EQ(e.code(), expected.code()) << bad << " @" << cut;
+                EXPECT_EQ(e.location().offset, expected.location().offset) << bad << " @" << cut;
+            }
+        }
+    }
+
+    const std::string good = "[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"]";
+    for (size_t cut = 0; cut <= good.size(); ++cut) {
+        IncrementalParser p(opts);
+        EXPECT_FALSE(feed_split(p, good, cut)) << cut;
+        EXPECT_EQ(drain(p), std::vector<JsonValue>{parse(good)}) << cut;
+    }
+    IncrementalParser bytewise(opts);
+    for (char c : good) bytewise.feed(std::string_view(&c, 1));
+    bytewise.finish();
+    EXPECT_EQ(drain(bytewise), std::vector<JsonValue>{parse(good)});
+    bytewise.feed("[\"\xf0\x9f");
+    EXPECT_THROW(bytewise.finish(), ParseError);
+}
+
+TEST(Incremental, ErrorLocationIsRelativeToTheStream) {
+    IncrementalParser p;
+    p.feed("[1,\n 2,");
+    try {
+        p.feed("\n  x]");
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.location().line, 3u);
+        EXPECT_EQ(e.location().column, 3u);
+        EXPECT_EQ(e.location().offset, 10u);
+    }
+    // The parser stays failed until reset()
+    EXPECT_THROW(p.feed("1"), ParseError);
+    p.reset();
+    p.feed("[1]");
+    p.finish();
+    EXPECT_TRUE(p.has_value());
+}
+
+TEST(Incremental, LimitsAndDuplicateKeys) {
+    ParseOptions shallow;
+    shallow.max_depth = 3;
+    IncrementalParser deep(shallow);
+    deep.feed("[[[1]]]");
+    EXPECT_TRUE(deep.has_value());
+    try {
+        deep.feed("[[[[");
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), make_error_code(errc::max_depth_exceeded));
+    }
+
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    IncrementalParser p(no_dups);
+    p.feed(R"({"a":{"a":1},"b":2})");
+    EXPECT_TRUE(p.has_value());
+    try {
+        p.feed(R"({"a":1,"a")");
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), make_error_code(errc::duplicate_key));
+    }
+}
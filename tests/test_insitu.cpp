@@ -0,0 +1,114 @@
+/// @file test_insitu.cpp
+/// @brief Unit tests for parse_insitu (destructive in-place parsing).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+const char* const kDoc = R"({
+  "plain": "no escapes here, long enough to be borrowed",
+  "html": "<a href=\"/x?a=1&amp;b=2\">link<\/a>\n<p class=\"c\">text</p>",
+  "json": "{\"inner\": [1, 2, {\"k\": \"v\\\\w\"}], \"s\": \"\\u00e9\"}",
+  "uni": "caf\u00e9 \u4e2d\u6587 \ud83d\ude00 end",
+  "short": "a\tb",
+  "k\u0065y\n": [true, null, -1.5e3, "x\"y"],
+  "nested": {"a\\b": {"c": ["\\\\\\\\", "\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/"]}}
+})";
+
+/// parse_insitu() on a copy of @p doc must agree with parse(): same value,
+/// or same error code and offset.
+void expect_same_as_parse(const std::string& doc, const ParseOptions& opts = {}) {
+    std::string buf = doc;
+    try {
+        JsonValue want = parse(doc, opts);
+        EXPECT_EQ(parse_insitu(buf.data(), buf.size(), opts), want) << doc;
+    } catch (const ParseError& want) {
+        try {
+            (void)parse_insitu(buf.data(), buf.size(), opts);
+            ADD_FAILURE() << "accepted: " << doc;
+        } catch (const ParseError& got) {
+            EXPECT_EQ(got.code(), want.code()) << doc;
+            EXPECT_EQ(got.location().offset, want.location().offset) << doc;
+        }
+    }
+}
+
+bool points_into(std::string_view s, const std::string& buf) {
+    return s.data() >= buf.data() && s.data() + s.size() <= buf.data() + buf.size();
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Equivalence with parse()
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(ParseInsitu, MatchesParse) {
+    expect_same_as_parse(kDoc);
+    expect_same_as_parse(R"("\"")");
+    expect_same_as_parse(R"(["\\", "\ud83d\ude00\ud83d\ude00", "\u0000x"])");
+    expect_same_as_parse(std::string(1000, ' ') + R"("a\nb")");
+}
+
+TEST(ParseInsitu, MatchesParseWithOptions) {
+    ParseOptions iterative;
+    iterative.iterative = true;
+    expect_same_as_parse(kDoc, iterative);
+
+    ParseOptions indexed;
+    indexed.structural_index = true;  // ignored
+    expect_same_as_parse(kDoc, indexed);
+
+    expect_same_as_parse(R"({'k\'ey': 'it\'s a single-quoted string, also long', b: 'x\ny'})",
+                         ParseOptions::json5());
+}
+
+TEST(ParseInsitu, EveryTruncationFailsLikeParse) {
+    const std::string doc = kDoc;
+    for (size_t n = 0; n < doc.size(); ++n) {
+        expect_same_as_parse(doc.substr(0, n));
+    }
+}
+
+TEST(ParseInsitu, InvalidEscapes) {
+    for (const char* doc : {R"("\x")", R"("\u12G4")", R"("\ud800")", R"("\ud800\u0041")",
+                            R"("\udc00")", "\"a\x01\"", R"(["ok\n", "\q"])"}) {
+        expect_same_as_parse(doc);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Buffer use
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(ParseInsitu, StringsReferenceBuffer) {
+    std::string buf = kDoc;
+    auto v = parse_insitu(buf.data(), buf.size());
+    EXPECT_TRUE(points_into(v["plain"].as_string_view(), buf));
+    EXPECT_TRUE(points_into(v["html"].as_string_view(), buf));
+    EXPECT_TRUE(points_into(v["json"].as_string_view(), buf));
+    EXPECT_EQ(v["html"].as_string(), "<a href=\"/x?a=1&amp;b=2\">link</a>\n<p class=\"c\">text</p>");
+    EXPECT_EQ(parse(v["json"].as_string_view())["inner"][2]["k"].as_string(), "v\\w");
+    EXPECT_EQ(v["short"].as_string(), "a\tb");
+    ASSERT_TRUE(v.contains("key\n"));
+    EXPECT_EQ(v["nested"]["a\\b"]["c"][1].as_string(), "////////////////");
+}
+
+TEST(ParseInsitu, TryParseInsitu) {
+    std::string ok = R"({"a": "b\"c"})";
+    auto r = try_parse_insitu(ok.data(), ok.size());
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r.value["a"].as_string(), "b\"c");
+
+    std::string bad = R"({"a": "b\"c)";
+    auto e = try_parse_insitu(bad.data(), bad.size());
+    EXPECT_FALSE(e);
+    EXPECT_EQ(e.ec, make_error_code(errc::unterminated_string));
+}
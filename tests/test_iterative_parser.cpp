@@ -0,0 +1,209 @@
+/// @file test_iterative_parser.cpp
+/// @brief Unit tests for the iterative (explicit frame stack) parser core.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+ParseOptions iterative(ParseOptions opts = {}) {
+    opts.iterative = true;
+    return opts;
+}
+
+/// Both cores must agree on the value, or on the exact error.
+void expect_same(const std::string& input, const ParseOptions& opts) {
+    SCOPED_TRACE(input);
+    std::string rec_error, it_error;
+    SourceLocation rec_loc, it_loc;
+    JsonValue rec, it;
+    try { rec = parse(input, opts); } catch (const ParseError& e) {
+        rec_error = e.what();
+        rec_loc = e.location();
+    }
+    try { it = parse(input, iterative(opts)); } catch (const ParseError& e) {
+        it_error = e.what();
+        it_loc = e.location();
+    }
+    EXPECT_EQ(it_error, rec_error);
+    EXPECT_EQ(it_loc.offset, rec_loc.offset);
+    if (rec_error.empty()) {
+        EXPECT_EQ(it, rec);
+    }
+}
+
+const std::vector<std::string> kDocuments = {
+    "0", "\"s\"", "[]", "{}", "[[]]", "[{}]", "{\"a\":{}}",
+    R"({"a":1,"b":[true,false,null],"c":{"d":"e\n","f":[1.5,-2,3e10]}})",
+    R"([{"id":1,"tags":["x","y"]},{"id":2,"tags":[]},{"id":3,"nested":{"deep":[[[1]]]}}])",
+    R"( { "k" : [ 1 , 2 ] , "k" : "last wins" } )",
+    // errors at every structural position
+    "", "[", "{", "[1", "[1,", "[1 2]", "{\"a\"", "{\"a\":", "{\"a\":1", "{\"a\":1,",
+    "{\"a\" 1}", "{1:2}", "[1,]", "{\"a\":1,}", "[}", "{]", "[1]]", "[tru]", "{\"a\":[1,{\"b\":}]}",
+};
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Equivalence with the recursive core
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(IterativeParser, MatchesRecursiveStrict) {
+    for (const auto& doc : kDocuments) expect_same(doc, ParseOptions::strict());
+}
+
+TEST(IterativeParser, MatchesRecursiveLenient) {
+    std::vector<std::string> docs = kDocuments;
+    docs.push_back("// c\n[1, /* x */ 2,]");
+    docs.push_back("{a: 'b', c: [NaN, -Infinity,], }");
+    docs.push_back("{'k': {x: 0x1F}}");
+    for (const auto& doc : docs) {
+        expect_same(doc, ParseOptions::lenient());
+        expect_same(doc, ParseOptions::json5());
+    }
+}
+
+TEST(IterativeParser, MatchesRecursiveStructuralIndex) {
+    ParseOptions opts;
+    opts.structural_index = true;
+    std::string big = "[";
+    for (int i = 0; i < 2000; ++i) {
+        if (i) big += ",\n  ";
+        big += R"({"id": )" + std::to_string(i) + R"(, "name": "item \"q\"", "v": [1, {"x": []}]})";
+    }
+    big += "]";
+    expect_same(big, opts);
+    expect_same(big.substr(0, big.size() / 2), opts);
+    for (const auto& doc : kDocuments) expect_same(doc, opts);
+}
+
+TEST(IterativeParser, DuplicateKeys) {
+    ParseOptions opts;
+    opts.allow_duplicate_keys = false;
+    expect_same(R"({"a":1,"b":{"a":2}})", opts);
+    expect_same(R"({"a":1,"b":2,"a":3})", opts);
+    expect_same(R"({"a":{"x":1,"x":2}})", opts);
+
+    // Many short keys in a nested object: the entries vector reallocates
+    std::string many = "[[[{";
+    for (int i = 0; i < 40; ++i) many += (i ? ",\"k" : "\"k") + std::to_string(i) + "\":1";
+    expect_same(many + "}]]]", opts);
+    expect_same(many + ",\"k3\":2}]]]", opts);
+}
+
+TEST(IterativeParser, ArenaAndParseOverloads) {
+    const std::string doc = R"({"a":[1,2,{"b":"c"}],"d":{}})";
+    MonotonicArena arena;
+    JsonValue v = parse(doc, arena, iterative());
+    EXPECT_EQ(v, parse(doc));
+    EXPECT_TRUE(v["a"].is_array());
+
+    auto r = try_parse("[1,", iterative());
+    EXPECT_EQ(r.ec, make_error_code(errc::unexpected_end_of_input));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Depth
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(IterativeParser, DepthLimitEnforced) {
+    ParseOptions opts = iterative();
+    opts.max_depth = 5;
+    EXPECT_NO_THROW((void)parse("[[[[1]]]]", opts));
+    try {
+        (void)parse("[[{\"a\":[[[1]]]}]]", opts);
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), make_error_code(errc::max_depth_exceeded));
+    }
+}
+
+TEST(IterativeParser, VeryDeepNesting) {
+    constexpr size_t kDepth = 50000;
+    std::string deep;
+    for (size_t i = 0; i < kDepth; ++i) deep += i % 2 ? "{\"k\":" : "[";
+    deep += "1";
+    for (size_t i = kDepth; i-- > 0;) deep += i % 2 ? "}" : "]";
+
+    ParseOptions opts = iterative();
+    EXPECT_THROW((void)parse(deep, opts), ParseError);  // default limit still applies
+
+    opts.max_depth = kDepth;
+    JsonValue v = parse(deep, opts);
+    const JsonValue* p = &v;
+    for (size_t i = 0; i < kDepth; ++i) p = i % 2 ? &(*p)["k"] : &(*p)[0];
+    EXPECT_EQ(p->as_integer(), 1);
+}
+
+namespace {
+
+// [{"b":0,"a":[{"b":0,"a":...1...}]}] nested `depth` levels, written the way
+// dump() writes it (2-space indent when pretty; "a" first when sorted).
+std::string deep_document(size_t depth, bool pretty, bool sorted) {
+    std::string s;
+    for (size_t i = 0; i < depth; ++i) {
+        const std::string in(pretty ? 2 * (i + 1) : 0, ' ');
+        const char* nl = pretty ? "\n" : "";
+        const char* sep = pretty ? ": " : ":";
+        if (i % 2 == 0) s += std::string("[") + nl + in;
+        else if (sorted) s += std::string("{") + nl + in + "\"a\"" + sep;
+        else s += std::string("{") + nl + in + "\"b\"" + sep + "0," + nl + in + "\"a\"" + sep;
+    }
+    s += "1";
+    for (size_t i = depth; i-- > 0;) {
+        const std::string in(pretty ? 2 * i : 0, ' ');
+        const std::string nl = pretty ? "\n" : "";
+        if (i % 2 == 0) s += nl + in + "]";
+        else if (sorted) s += "," + nl + std::string(pretty ? 2 * (i + 1) : 0, ' ') + "\"b\"" +
+                              (pretty ? ": " : ":") + "0" + nl + in + "}";
+        else s += nl + in + "}";
+    }
+    return s;
+}
+
+} // namespace
+
+TEST(IterativeParser, DeepValueDestroyCopyCompareDump) {
+    // Far beyond YAJSON_MAX_DEPTH: no operation may recurse per level
+    constexpr size_t kDepth = 200000;
+    const std::string doc = deep_document(kDepth, false, false);
+    ParseOptions opts = iterative();
+    opts.max_depth = kDepth;
+
+    JsonValue v = parse(doc, opts);
+    EXPECT_EQ(v.dump(), doc);
+    SerializeOptions sorted;
+    sorted.sort_keys = true;
+    EXPECT_EQ(v.dump(sorted), deep_document(kDepth, false, true));
+
+    JsonValue copy = v;
+    EXPECT_EQ(copy, v);
+    JsonValue* p = &copy;
+    for (size_t i = 0; i < kDepth; ++i) p = i % 2 ? &(*p)["a"] : &(*p)[0];
+    *p = 2;
+    EXPECT_NE(copy, v);
+    copy = JsonValue();  // destroys the deep copy
+
+    MonotonicArena arena;
+    {
+        JsonValue in_arena = parse(doc, arena, opts);
+        EXPECT_EQ(in_arena, v);
+        JsonValue from_arena = in_arena;
+        EXPECT_EQ(from_arena.dump(), doc);
+    }
+
+    // Pretty layout across the switch to the explicit stack
+    constexpr size_t kPrettyDepth = 2000;
+    JsonValue shallow = parse(deep_document(kPrettyDepth, false, false), opts);
+    EXPECT_EQ(shallow.dump(2), deep_document(kPrettyDepth, true, false));
+    SerializeOptions pretty_sorted;
+    pretty_sorted.indent = 2;
+    pretty_sorted.sort_keys = true;
+    EXPECT_EQ(shallow.dump(pretty_sorted), deep_document(kPrettyDepth, true, true));
+}
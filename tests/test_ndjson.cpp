@@ -0,0 +1,156 @@
+/// @file test_ndjson.cpp
+/// @brief Unit tests for the NDJSON / JSON Lines reader.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Line splitting
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(NdjsonFindNewline, MatchesScalarSearch) {
+    std::string s(300, 'x');
+    for (size_t pos : {0u, 1u, 15u, 16u, 31u, 32u, 33u, 63u, 64u, 65u, 127u, 299u}) {
+        std::string t = s;
+        t[pos] = '\n';
+        EXPECT_EQ(detail::simd::find_newline(t.data(), t.data() + t.size()), t.data() + pos)
+            << pos;
+        // The search is bounded by end
+        EXPECT_EQ(detail::simd::find_newline(t.data(), t.data() + pos), t.data() + pos);
+    }
+    EXPECT_EQ(detail::simd::find_newline(s.data(), s.data() + s.size()), s.data() + s.size());
+}
+
+TEST(Ndjson, ReadsRecords) {
+    const std::string input = "{\"a\":1}\n[1,2]\r\n\n   \n\"s\"\n42";
+    ndjson::Reader reader(input);
+    std::vector<size_t> lines;
+    std::vector<std::string> dumps;
+    for (const auto& rec : reader) {
+        ASSERT_TRUE(rec.ok()) << rec.message;
+        lines.push_back(rec.line);
+        dumps.push_back(rec.value.dump());
+    }
+    EXPECT_EQ(lines, (std::vector<size_t>{1, 2, 5, 6}));
+    EXPECT_EQ(dumps, (std::vector<std::string>{"{\"a\":1}", "[1,2]", "\"s\"", "42"}));
+}
+
+TEST(Ndjson, RecordTextAndOffset) {
+    const std::string input = "[1]\r\n{\"k\":\"v\"}\n";
+    ndjson::Reader reader(input);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.record().text, "[1]");
+    EXPECT_EQ(reader.record().offset, 0u);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.record().text, "{\"k\":\"v\"}");
+    EXPECT_EQ(reader.record().offset, 5u);
+    EXPECT_FALSE(reader.next());
+}
+
+TEST(Ndjson, EmptyInput) {
+    ndjson::Reader reader("");
+    EXPECT_EQ(reader.begin(), reader.end());
+    ndjson::Reader blank("\n\n  \r\n");
+    EXPECT_EQ(blank.begin(), blank.end());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Errors and options
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Ndjson, BadLinesDoNotStopTheStream) {
+    const std::string input = "{\"a\":1}\n{\"a\":}\n[1,2\n{\"a\":3}\n";
+    ndjson::Reader reader(input);
+    std::vector<int64_t> good;
+    std::vector<size_t> bad_lines;
+    for (const auto& rec : reader) {
+        if (rec) {
+            good.push_back(rec.value["a"].as_integer());
+        } else {
+            bad_lines.push_back(rec.line);
+            EXPECT_TRUE(rec.value.is_null());
+            EXPECT_FALSE(rec.message.empty());
+        }
+    }
+    EXPECT_EQ(good, (std::vector<int64_t>{1, 3}));
+    EXPECT_EQ(bad_lines, (std::vector<size_t>{2, 3}));
+    EXPECT_EQ(reader.error_count(), 2u);
+
+    ndjson::Reader again(input);
+    auto it = again.begin();
+    ++it;
+    EXPECT_EQ(it->ec, make_error_code(errc::unexpected_character));
+    EXPECT_EQ(it->column, 6u);
+    ++it;
+    EXPECT_EQ(it->ec, make_error_code(errc::unterminated_array));
+}
+
+TEST(Ndjson, OptionsApplyPerLine) {
+    const std::string input = "{a: 1, /* c */}\n[NaN]\n";
+    ndjson::Reader strict(input);
+    for (const auto& rec : strict) EXPECT_FALSE(rec.ok());
+
+    ndjson::Reader lenient(input, ParseOptions::lenient());
+    size_t n = 0;
+    for (const auto& rec : lenient) {
+        EXPECT_TRUE(rec.ok()) << rec.message;
+        ++n;
+    }
+    EXPECT_EQ(n, 2u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Arena reuse and files
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Ndjson, ArenaGrowsToLargestRecord) {
+    std::string input;
+    const std::string big = "[\"" + std::string(5000, 'x') + "\",\"" +
+                            std::string(5000, 'y') + "\"]";
+    for (int i = 0; i < 20; ++i) input += (i == 3 ? big : "{\"n\":" + std::to_string(i) + "}") + "\n";
+
+    ndjson::Reader reader(input, {}, 1024);
+    size_t n = 0;
+    for (const auto& rec : reader) {
+        ASSERT_TRUE(rec.ok());
+        if (rec.line == 4) EXPECT_EQ(rec.value[1].as_string().size(), 5000u);
+        else EXPECT_EQ(rec.value["n"].as_integer(), static_cast<int64_t>(rec.line - 1));
+        ++n;
+    }
+    EXPECT_EQ(n, 20u);
+}
+
+TEST(Ndjson, CopiedValueOutlivesRecord) {
+    ndjson::Reader reader("{\"name\":\"a long string that is not SSO\"}\n[2]\n");
+    JsonValue kept;
+    for (const auto& rec : reader) {
+        if (rec.line == 1) kept = rec.value;
+    }
+    EXPECT_EQ(kept["name"].as_string(), "a long string that is not SSO");
+}
+
+TEST(Ndjson, OpenFile) {
+    const std::string path = testing::TempDir() + "yajson_ndjson_test.ndjson";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "{\"id\":1}\n{\"id\":2}\nnot json\n{\"id\":4}\n";
+    }
+    auto reader = ndjson::Reader::open(path);
+    int64_t sum = 0;
+    for (const auto& rec : reader) {
+        if (rec) sum += rec.value["id"].as_integer();
+    }
+    EXPECT_EQ(sum, 7);
+    EXPECT_EQ(reader.error_count(), 1u);
+    std::remove(path.c_str());
+
+    EXPECT_THROW((void)ndjson::Reader::open(path + ".missing"), ParseError);
+}
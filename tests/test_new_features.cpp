@@ -192,6 +192,22 @@ TEST(ParseOptions, DuplicateKeyLastWins) {
     opts.allow_duplicate_keys = true;
     auto v = parse(R"({"a": 1, "a": 2})", opts);
     EXPECT_EQ(v["a"].as_integer(), 2);
+
+    // Indexed object (>= 16 keys): each key keeps its last value, at the
+    // position of that last occurrence
+    std::string big = "{";
+    std::string want = "{";
+    for (int i = 0; i < 40; ++i) {
+        big += "\"k" + std::to_string(i % 25) + "\":" + std::to_string(i) + ",";
+        if (i >= 15) want += "\"k" + std::to_string(i % 25) + "\":" + std::to_string(i) + ",";
+    }
+    big.back() = '}';
+    want.back() = '}';
+    auto w = parse(big, opts);
+    EXPECT_EQ(w.size(), 25u);
+    EXPECT_EQ(w["k3"].as_integer(), 28);
+    EXPECT_EQ(w["k20"].as_integer(), 20);
+    EXPECT_EQ(w.dump(), want);
 }
 
 TEST(ParseOptions, DuplicateKeyReject) {
@@ -0,0 +1,179 @@
+/// @file test_ondemand.cpp
+/// @brief Unit tests for the on-demand (lazy) parsing API.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+const char* kPayload = R"({
+    "meta": {"version": 3, "tags": ["a", "b", {"deep": [1, 2, [3]]}]},
+    "user": {
+        "id": 9223372036854775807,
+        "big": 18446744073709551615,
+        "name": "Alice",
+        "bio": "line\nbreak \"quoted\" é",
+        "score": 1.25e2,
+        "active": true,
+        "spouse": null
+    },
+    "tricky": "brackets ] } [ { inside",
+    "list": [10, 20, 30]
+})";
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Navigation and scalars
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(OnDemand, ScalarsMatchDom) {
+    ondemand::Document doc(kPayload);
+    auto dom = parse(kPayload);
+    auto user = doc["user"];
+    EXPECT_EQ(user["id"].as_integer(), dom["user"]["id"].as_integer());
+    EXPECT_EQ(user["big"].as_uinteger(), dom["user"]["big"].as_uinteger());
+    EXPECT_EQ(user["big"].type(), Type::UInteger);
+    EXPECT_EQ(user["score"].as_float(), dom["user"]["score"].as_float());
+    EXPECT_EQ(user["score"].type(), Type::Float);
+    EXPECT_TRUE(user["active"].as_bool());
+    EXPECT_TRUE(user["spouse"].is_null());
+    EXPECT_EQ(user["name"].as_string_view(), "Alice");
+    EXPECT_EQ(user["bio"].as_string(), dom["user"]["bio"].as_string());
+}
+
+TEST(OnDemand, CleanStringsAreZeroCopy) {
+    std::string input = R"({"k":"value"})";
+    ondemand::Document doc(input);
+    auto sv = doc["k"].as_string_view();
+    EXPECT_EQ(sv, "value");
+    EXPECT_GE(sv.data(), input.data());
+    EXPECT_LT(sv.data(), input.data() + input.size());
+}
+
+TEST(OnDemand, SkipsSubtreesWithBracketsInStrings) {
+    ondemand::Document doc(kPayload);
+    EXPECT_EQ(doc["list"][2].as_integer(), 30);
+    EXPECT_EQ(doc["tricky"].as_string_view(), "brackets ] } [ { inside");
+    EXPECT_EQ(doc["meta"]["tags"][2]["deep"][2][0].as_integer(), 3);
+}
+
+TEST(OnDemand, MissingAndWrongType) {
+    ondemand::Document doc(kPayload);
+    EXPECT_FALSE(doc.find("nope").has_value());
+    EXPECT_TRUE(doc.root().contains("meta"));
+    EXPECT_THROW((void)doc["nope"], OutOfRangeError);
+    EXPECT_THROW((void)doc["list"][3], OutOfRangeError);
+    EXPECT_THROW((void)doc["list"]["x"], TypeError);
+    EXPECT_THROW((void)doc["user"]["name"].as_integer(), TypeError);
+    EXPECT_THROW((void)doc["user"]["id"].as_string_view(), TypeError);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Iteration and materialization
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(OnDemand, Iteration) {
+    ondemand::Document doc(kPayload);
+    std::vector<std::string> keys;
+    for (auto [key, value] : doc.root().as_object()) {
+        keys.emplace_back(key);
+        (void)value;
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"meta", "user", "tricky", "list"}));
+
+    int64_t sum = 0;
+    for (auto v : doc["list"].as_array()) sum += v.as_integer();
+    EXPECT_EQ(sum, 60);
+    EXPECT_EQ(doc["list"].size(), 3u);
+    EXPECT_EQ(doc["user"].size(), 7u);
+}
+
+TEST(OnDemand, ToValueAndRawJson) {
+    ondemand::Document doc(kPayload);
+    auto dom = parse(kPayload);
+    EXPECT_EQ(doc["meta"].to_value(), dom["meta"]);
+    EXPECT_EQ(doc.root().to_value(), dom);
+    EXPECT_EQ(doc["list"].raw_json(), "[10, 20, 30]");
+}
+
+TEST(OnDemand, EmptyContainers) {
+    ondemand::Document doc(R"({"a":[],"b":{}, "c" : [ ] })");
+    EXPECT_TRUE(doc["a"].as_array().empty());
+    EXPECT_TRUE(doc["b"].as_object().empty());
+    EXPECT_EQ(doc["c"].size(), 0u);
+}
+
+TEST(OnDemand, EscapedKeys) {
+    ondemand::Document doc(R"({"a\u0062":1, "plain":2})");
+    EXPECT_EQ(doc["ab"].as_integer(), 1);
+    EXPECT_EQ(doc["plain"].as_integer(), 2);
+}
+
+TEST(OnDemand, EscapedStringsDecodeOncePerToken) {
+    ondemand::Document doc(R"({"k\u0065y":"v\u0061l"})");
+    const std::string_view first = doc["key"].as_string_view();
+    for (int i = 0; i < 100; ++i) {
+        const std::string_view again = doc["key"].as_string_view();
+        EXPECT_EQ(again, "val");
+        EXPECT_EQ(again.data(), first.data());  // served from the cache, not re-decoded
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Errors and options
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(OnDemand, ErrorsSurfaceWhenReached) {
+    EXPECT_THROW(ondemand::Document("   "), ParseError);
+
+    // The broken part is never visited: no error
+    ondemand::Document doc(R"({"ok": 1, "bad": [1 2]})");
+    EXPECT_EQ(doc["ok"].as_integer(), 1);
+
+    try {
+        (void)doc["bad"][1];
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), make_error_code(errc::unexpected_character));
+        EXPECT_EQ(e.location().offset, 20u);
+    }
+
+    ondemand::Document bad_num(R"({"n": 01})");
+    EXPECT_THROW((void)bad_num["n"].as_integer(), ParseError);
+    ondemand::Document unterminated(R"({"a": [1, 2)");
+    EXPECT_THROW((void)unterminated["b"], ParseError);
+}
+
+TEST(OnDemand, LenientOptions) {
+    ondemand::Document doc("{ // comment\n key: 'v', /* c */ \"n\": [1, 2,], }",
+                           ParseOptions::lenient());
+    EXPECT_EQ(doc["key"].as_string_view(), "v");
+    EXPECT_EQ(doc["n"].size(), 2u);
+    EXPECT_EQ(doc["n"][1].as_integer(), 2);
+}
+
+TEST(OnDemand, DuplicateKeysRejectedWhenDisallowed) {
+    const char* text = R"({"a":1,"b":2,"a":3})";
+    EXPECT_EQ(ondemand::Document(text)["a"].as_integer(), 1);
+
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    ondemand::Document doc(text, no_dups);
+    try {
+        (void)doc["b"];
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), make_error_code(errc::duplicate_key));
+    }
+    EXPECT_THROW((void)doc.root().as_object().begin(), ParseError);
+
+    ondemand::Document ok(R"({"a":1,"\u0061b":2,"ab\u0063":3})", no_dups);
+    EXPECT_EQ(ok["ab"].as_integer(), 2);
+}
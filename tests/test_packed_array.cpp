@@ -0,0 +1,244 @@
+/// @file test_packed_array.cpp
+/// @brief Unit tests for ParseOptions::packed_arrays and packed JsonValue arrays.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+ParseOptions packed() {
+    ParseOptions opts;
+    opts.packed_arrays = true;
+    return opts;
+}
+
+std::string parse_error(const char* doc, const ParseOptions& opts = {}) {
+    try {
+        (void)parse(doc, opts);
+    } catch (const ParseError& e) {
+        return e.what();
+    }
+    return {};
+}
+
+} // namespace
+
+TEST(PackedArray, IntegerAndFloatArrays) {
+    const JsonValue ints = parse("[1, -2, 9223372036854775807, -9223372036854775808]", packed());
+    ASSERT_TRUE(ints.is_packed());
+    EXPECT_TRUE(ints.is_array());
+    EXPECT_EQ(ints.size(), 4u);
+    const Span<const int64_t> is = ints.as_int64_span();
+    EXPECT_EQ(std::vector<int64_t>(is.begin(), is.end()),
+              (std::vector<int64_t>{1, -2, INT64_MAX, INT64_MIN}));
+    EXPECT_THROW((void)ints.as_double_span(), TypeError);
+
+    const JsonValue floats = parse("[0.5, -1e3, 2.25E-2]", packed());
+    ASSERT_TRUE(floats.is_packed());
+    const Span<const double> fs = floats.as_double_span();
+    ASSERT_EQ(fs.size(), 3u);
+    EXPECT_EQ(fs[0], 0.5);
+    EXPECT_EQ(fs[1], -1000.0);
+    EXPECT_EQ(fs[2], 0.0225);
+    EXPECT_THROW((void)floats.as_int64_span(), TypeError);
+
+    EXPECT_THROW((void)parse("[1,2]").as_int64_span(), TypeError);
+    EXPECT_THROW((void)JsonValue(1).as_double_span(), TypeError);
+}
+
+TEST(PackedArray, SameValueAndOutputAsRegularParse) {
+    const std::string doc =
+        R"({"ids":[1,2,3],"xy":[[0.5,1.5],[2.0,-3.25]],"mixed":[1,2.5],"empty":[],)"
+        R"("big":[1,18446744073709551615],"tail":[1.5,2.5,"x"],"nested":[1,[2]],"s":["a"]})";
+    const JsonValue p = parse(doc, packed());
+    const JsonValue r = parse(doc);
+    EXPECT_TRUE(p["ids"].is_packed());
+    EXPECT_TRUE(p["xy"][0].is_packed());
+    for (const char* key : {"mixed", "empty", "big", "tail", "nested", "s", "xy"}) {
+        EXPECT_FALSE(p[key].is_packed()) << key;
+    }
+    EXPECT_EQ(p, r);
+    EXPECT_EQ(r, p);
+    EXPECT_EQ(p.dump(), r.dump());
+    EXPECT_EQ(p.dump(2), r.dump(2));
+    EXPECT_NE(parse("[1,2]", packed()), parse("[1,3]", packed()));
+    EXPECT_NE(parse("[1,2]", packed()), parse("[1,2,3]"));
+    EXPECT_EQ(parse("[1,2]", packed()), parse("[1.0,2.0]", packed()));
+}
+
+TEST(PackedArray, FallbackKeepsEveryElement) {
+    for (const char* doc : {"[1,2.5,3]", "[1.5,2,3]", "[1,2,null]", "[1,2,{\"a\":[3]}]",
+                            "[0.5,true]", "[-1,\"s\",2]", "[1,-9223372036854775809]"}) {
+        const JsonValue p = parse(doc, packed());
+        EXPECT_FALSE(p.is_packed()) << doc;
+        EXPECT_EQ(p, parse(doc)) << doc;
+        EXPECT_EQ(p.dump(), parse(doc).dump()) << doc;
+    }
+}
+
+TEST(PackedArray, ConstAccessReadsWithoutExpanding) {
+    const JsonValue c = parse("[1.5, 2.5]", packed());
+    double sum = 0;
+    for (size_t i = 0; i < c.size(); ++i) sum += c.element(i).as_float();
+    EXPECT_EQ(sum, 4.0);
+    EXPECT_THROW((void)c.element(2), OutOfRangeError);
+
+    // Const reads see the same elements as for a regular array
+    const JsonValue doc = parse(R"({"a":[7,8,9]})", packed());
+    EXPECT_EQ(doc["a"][1].as_integer(), 8);
+    EXPECT_THROW((void)doc["a"][3], OutOfRangeError);
+    int64_t total = 0;
+    for (const JsonValue& e : doc["a"].as_array()) total += e.as_integer();
+    EXPECT_EQ(total, 24);
+    EXPECT_EQ(c[1].as_float(), 2.5);
+    EXPECT_EQ(&c[0], &c.as_array()[0]);  // one view, built once
+    EXPECT_TRUE(c.is_packed());
+    EXPECT_TRUE(doc["a"].is_packed());
+    EXPECT_EQ(doc["a"].as_int64_span()[2], 9);
+
+    const JsonValue regular = parse("[1, \"a\"]");
+    EXPECT_EQ(regular.element(1).as_string(), "a");
+
+    // Concurrent const readers share the packed form
+    const JsonValue ints = parse("[1,2,3,4,5,6,7,8]", packed());
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&ints] {
+            for (int i = 0; i < 200; ++i) {
+                EXPECT_EQ(ints.element(7).as_integer(), 8);
+                EXPECT_EQ(ints[6].as_integer(), 7);
+                EXPECT_EQ(ints.as_array().size(), 8u);
+                EXPECT_EQ(ints.dump(), "[1,2,3,4,5,6,7,8]");
+            }
+        });
+    }
+    for (auto& r : readers) r.join();
+    EXPECT_TRUE(ints.is_packed());
+}
+
+TEST(PackedArray, NonConstAccessExpandsInPlace) {
+    JsonValue v = parse("[10, 20, 30]", packed());
+    ASSERT_TRUE(v.is_packed());
+    EXPECT_EQ(v.size(), 3u);
+    EXPECT_FALSE(v.empty());
+    EXPECT_EQ(v.element(1).as_integer(), 20);
+    EXPECT_TRUE(v.is_packed());
+    EXPECT_EQ(v[1].as_integer(), 20);
+    EXPECT_FALSE(v.is_packed());
+    EXPECT_TRUE(v[1].is_integer());
+    v.push_back(JsonValue("x"));
+    EXPECT_EQ(v.dump(), R"([10,20,30,"x"])");
+
+    JsonValue u = parse("[0.5, 1.5]", packed());
+    Array& arr = u.unpack();
+    EXPECT_FALSE(u.is_packed());
+    EXPECT_EQ(arr.size(), 2u);
+    EXPECT_EQ(&u.unpack(), &arr);  // already regular
+    EXPECT_EQ(u, parse("[0.5, 1.5]"));
+
+    JsonValue cleared = parse("[1, 2]", packed());
+    cleared.clear();
+    EXPECT_TRUE(cleared.empty());
+    EXPECT_EQ(cleared.dump(), "[]");
+}
+
+TEST(PackedArray, CopiesStayPacked) {
+    const JsonValue v = parse("[1, 2, 3]", packed());
+    JsonValue copy = v;
+    ASSERT_TRUE(copy.is_packed());
+    EXPECT_EQ(copy, v);
+    copy[0] = 7;
+    EXPECT_TRUE(v.is_packed());
+    EXPECT_EQ(v.as_int64_span()[0], 1);
+
+    JsonValue moved = std::move(copy);
+    EXPECT_EQ(moved[0].as_integer(), 7);
+
+    const std::vector<double> xs{0.25, 0.5};
+    const JsonValue built = JsonValue::packed_array(xs);
+    ASSERT_TRUE(built.is_packed());
+    EXPECT_EQ(built.dump(), "[0.25,0.5]");
+    EXPECT_EQ(JsonValue::packed_array(Span<const int64_t>()).dump(), "[]");
+}
+
+TEST(PackedArray, Arena) {
+    MonotonicArena arena(1024);
+    {
+        ArenaScope scope(arena);
+        const JsonValue v = parse(R"({"a":[1,2,3],"b":[0.5,1.5,2.5]})", packed());
+        ASSERT_TRUE(v["a"].is_packed());
+        const JsonValue copy = v;
+        EXPECT_TRUE(copy["b"].is_packed());
+        EXPECT_EQ(copy, v);
+        EXPECT_EQ(v["b"].element(2).as_float(), 2.5);
+        EXPECT_EQ(v["a"][2].as_integer(), 3);  // element view freed with v
+        JsonValue mut = v;
+        EXPECT_EQ(mut["b"].unpack().size(), 3u);
+        EXPECT_EQ(mut, v);
+        EXPECT_EQ(v.dump(), R"({"a":[1,2,3],"b":[0.5,1.5,2.5]})");
+    }
+    EXPECT_GT(arena.bytes_used(), 0u);
+}
+
+TEST(PackedArray, ErrorsMatchRegularParse) {
+    for (const char* doc : {"[1,2", "[1,2,]", "[1 2]", "[1,-]", "[1.5,1.]", "[1,2}", "[1,[2,3]"}) {
+        const std::string want = parse_error(doc);
+        ASSERT_FALSE(want.empty()) << doc;
+        EXPECT_EQ(parse_error(doc, packed()), want) << doc;
+    }
+    ParseOptions json5 = ParseOptions::json5();
+    json5.packed_arrays = true;
+    const JsonValue v = parse("[0x10, 2, 3,]", json5);
+    ASSERT_TRUE(v.is_packed());
+    EXPECT_EQ(v.as_int64_span()[0], 16);
+}
+
+TEST(PackedArray, IterativeCorePacksTheSame) {
+    ParseOptions iter = packed();
+    iter.iterative = true;
+    const std::string doc =
+        R"({"ids":[1,2,3],"xy":[[0.5,1.5],[2.0,-3.25]],"mixed":[1,2.5],"empty":[],)"
+        R"("tail":[1.5,2.5,"x"],"nested":[1,[2]],"trailing":[1,2,]})";
+    ParseOptions rec = packed();
+    rec.allow_trailing_commas = iter.allow_trailing_commas = true;
+    const JsonValue a = parse(doc, iter);
+    const JsonValue b = parse(doc, rec);
+    for (const char* key : {"ids", "xy", "mixed", "empty", "tail", "nested", "trailing"}) {
+        EXPECT_EQ(a[key].is_packed(), b[key].is_packed()) << key;
+    }
+    EXPECT_TRUE(a["ids"].is_packed());
+    EXPECT_TRUE(a["xy"].element(1).is_packed());
+    EXPECT_TRUE(a["trailing"].is_packed());
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.dump(), b.dump());
+}
+
+TEST(PackedArray, PointerAndConversion) {
+    JsonValue v = parse(R"({"ids":[4,5,6]})", packed());
+    const JsonValue& cv = v;
+    EXPECT_EQ(from_value<std::vector<int64_t>>(cv["ids"]), (std::vector<int64_t>{4, 5, 6}));
+    EXPECT_EQ(JsonPointer("/ids").resolve(cv).size(), 3u);
+    EXPECT_EQ(JsonPointer("/ids/1").resolve(cv).as_integer(), 5);
+    ASSERT_NE(JsonPointer("/ids/2").try_resolve(cv), nullptr);
+    EXPECT_EQ(JsonPointer("/ids/2").try_resolve(cv)->as_integer(), 6);
+    EXPECT_EQ(JsonPointer("/ids/3").try_resolve(cv), nullptr);
+    EXPECT_TRUE(v["ids"].is_packed());
+
+    // Mutable try_resolve unpacks like resolve(): writes through it stick
+    JsonValue w = parse(R"({"ids":[4,5,6]})", packed());
+    *JsonPointer("/ids/0").try_resolve(w) = 40;
+    EXPECT_EQ(w.dump(), R"({"ids":[40,5,6]})");
+
+    // Mutable resolution hands out a reference, so it unpacks
+    JsonPointer("/ids/1").resolve(v) = 50;
+    EXPECT_FALSE(v["ids"].is_packed());
+    EXPECT_EQ(v.dump(), R"({"ids":[4,50,6]})");
+}
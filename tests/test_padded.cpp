@@ -0,0 +1,153 @@
+/// @file test_padded.cpp
+/// @brief Unit tests for padded inputs (PaddedString, parse_padded, parse_file).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+/// parse_padded() must agree with parse(): same value, or same error code
+/// and location.
+void expect_same_as_parse(const std::string& doc, const ParseOptions& opts = {}) {
+    PaddedString buf(doc);
+    ASSERT_TRUE(PaddedStringView(buf).is_padded());
+    try {
+        JsonValue want = parse(doc, opts);
+        EXPECT_EQ(parse_padded(buf, opts), want) << doc;
+    } catch (const ParseError& want) {
+        try {
+            (void)parse_padded(buf, opts);
+            ADD_FAILURE() << "accepted: " << doc;
+        } catch (const ParseError& got) {
+            EXPECT_EQ(got.code(), want.code()) << doc;
+            EXPECT_EQ(got.location().offset, want.location().offset) << doc;
+            EXPECT_STREQ(got.what(), want.what()) << doc;
+        }
+    }
+}
+
+const char* const kDoc = R"({
+  "id": 12345, "neg": -17, "pi": 3.25e-2, "big": 18446744073709551615,
+  "s": "plain", "esc": "a\"b\\cé\n", "t": true, "f": false, "n": null,
+  "arr": [1, 2.5, -3, "x", [], {}, [[0]]],
+  "nested": {"k": {"k": {"k": [true, false, null]}}}
+})";
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// PaddedString / PaddedStringView
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(PaddedString, OwnsZeroedPadding) {
+    PaddedString s(std::string_view("[1,2]"));
+    EXPECT_EQ(s.view(), "[1,2]");
+    EXPECT_EQ(s.capacity(), s.size() + YAJSON_PADDING);
+    for (size_t i = s.size(); i < s.capacity(); ++i) EXPECT_EQ(s.data()[i], '\0');
+
+    PaddedString copy = s;
+    EXPECT_EQ(copy.view(), s.view());
+    EXPECT_NE(copy.data(), s.data());
+
+    PaddedString rx(16);
+    std::memcpy(rx.data(), "{\"a\":1}", 7);
+    rx.shrink(7);
+    EXPECT_EQ(parse_padded(rx)["a"].as_integer(), 1);
+}
+
+TEST(PaddedString, UnpaddedViewFallsBack) {
+    // The byte after the view continues the number: must not be read
+    const std::string backing = std::string("123456") + std::string(YAJSON_PADDING, ' ');
+    PaddedStringView v(backing.data(), 2, backing.size());
+    EXPECT_FALSE(v.is_padded());
+    EXPECT_EQ(parse_padded(v).as_integer(), 12);
+
+    PaddedStringView small(backing.data(), 3, 10);  // not enough padding
+    EXPECT_FALSE(small.is_padded());
+    EXPECT_EQ(parse_padded(small).as_integer(), 123);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// parse_padded ≡ parse
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(ParsePadded, MatchesParse) {
+    for (const char* doc : {
+             "0", "-0", "123", "-9223372036854775808", "1e5", "2.5", "true", "null",
+             "\"str\"", "[]", "{}", "  [1, 2, 3]  \n", R"({"a":[{"b":"c"}]})",
+         }) {
+        expect_same_as_parse(doc);
+    }
+    expect_same_as_parse(kDoc);
+}
+
+TEST(ParsePadded, ErrorsAtEndOfInput) {
+    for (const char* doc : {
+             "", "   ", "-", "1.", "1e", "1e+", "tru", "nul", "fals", "[", "[1", "[1,",
+             "{", R"({"a")", R"({"a":)", R"({"a":1)", R"({"a":1,)", R"("abc)", R"("a\)",
+             R"("\u12)", "[1 2]", "{} x", "[-]", "[01]",
+         }) {
+        expect_same_as_parse(doc);
+    }
+}
+
+TEST(ParsePadded, EveryTruncationMatchesParse) {
+    const std::string doc = kDoc;
+    for (size_t n = 0; n <= doc.size(); ++n) {
+        expect_same_as_parse(doc.substr(0, n));
+    }
+}
+
+TEST(ParsePadded, EmbeddedNulAndControlCharacters) {
+    expect_same_as_parse(std::string("[1,\0 2]", 7));
+    expect_same_as_parse(std::string("[\"a\0b\"]", 7));
+    expect_same_as_parse(std::string("[1\0]", 4));
+    // Control characters are not whitespace, even next to whitespace
+    expect_same_as_parse("[\x01 1]");
+    expect_same_as_parse("[1,\x02\x03" "2]");
+    EXPECT_FALSE(try_parse("[\x01 1]"));
+}
+
+TEST(ParsePadded, PresetsAndLongWhitespace) {
+    const std::string indented = "[" + std::string(300, ' ') + "1," + std::string(70, '\n') +
+                                 "\"" + std::string(200, 'x') + "\"" + std::string(90, ' ') + "]";
+    expect_same_as_parse(indented);
+    expect_same_as_parse(indented.substr(0, indented.size() - 1));
+    expect_same_as_parse("{ // c\n a: 'x', b: [NaN, -Infinity, 0x1F,], }", ParseOptions::json5());
+    expect_same_as_parse("[1, /* open", ParseOptions::lenient());
+    ParseOptions iterative;
+    iterative.iterative = true;
+    expect_same_as_parse(kDoc, iterative);
+}
+
+TEST(ParsePadded, TryParsePadded) {
+    EXPECT_TRUE(try_parse_padded(PaddedString(std::string_view("[1]"))));
+    auto r = try_parse_padded(PaddedString(std::string_view("[1")));
+    EXPECT_FALSE(r);
+    EXPECT_EQ(r.ec, make_error_code(errc::unterminated_array));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// parse_file (padded mapping)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(ParsePadded, ParseFileAroundPageBoundaries) {
+    const std::string path = ::testing::TempDir() + "yajson_padded_test.json";
+    for (size_t size : {size_t{1}, size_t{4094}, size_t{4095}, size_t{4096}, size_t{8192}}) {
+        // An integer padded with leading spaces to exactly size bytes
+        std::string doc = std::string(size - 1, ' ') + "7";
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(f, nullptr);
+        std::fwrite(doc.data(), 1, doc.size(), f);
+        std::fclose(f);
+        EXPECT_EQ(parse_file(path).as_integer(), 7) << size;
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,149 @@
+/// @file test_parallel.cpp
+/// @brief Unit tests for multi-threaded parsing of large root arrays.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+/// Array whose strings are full of characters that look structural.
+std::string make_tricky_array(size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    const char* const pieces[] = {",", "]", "[", "{", "}", "\\\"", "\\\\", ":", " ", "x"};
+    std::string s = "  [\n";
+    for (size_t i = 0; i < n; ++i) {
+        if (i) s += i % 7 == 0 ? " ,\n " : ",";
+        switch (rng() % 5) {
+            case 0: s += std::to_string(rng() % 100000); break;
+            case 1: {
+                s += '"';
+                const size_t len = rng() % 12;
+                for (size_t k = 0; k < len; ++k) s += pieces[rng() % 10];
+                s += '"';
+                break;
+            }
+            case 2: s += R"({"k":[1,"]",{"a":"\\"}],"s":"a,b"})"; break;
+            case 3: s += "[[],[[]],{},\"[\"]"; break;
+            default: s += "true"; break;
+        }
+    }
+    s += "\n]  ";
+    return s;
+}
+
+JsonValue parse_split(std::string_view input, size_t threads, const ParseOptions& opts = {}) {
+    return detail::parse_parallel_impl(input, threads, opts, {}, 16);
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Equivalence with parse()
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Parallel, MatchesSerialParse) {
+    for (unsigned seed = 1; seed <= 20; ++seed) {
+        const std::string input = make_tricky_array(200 + seed * 13, seed);
+        const JsonValue expected = parse(input);
+        for (size_t threads : {2u, 3u, 5u, 8u, 16u}) {
+            EXPECT_EQ(parse_split(input, threads), expected) << seed << "/" << threads;
+        }
+    }
+}
+
+TEST(Parallel, PublicEntryPoint) {
+    const std::string input = make_tricky_array(50000, 7);
+    EXPECT_GT(input.size(), detail::kParallelMinSlice * 2);
+    EXPECT_EQ(parse_parallel(input, 4), parse(input));
+}
+
+TEST(Parallel, FewLargeElements) {
+    // Slices start deep inside elements and inside strings
+    std::string big = "[";
+    for (int i = 0; i < 3; ++i) {
+        if (i) big += ",";
+        big += "{\"s\":\"" + std::string(500, i == 1 ? ',' : '[') + "\",\"a\":[";
+        for (int k = 0; k < 100; ++k) big += (k ? "," : "") + std::to_string(k);
+        big += "]}";
+    }
+    big += "]";
+    const JsonValue expected = parse(big);
+    for (size_t threads = 2; threads <= 16; ++threads) {
+        EXPECT_EQ(parse_split(big, threads), expected) << threads;
+    }
+}
+
+TEST(Parallel, NonArrayAndSmallInputsFallBack) {
+    EXPECT_EQ(parse_split(R"({"a":[1,2,3]})", 4), parse(R"({"a":[1,2,3]})"));
+    EXPECT_EQ(parse_split("[]", 4), parse("[]"));
+    EXPECT_EQ(parse_split("  42 ", 4).as_integer(), 42);
+    EXPECT_EQ(parse_parallel("[1,2,3]").size(), 3u);
+}
+
+TEST(Parallel, TrailingCommaOption) {
+    std::string input = make_tricky_array(300, 3);
+    input.insert(input.rfind(']'), ",");
+    EXPECT_THROW((void)parse_split(input, 4), ParseError);
+    ParseOptions opts;
+    opts.allow_trailing_commas = true;
+    EXPECT_EQ(parse_split(input, 4, opts), parse(input, opts));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Errors
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Parallel, ErrorsMatchSerialParse) {
+    const std::string good = make_tricky_array(400, 11);
+    std::vector<std::string> bad = {
+        good.substr(0, good.size() / 2),              // truncated
+        good + "x",                                   // trailing content
+        good.substr(0, good.size() / 3) + "," + good.substr(good.size() / 3),
+        "[" + std::string(3000, ' ') + "1,,2]",
+    };
+    std::string unclosed = good;
+    unclosed[unclosed.find('"')] = ' ';               // unbalanced quote
+    bad.push_back(unclosed);
+
+    for (const auto& input : bad) {
+        const auto expected = try_parse(input);
+        if (!expected.ec) continue;  // the mutation happened to stay valid
+        try {
+            (void)parse_split(input, 6);
+            ADD_FAILURE() << "expected ParseError";
+        } catch (const ParseError& e) {
+            EXPECT_EQ(e.code(), expected.ec);
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ParallelDocument
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Parallel, DocumentUsesPerThreadArenas) {
+    const std::string input = make_tricky_array(60000, 5);
+    const JsonValue expected = parse(input);
+    ParallelDocument doc;
+    doc.parse(input, 4);
+    EXPECT_EQ(doc.root(), expected);
+    EXPECT_GT(doc.bytes_allocated(), 0u);
+
+    // Reuse: arenas are rewound, not reallocated
+    doc.parse("[1,2]", 4);
+    EXPECT_EQ(doc.root(), parse("[1,2]"));
+    doc.parse(input, 4);
+    EXPECT_EQ(doc.root().size(), expected.size());
+
+    // A value copied out of the document survives reset()
+    JsonValue kept = doc.root()[2];
+    doc.reset();
+    EXPECT_EQ(kept, expected[2]);
+}
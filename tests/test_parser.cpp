@@ -375,6 +375,51 @@ TEST(Parser, ErrorLocationInfo) {
     }
 }
 
+TEST(Parser, ErrorMessagesAreFormattedOnThrow) {
+    auto message_of = [](std::string_view input, const ParseOptions& opts = {}) {
+        try {
+            (void)parse(input, opts);
+        } catch (const ParseError& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    EXPECT_NE(message_of("@").find("unexpected character '@'"), std::string::npos);
+    EXPECT_NE(message_of("[1 2]").find("expected ',' or ']' in array"), std::string::npos);
+    EXPECT_NE(message_of(R"({"a" 1})").find("expected ':', got '1'"), std::string::npos);
+    EXPECT_NE(message_of("nul").find("expected 'null'"), std::string::npos);
+    EXPECT_NE(message_of(R"("\q")").find("invalid escape '\\q'"), std::string::npos);
+
+    ParseOptions strict;
+    strict.allow_duplicate_keys = false;
+    EXPECT_NE(message_of(R"({"k":1,"k":2})", strict).find("duplicate key: \"k\""),
+              std::string::npos);
+}
+
+TEST(Parser, TryParseMatchesThrowingParse) {
+    ParseOptions strict;
+    strict.allow_duplicate_keys = false;
+    strict.max_depth = 4;
+    const char* inputs[] = {
+        "", "[1, 2, ]", R"({"key" "value"})", R"("unterminated)", "42 extra",
+        "nul", "1e", "@", "[[[[[1]]]]]", R"({"k":1,"k":2})", R"("\ud800")",
+        R"({"a":[1,{"b":tru}]})", "[1,2,3]",
+    };
+    for (const char* input : inputs) {
+        std::error_code expected;
+        try {
+            (void)parse(input, strict);
+        } catch (const ParseError& e) {
+            expected = e.code();
+        }
+        auto r = try_parse(input, strict);
+        EXPECT_EQ(r.ec, expected) << input;
+        if (r.ec) {
+            EXPECT_TRUE(r.value.is_null()) << input;
+        }
+    }
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Edge cases
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,103 @@
+/// @file test_parser_context.cpp
+/// @brief Unit tests for ParserContext (scratch memory reused across parses).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+std::string escaped_document(size_t n) {
+    std::string s = "{\"items\":[";
+    for (size_t i = 0; i < n; ++i) {
+        if (i) s += ",";
+        s += R"({"id":)" + std::to_string(i) +
+             R"(,"text":"line\none \"quoted\" \u00e9 and a fairly long tail to force heap storage"})";
+    }
+    s += "]}";
+    return s;
+}
+
+} // namespace
+
+TEST(ParserContext, MatchesParse) {
+    ParserContext ctx;
+    const std::vector<std::string> docs = {
+        "null", "[1,2,3]", R"({"a":"b\tc","d":[true,{"e":"\ud83d\ude00"}]})",
+        escaped_document(3), escaped_document(200),
+    };
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    ParseOptions indexed;
+    indexed.structural_index = true;
+    ParseOptions iterative;
+    iterative.iterative = true;
+
+    for (int round = 0; round < 2; ++round) {
+        for (const auto& doc : docs) {
+            for (const auto& opts : {ParseOptions{}, no_dups, indexed, iterative,
+                                     ParseOptions::json5()}) {
+                EXPECT_EQ(ctx.parse(doc, opts), parse(doc, opts)) << doc.substr(0, 40);
+            }
+        }
+    }
+}
+
+TEST(ParserContext, ErrorsMatchParse) {
+    ParserContext ctx;
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    for (const char* doc : {"", "[1,", "{\"a\":1,\"a\":2}", "\"\\x\"", "[1] 2"}) {
+        EXPECT_EQ(ctx.try_parse(doc, no_dups).ec, try_parse(doc, no_dups).ec) << doc;
+    }
+    EXPECT_THROW((void)ctx.parse("[1,"), ParseError);
+    EXPECT_EQ(ctx.parse("[1]").size(), 1u);  // usable after an error
+}
+
+TEST(ParserContext, ScratchStopsGrowingAfterWarmUp) {
+    ParserContext ctx(256);
+    ParseOptions opts;
+    opts.allow_duplicate_keys = false;
+    opts.structural_index = true;
+    const std::string doc = escaped_document(500);
+
+    (void)ctx.parse(doc, opts);
+    (void)ctx.parse(doc, opts);  // grows once to the high-water mark
+    const size_t warm = ctx.scratch_capacity();
+    EXPECT_GT(warm, 256u);
+    for (int i = 0; i < 20; ++i) {
+        (void)ctx.parse(doc, opts);
+        EXPECT_LE(ctx.scratch_used(), warm);
+    }
+    EXPECT_EQ(ctx.scratch_capacity(), warm);
+
+    (void)ctx.parse("[1]", opts);  // small documents keep the warm buffer
+    EXPECT_EQ(ctx.scratch_capacity(), warm);
+}
+
+TEST(ParserContext, ValuesOutliveContext) {
+    JsonValue v;
+    {
+        ParserContext ctx;
+        v = ctx.parse(escaped_document(10));
+    }
+    EXPECT_EQ(v["items"][9]["id"].as_integer(), 9);
+    EXPECT_EQ(v, parse(escaped_document(10)));
+}
+
+TEST(ParserContext, WithArenaScope) {
+    ParserContext ctx;
+    MonotonicArena arena;
+    const std::string doc = escaped_document(50);
+    {
+        ArenaScope scope(arena);
+        JsonValue v = ctx.parse(doc);
+        EXPECT_EQ(v, parse(doc));
+    }
+    EXPECT_GT(arena.bytes_used(), 0u);
+}
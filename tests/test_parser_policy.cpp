@@ -0,0 +1,99 @@
+/// @file test_parser_policy.cpp
+/// @brief Unit tests for compile-time parser specialization on ParseOptions.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace yajson;
+using namespace yajson::detail;
+
+namespace {
+
+template <typename Policy>
+bool selects(const ParseOptions& opts) {
+    return with_parser_policy(opts, [](auto policy) {
+        return std::is_same_v<decltype(policy), Policy>;
+    });
+}
+
+/// The fixed policy must behave exactly like the runtime flags it replaces.
+template <typename Policy>
+void expect_same_as_dynamic(const std::string& input, const ParseOptions& opts) {
+    SCOPED_TRACE(input);
+    std::string fixed_error, dynamic_error;
+    JsonValue fixed, dynamic;
+    try { fixed = BasicParser<Policy>::parse(input, opts); }
+    catch (const ParseError& e) { fixed_error = e.what(); }
+    try { dynamic = BasicParser<DynamicPolicy>::parse(input, opts); }
+    catch (const ParseError& e) { dynamic_error = e.what(); }
+    EXPECT_EQ(fixed_error, dynamic_error);
+    EXPECT_EQ(fixed, dynamic);
+}
+
+const std::vector<std::string> kInputs = {
+    R"({"a":[1,-2.5e3,"x\ty",true,null],"b":{}})",
+    "[1,2,]", "{\"a\":1,}", "// c\n[1]", "/* c */ {\"a\" /* x */ : 1}",
+    "['single', \"double\"]", "{key: 1, $k2: [2]}", "[NaN, Infinity, -Infinity]",
+    "[0x1F, -0xff]", "[\"tab\there\"]", "{\"a\":1,\"a\":2}", "[01]", "[1,,2]",
+};
+
+} // namespace
+
+TEST(ParserPolicy, PresetsSelectFixedPolicies) {
+    EXPECT_TRUE(selects<StrictPolicy>(ParseOptions{}));
+    EXPECT_TRUE(selects<StrictPolicy>(ParseOptions::strict()));
+    EXPECT_TRUE(selects<LenientPolicy>(ParseOptions::lenient()));
+    EXPECT_TRUE(selects<Json5Policy>(ParseOptions::json5()));
+
+    // Runtime-only settings do not affect the choice
+    ParseOptions opts;
+    opts.max_depth = 3;
+    opts.structural_index = true;
+    opts.iterative = true;
+    EXPECT_TRUE(selects<StrictPolicy>(opts));
+}
+
+TEST(ParserPolicy, CustomMixFallsBackToDynamic) {
+    ParseOptions opts;
+    opts.allow_comments = true;
+    EXPECT_TRUE(selects<DynamicPolicy>(opts));
+
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    EXPECT_TRUE(selects<DynamicPolicy>(no_dups));
+
+    ParseOptions json5_no_hex = ParseOptions::json5();
+    json5_no_hex.allow_hex_numbers = false;
+    EXPECT_TRUE(selects<DynamicPolicy>(json5_no_hex));
+}
+
+TEST(ParserPolicy, FixedPoliciesMatchDynamic) {
+    for (const auto& input : kInputs) {
+        expect_same_as_dynamic<StrictPolicy>(input, ParseOptions::strict());
+        expect_same_as_dynamic<LenientPolicy>(input, ParseOptions::lenient());
+        expect_same_as_dynamic<Json5Policy>(input, ParseOptions::json5());
+
+        ParseOptions iterative = ParseOptions::json5();
+        iterative.iterative = true;
+        expect_same_as_dynamic<Json5Policy>(input, iterative);
+    }
+}
+
+TEST(ParserPolicy, EntryPointsDispatch) {
+    // Public API, SAX and on-demand all route through the dispatcher
+    EXPECT_THROW((void)parse("[1,]"), ParseError);
+    EXPECT_EQ(parse("[1,]", ParseOptions::lenient()).size(), 1u);
+    EXPECT_EQ(parse("{a: 0x10}", ParseOptions::json5())["a"].as_integer(), 16);
+
+    struct Count : SaxHandler {
+        size_t n = 0;
+        void on_int64(int64_t) { ++n; }
+    } h;
+    parse_sax("// c\n[1, 2,]", h, ParseOptions::lenient());
+    EXPECT_EQ(h.n, 2u);
+}
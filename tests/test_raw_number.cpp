@@ -0,0 +1,179 @@
+/// @file test_raw_number.cpp
+/// @brief Unit tests for ParseOptions::number_mode = NumberMode::raw.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+ParseOptions raw() {
+    ParseOptions opts;
+    opts.number_mode = NumberMode::raw;
+    return opts;
+}
+
+struct NumberCollector : SaxHandler {
+    std::vector<JsonValue> numbers;
+    void on_int64(int64_t v) { numbers.emplace_back(v); }
+    void on_uint64(uint64_t v) { numbers.emplace_back(v); }
+    void on_double(double v) { numbers.emplace_back(v); }
+};
+
+} // namespace
+
+TEST(RawNumber, RoundTripIsByteExact) {
+    const std::string doc =
+        R"({"price":19.90,"qty":3,"id":123456789012345678901234567890,"tiny":1e-300,)"
+        R"("big":-1.5E+300,"zero":-0.0,"pi":3.14159265358979323846264338327950288,)"
+        R"("list":[0,-0,1.10,2e2,9007199254740993.0]})";
+    const JsonValue v = parse(doc, raw());
+    EXPECT_EQ(v.dump(), doc);
+    EXPECT_EQ(v["price"].as_raw_number(), "19.90");
+
+    // Pretty output reformats whitespace only
+    EXPECT_EQ(parse(v.dump(2), raw()).dump(), doc);
+}
+
+TEST(RawNumber, ConvertsOnAccess) {
+    const JsonValue v = parse(
+        R"([42,-7,18446744073709551615,-9223372036854775809,0.1,1e300,-1e-300,12.50])", raw());
+    for (const auto& n : v.as_array()) {
+        EXPECT_EQ(n.type(), Type::RawNumber);
+        EXPECT_TRUE(n.is_number());
+        EXPECT_FALSE(n.is_integer() || n.is_float() || n.is_string());
+    }
+    EXPECT_EQ(v[0].as_integer(), 42);
+    EXPECT_EQ(v[0].as_uinteger(), 42u);
+    EXPECT_EQ(v[0].get<int>(), 42);
+    EXPECT_EQ(v[1].as_integer(), -7);
+    EXPECT_THROW((void)v[1].as_uinteger(), TypeError);
+    EXPECT_EQ(v[2].as_uinteger(), UINT64_MAX);
+    EXPECT_THROW((void)v[2].as_integer(), TypeError);
+    EXPECT_DOUBLE_EQ(v[3].as_float(), -9223372036854775809.0);
+    EXPECT_EQ(v[4].as_float(), 0.1);
+    EXPECT_EQ(v[5].as_float(), 1e300);
+    EXPECT_EQ(v[6].as_float(), -1e-300);
+    EXPECT_THROW((void)v[7].as_integer(), TypeError);
+
+    EXPECT_EQ(v[0].get_or<int64_t>(-1), 42);
+    EXPECT_EQ(v[7].get_or<int64_t>(-1), -1);
+    EXPECT_EQ(v[7].get_or<double>(0), 12.5);
+    EXPECT_EQ(v[7].get_or<std::string>("none"), "none");
+    EXPECT_THROW((void)v[7].as_string_view(), TypeError);
+    EXPECT_THROW((void)JsonValue(1.5).as_raw_number(), TypeError);
+}
+
+TEST(RawNumber, EqualityComparesValues) {
+    const std::string doc = R"([1,-2,3.25,1e2,18446744073709551615,1.0])";
+    const JsonValue r = parse(doc, raw());
+    const JsonValue c = parse(doc);
+    EXPECT_EQ(r, c);
+    EXPECT_EQ(c, r);
+    EXPECT_EQ(r, parse(doc, raw()));
+    EXPECT_EQ(r[5], JsonValue(1));
+    EXPECT_EQ(parse("1.50", raw()), parse("1.5", raw()));
+    EXPECT_NE(parse("1.51", raw()), parse("1.5", raw()));
+    EXPECT_NE(parse("1", raw()), JsonValue("1"));
+}
+
+TEST(RawNumber, ErrorsMatchConvertMode) {
+    for (const char* doc : {"-", "[-]", "[1.]", "[1.e5]", "[1e]", "[1e+]", "[01]", "[-a]",
+                            "[.5]", "[1.5x]", "{\"a\":-}"}) {
+        const auto want = try_parse(doc);
+        ASSERT_FALSE(want) << doc;
+        const auto got = try_parse(doc, raw());
+        EXPECT_EQ(got.ec, want.ec) << doc;
+    }
+}
+
+TEST(RawNumber, RangeMatchesConvertMode) {
+    const std::string zeros(400, '0');
+    // Outside the double range: rejected at the same offset as in convert mode
+    for (const std::string& doc : std::vector<std::string>{
+             "1e400", "-1e400", "[1.8e308]", "1e-400", "{\"a\":-1e-400}", "2e-324",
+             "1" + zeros, "0." + zeros + "1", "[1, 1e99999999999]"}) {
+        size_t want = 0;
+        try {
+            (void)parse(doc);
+            ADD_FAILURE() << "convert mode accepted " << doc;
+        } catch (const ParseError& e) {
+            EXPECT_EQ(e.code(), make_error_code(errc::invalid_number)) << doc;
+            want = e.location().offset;
+        }
+        try {
+            (void)parse(doc, raw());
+            ADD_FAILURE() << "raw mode accepted " << doc;
+        } catch (const ParseError& e) {
+            EXPECT_EQ(e.code(), make_error_code(errc::invalid_number)) << doc;
+            EXPECT_EQ(e.location().offset, want) << doc;
+        }
+    }
+    // Near the limits but inside: kept as text, converted like convert mode
+    for (const std::string& doc : std::vector<std::string>{
+             "1.7976931348623157e308", "-4.9e-324", "1e-310", "0e999999", "0.0e-999",
+             "1" + zeros + "e-300", "123456789012345678901234567890e-350"}) {
+        const JsonValue r = parse(doc, raw());
+        EXPECT_EQ(r.as_raw_number(), doc);
+        EXPECT_EQ(r.as_float(), parse(doc).as_float()) << doc;
+    }
+}
+
+TEST(RawNumber, StorageFollowsStringRules) {
+    const std::string long_num = "123456789.123456789123456789";
+    std::string input = "[" + long_num + ",1.5]";
+
+    // Copied: independent of the input
+    JsonValue copied = parse(input, raw());
+    // Borrowed: a view into the input, like a borrowed string
+    ParseOptions borrow = raw();
+    borrow.borrow_strings = true;
+    const JsonValue borrowed = parse(input, borrow);
+    EXPECT_EQ(borrowed[0].as_raw_number().data(), input.data() + 1);
+    EXPECT_EQ(borrowed[1].as_raw_number(), "1.5");
+
+    // Copies of a borrowed number own their text
+    JsonValue copy = borrowed[0];
+    input.assign(input.size(), ' ');
+    EXPECT_EQ(copy.as_raw_number(), long_num);
+    EXPECT_EQ(copied[0].as_raw_number(), long_num);
+
+    // Arena
+    MonotonicArena arena(1024);
+    {
+        ArenaScope scope(arena);
+        const JsonValue a = parse("[" + long_num + "]", raw());
+        EXPECT_EQ(a[0].as_raw_number(), long_num);
+        EXPECT_EQ(a.dump(), "[" + long_num + "]");
+    }
+    EXPECT_GT(arena.bytes_used(), 0u);
+}
+
+TEST(RawNumber, ExtensionsStillConvert) {
+    ParseOptions opts = ParseOptions::json5();
+    opts.number_mode = NumberMode::raw;
+    const JsonValue v = parse("[0x1F, -Infinity, 2.50]", opts);
+    EXPECT_TRUE(v[0].is_integer());
+    EXPECT_EQ(v[0].as_integer(), 31);
+    EXPECT_TRUE(v[1].is_float());
+    EXPECT_TRUE(v[2].is_raw_number());
+}
+
+TEST(RawNumber, SaxAndOnDemandConvert) {
+    NumberCollector h;
+    parse_sax(R"([1,18446744073709551615,2.5])", h, raw());
+    ASSERT_EQ(h.numbers.size(), 3u);
+    EXPECT_TRUE(h.numbers[0].is_integer());
+    EXPECT_TRUE(h.numbers[1].is_uinteger());
+    EXPECT_TRUE(h.numbers[2].is_float());
+
+    ondemand::Document doc(R"({"n":12.50})", raw());
+    EXPECT_TRUE(doc.root()["n"].is_number());
+    EXPECT_EQ(doc.root()["n"].as_float(), 12.5);
+}
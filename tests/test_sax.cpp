@@ -0,0 +1,158 @@
+/// @file test_sax.cpp
+/// @brief Unit tests for the SAX event parser (parse_sax).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+namespace {
+
+/// Records every event as a compact string.
+struct Recorder {
+    std::vector<std::string> events;
+    void on_null() { events.push_back("null"); }
+    void on_bool(bool b) { events.push_back(b ? "true" : "false"); }
+    void on_int64(int64_t v) { events.push_back("i:" + std::to_string(v)); }
+    void on_uint64(uint64_t v) { events.push_back("u:" + std::to_string(v)); }
+    void on_double(double v) { events.push_back("d:" + std::to_string(v)); }
+    void on_string(std::string_view s) { events.push_back("s:" + std::string(s)); }
+    void on_key(std::string_view s) { events.push_back("k:" + std::string(s)); }
+    void start_object() { events.push_back("{"); }
+    void end_object(size_t n) { events.push_back("}" + std::to_string(n)); }
+    void start_array() { events.push_back("["); }
+    void end_array(size_t n) { events.push_back("]" + std::to_string(n)); }
+};
+
+/// Rebuilds a JsonValue from events (used to cross-check against parse()).
+struct DomBuilder {
+    std::vector<JsonValue> stack;
+    std::vector<std::string> keys;
+    JsonValue root;
+
+    void add(JsonValue v) {
+        if (stack.empty()) { root = std::move(v); return; }
+        auto& top = stack.back();
+        if (top.is_array()) {
+            top.push_back(std::move(v));
+        } else {
+            top.insert(std::move(keys.back()), std::move(v));
+            keys.pop_back();
+        }
+    }
+    void on_null() { add(JsonValue(nullptr)); }
+    void on_bool(bool b) { add(JsonValue(b)); }
+    void on_int64(int64_t v) { add(JsonValue(v)); }
+    void on_uint64(uint64_t v) { add(JsonValue(v)); }
+    void on_double(double v) { add(JsonValue(v)); }
+    void on_string(std::string_view s) { add(JsonValue(s)); }
+    void on_key(std::string_view s) { keys.emplace_back(s); }
+    void start_object() { stack.push_back(JsonValue::object()); }
+    void end_object(size_t) { auto v = std::move(stack.back()); stack.pop_back(); add(std::move(v)); }
+    void start_array() { stack.push_back(JsonValue::array()); }
+    void end_array(size_t) { auto v = std::move(stack.back()); stack.pop_back(); add(std::move(v)); }
+};
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Event sequence
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Sax, EventSequence) {
+    Recorder r;
+    parse_sax(R"({"a":[1,-2,18446744073709551615,0.5,"x",true,null],"b":{}})", r);
+    EXPECT_EQ(r.events, (std::vector<std::string>{
+        "{", "k:a", "[", "i:1", "i:-2", "u:18446744073709551615", "d:0.500000",
+        "s:x", "true", "null", "]7", "k:b", "{", "}0", "}2"}));
+}
+
+TEST(Sax, ScalarRoot) {
+    Recorder r;
+    parse_sax("  42  ", r);
+    EXPECT_EQ(r.events, (std::vector<std::string>{"i:42"}));
+}
+
+TEST(Sax, StringViewsPointIntoInputWithoutEscapes) {
+    struct Check : SaxHandler {
+        const std::string* input = nullptr;
+        int in_input = 0, decoded = 0;
+        void on_string(std::string_view s) {
+            bool inside = s.data() >= input->data() && s.data() < input->data() + input->size();
+            inside ? ++in_input : ++decoded;
+        }
+        void on_key(std::string_view s) { on_string(s); }
+    };
+    std::string input = R"({"plain":"no escapes here","esc":"tab\there"})";
+    Check c;
+    c.input = &input;
+    parse_sax(input, c);
+    EXPECT_EQ(c.in_input, 3);
+    EXPECT_EQ(c.decoded, 1);
+}
+
+TEST(Sax, DecodesEscapes) {
+    Recorder r;
+    parse_sax(R"(["a\"b\\c", "\u00e9\ud83d\ude00"])", r);
+    EXPECT_EQ(r.events[1], "s:a\"b\\c");
+    EXPECT_EQ(r.events[2], "s:\xC3\xA9\xF0\x9F\x98\x80");
+}
+
+TEST(Sax, DefaultHandlerCountsOnlyWhatItNeeds) {
+    struct Keys : SaxHandler {
+        size_t keys = 0;
+        void on_key(std::string_view) { ++keys; }
+    };
+    Keys h;
+    parse_sax(R"({"a":{"b":1,"c":[{"d":2}]}})", h);
+    EXPECT_EQ(h.keys, 4u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Equivalence with parse()
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Sax, RebuiltDomMatchesParse) {
+    const char* doc = R"({"users":[{"id":1,"name":"A\nB","tags":["x","y"],"score":9.75},
+        {"id":2,"name":"C","tags":[],"score":-1e-3,"big":12345678901234567890}],
+        "total":2,"ok":true,"none":null})";
+    DomBuilder b;
+    parse_sax(doc, b);
+    EXPECT_EQ(b.root, parse(doc));
+}
+
+TEST(Sax, ErrorsMatchParse) {
+    for (const char* bad : {"", "[1,]", R"({"a":1,})", "[1 2]", R"({"a" 1})", "nul",
+                            R"(["\u12"])", "[1] 2", "-", "{\"a\":\"\x01\"}"}) {
+        Recorder r;
+        auto ec = try_parse_sax(bad, r);
+        EXPECT_TRUE(ec) << bad;
+        EXPECT_EQ(ec, try_parse(bad).ec) << bad;
+    }
+    Recorder r;
+    EXPECT_THROW(parse_sax("[1,", r), ParseError);
+}
+
+TEST(Sax, OptionsAreHonored) {
+    Recorder r;
+    parse_sax("{key: 'v', /* c */ \"n\": [0x10, NaN,],}", r, ParseOptions::json5());
+    ASSERT_EQ(r.events.size(), 9u);
+    EXPECT_EQ(r.events[1], "k:key");
+    EXPECT_EQ(r.events[2], "s:v");
+    EXPECT_EQ(r.events[5], "i:16");
+
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    Recorder r2;
+    EXPECT_EQ(try_parse_sax(R"({"a":1,"b":{"a":2},"a":3})", r2, no_dups),
+              make_error_code(errc::duplicate_key));
+
+    ParseOptions shallow;
+    shallow.max_depth = 2;
+    Recorder r3;
+    EXPECT_EQ(try_parse_sax("[[[1]]]", r3, shallow), make_error_code(errc::max_depth_exceeded));
+}
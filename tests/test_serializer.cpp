@@ -6,8 +6,11 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
+#include <vector>
 
 using namespace yajson;
 
@@ -56,6 +59,46 @@ TEST(Serializer, FloatInteger) {
     EXPECT_NE(s.find('.'), std::string::npos);
 }
 
+TEST(Serializer, FloatShortestDigits) {
+    EXPECT_EQ(JsonValue(0.1).dump(), "0.1");
+    EXPECT_EQ(JsonValue(0.30000000000000004).dump(), "0.30000000000000004");
+    EXPECT_EQ(JsonValue(-37.7749295).dump(), "-37.7749295");
+    EXPECT_EQ(JsonValue(123.456).dump(), "123.456");
+    EXPECT_EQ(JsonValue(0.001).dump(), "0.001");
+    EXPECT_EQ(JsonValue(1.5e-7).dump(), "1.5e-07");
+    EXPECT_EQ(JsonValue(1e-5).dump(), "1e-05");
+    EXPECT_EQ(JsonValue(6.02214076e23).dump(), "6.02214076e+23");
+    EXPECT_EQ(JsonValue(1e300).dump(), "1e+300");
+    EXPECT_EQ(JsonValue(1e21).dump(), "1e+21");
+    EXPECT_EQ(JsonValue(1.2345678901234567e20).dump(), "123456789012345670000.0");
+    EXPECT_EQ(JsonValue(5e-324).dump(), "5e-324");
+    EXPECT_EQ(JsonValue(2.2250738585072014e-308).dump(), "2.2250738585072014e-308");
+    EXPECT_EQ(JsonValue(1.7976931348623157e308).dump(), "1.7976931348623157e+308");
+    EXPECT_EQ(JsonValue(-0.0).dump(), "0.0");
+}
+
+TEST(Serializer, FloatRoundTrip) {
+    // Random bit patterns, powers of two (asymmetric rounding interval) and
+    // neighbours of short decimals
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    std::vector<double> values;
+    for (int i = 0; i < 100000; ++i) {
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        double d;
+        std::memcpy(&d, &state, sizeof(d));
+        if (std::isfinite(d)) values.push_back(d);
+        const double decimal = static_cast<double>(state % 100000000) / 1000.0;
+        values.push_back(std::nextafter(decimal, 0.0));
+        values.push_back(std::nextafter(decimal, 1e9));
+    }
+    for (int e = -1074; e <= 1023; ++e) values.push_back(std::ldexp(1.0, e));
+    for (const double d : values) {
+        const std::string s = JsonValue(d).dump();
+        ASSERT_EQ(parse(s).as_float(), d) << s;
+        ASSERT_NE(s.find_first_of(".e"), std::string::npos) << s;
+    }
+}
+
 TEST(Serializer, FloatNaN) {
     EXPECT_EQ(JsonValue(std::nan("")).dump(), "null");
 }
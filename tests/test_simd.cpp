@@ -15,6 +15,7 @@
 #include <json/json.hpp>
 #include <json/detail/simd.hpp>
 
+#include <cstdio>
 #include <string>
 #include <cstring>
 
@@ -316,3 +317,399 @@ TEST(SimdEndToEnd, SerializeEnsureAsciiHighBytes) {
             << "prefix_len=" << prefix_len;
     }
 }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Structural index (stage 1)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+#include <json/detail/structural.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Byte-at-a-time reference implementation of build_structural_index.
+std::vector<uint32_t> reference_index(const std::string& s) {
+    std::vector<uint32_t> out;
+    bool in_str = false, escaped = false, prev_scalar = false, dirty = false;
+    for (size_t i = 0; i < s.size(); ++i) {
+        const auto c = static_cast<unsigned char>(s[i]);
+        const auto off = static_cast<uint32_t>(i);
+        if (in_str) {
+            if (escaped) { escaped = false; continue; }
+            if (c == '\\') { escaped = true; dirty = true; continue; }
+            if (c < 0x20) dirty = true;
+            if (c == '"') {
+                in_str = false;
+                if (!dirty) out.push_back(off | simd::kClosingQuoteTag);
+            }
+            prev_scalar = false;
+            continue;
+        }
+        // Outside strings an escape only neutralizes a quote
+        const bool was_escaped = escaped;
+        const bool escaped_quote = was_escaped && c == '"';
+        escaped = false;
+        if (c == '"' && !escaped_quote) {
+            in_str = true; dirty = false; prev_scalar = false;
+            out.push_back(off);
+        } else if (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',') {
+            prev_scalar = false;
+            out.push_back(off);
+        } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            prev_scalar = false;
+        } else {
+            if (!prev_scalar) out.push_back(off);
+            prev_scalar = true;
+            if (c == '\\' && !was_escaped) escaped = true;
+        }
+    }
+    out.push_back(static_cast<uint32_t>(s.size()));
+    return out;
+}
+
+std::vector<uint32_t> simd_index(const std::string& s) {
+    std::vector<uint32_t> out(s.size() + 1);
+    out.resize(simd::build_structural_index(s.data(), s.data() + s.size(), out.data()));
+    return out;
+}
+
+} // namespace
+
+TEST(StructuralIndex, PrefixXor) {
+    EXPECT_EQ(simd::prefix_xor(0), 0u);
+    EXPECT_EQ(simd::prefix_xor(1), ~uint64_t{0});
+    // Quotes at 2 and 5 → bits 2..4 inside
+    EXPECT_EQ(simd::prefix_xor((1u << 2) | (1u << 5)), uint64_t{0x1C});
+}
+
+TEST(StructuralIndex, SimpleDocument) {
+    std::string s = R"({"a": [1, true], "b":"x"})";
+    auto idx = simd_index(s);
+    EXPECT_EQ(idx, reference_index(s));
+    // '{' '"' '"'c ':' '[' '1' ',' 't' ']' ',' '"' '"'c ':' '"' '"'c '}' sentinel
+    EXPECT_EQ(idx.size(), 17u);
+    EXPECT_EQ(idx.front(), 0u);
+    EXPECT_EQ(idx.back(), s.size());
+}
+
+TEST(StructuralIndex, EscapedQuotesAndBackslashRuns) {
+    for (const std::string& s : {
+             std::string(R"(["a\"b", "c\\", "d\\\"e", "\\\\"])"),
+             std::string(R"({"k\\\\\\\"":1})"),
+             std::string(R"(["A", "plain"])"),
+         }) {
+        EXPECT_EQ(simd_index(s), reference_index(s)) << s;
+    }
+}
+
+TEST(StructuralIndex, BackslashRunAcrossBlockBoundary) {
+    // Runs of backslashes straddling the 64-byte boundary at every offset
+    for (size_t pad = 50; pad < 70; ++pad) {
+        for (size_t run = 1; run <= 6; ++run) {
+            std::string s = "[\"" + std::string(pad, 'x') + std::string(run, '\\') +
+                            "\"\", 1]";
+            EXPECT_EQ(simd_index(s), reference_index(s)) << "pad=" << pad << " run=" << run;
+        }
+    }
+}
+
+TEST(StructuralIndex, RandomizedAgainstReference) {
+    std::mt19937 rng(12345);
+    const char alphabet[] = "{}[]:,\"\\ \n\tab1-.\x01";
+    for (int iter = 0; iter < 2000; ++iter) {
+        std::string s(rng() % 300, ' ');
+        for (auto& c : s) c = alphabet[rng() % (sizeof(alphabet) - 1)];
+        ASSERT_EQ(simd_index(s), reference_index(s)) << "iter=" << iter;
+    }
+}
+
+TEST(StructuralIndex, WindowedFillMatchesFullIndex) {
+    std::mt19937 rng(777);
+    const char alphabet[] = "{}[]:,\"\\ ab1";
+    std::string s(5000, ' ');
+    for (auto& c : s) c = alphabet[rng() % (sizeof(alphabet) - 1)];
+
+    simd::StructuralIndexer indexer;
+    std::vector<uint32_t> joined, window(257);
+    for (;;) {
+        size_t n = indexer.fill(s.data(), s.data() + s.size(), window.data(), 256);
+        ASSERT_GT(n, 0u);
+        joined.insert(joined.end(), window.begin(), window.begin() + static_cast<long>(n) - 1);
+        if (window[n - 1] != simd::kIndexRefill) {
+            joined.push_back(window[n - 1]);
+            break;
+        }
+    }
+    EXPECT_EQ(joined, reference_index(s));
+}
+
+TEST(StructuralIndex, ParseMatchesSingleStage) {
+    std::string doc = "{\n";
+    for (int i = 0; i < 200; ++i) {
+        doc += "    \"key_" + std::to_string(i) + "\" : {\"s\": \"value with \\\"escapes\\\" " +
+               std::to_string(i) + "\", \"n\": " + std::to_string(i * 1.5) +
+               ", \"a\": [ true , false , null , -" + std::to_string(i) + " ],\n" +
+               "        \"long\": \"" + std::string(static_cast<size_t>(i % 80), 'z') +
+               "\", \"u\": \"\\u00e9\\n\"},\n";
+    }
+    doc += "    \"last\": []\n}\n";
+
+    yajson::ParseOptions opts;
+    opts.structural_index = true;
+    auto a = yajson::parse(doc);
+    auto b = yajson::parse(doc, opts);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.dump(), b.dump());
+}
+
+TEST(StructuralIndex, ErrorsMatchSingleStage) {
+    yajson::ParseOptions opts;
+    opts.structural_index = true;
+    for (const char* bad : {
+             R"({"a": 1,,})", R"(["abc)", R"({"a"   1})", "[1, 2]   x",
+             "[\"ctl\x01\"]", R"(["bad \q escape"])", "[\n\n   ", R"({"a":tru})",
+             "{\"a\":\"b\",   \"c\"     \\ : 1}",
+         }) {
+        auto r1 = yajson::try_parse(bad);
+        auto r2 = yajson::try_parse(bad, opts);
+        EXPECT_TRUE(r1.ec) << bad;
+        EXPECT_EQ(r1.ec, r2.ec) << bad;
+    }
+}
+
+TEST(StructuralIndex, GarbageAfterScalarMatchesSingleStage) {
+    // Bytes between a token and the next indexed position are not skipped
+    yajson::ParseOptions opts;
+    opts.structural_index = true;
+    std::string far = "[ -4529153152\x01" + std::string(40, '4') + ", 1]";
+    for (const std::string& bad : {
+             std::string("[1\x01]"), std::string("{\"a\":1\x01}"), std::string("[1\x01,2]"),
+             std::string("[true\x01]"), std::string("[null  x]"), std::string("[\"s\" \x7f, 1]"),
+             std::string("{\"a\" \x01: 1}"), far,
+         }) {
+        size_t plain = 0;
+        std::error_code plain_ec;
+        try {
+            (void)yajson::parse(bad);
+            ADD_FAILURE() << "accepted: " << bad;
+        } catch (const yajson::ParseError& e) {
+            plain = e.location().offset;
+            plain_ec = e.code();
+        }
+        try {
+            (void)yajson::parse(bad, opts);
+            ADD_FAILURE() << "accepted with index: " << bad;
+        } catch (const yajson::ParseError& e) {
+            EXPECT_EQ(e.code(), plain_ec) << bad;
+            EXPECT_EQ(e.location().offset, plain) << bad;
+        }
+    }
+    EXPECT_EQ(yajson::parse("[1 \t\n, 2 ]", opts), yajson::parse("[1,2]"));
+}
+
+TEST(StructuralIndex, IgnoredWithIncompatibleExtensions) {
+    auto opts = yajson::ParseOptions::lenient();
+    opts.structural_index = true;
+    auto v = yajson::parse("{ // c\n  'k':   \"v\"  }", opts);
+    EXPECT_EQ(v["k"].as_string(), "v");
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Value skipping and element counting
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/// Byte-at-a-time reference for skip_container (nullptr → npos) and
+/// count_elements (unlimited scan). Outside strings an escape only
+/// neutralizes a quote, as in the block scanner.
+struct ReferenceScan {
+    size_t end = std::string::npos;
+    size_t count = 1;
+};
+
+ReferenceScan reference_scan(const std::string& s, size_t start, bool count_mode) {
+    ReferenceScan r;
+    bool in_str = false, escaped = false;
+    size_t depth = 0;
+    for (size_t i = start; i < s.size(); ++i) {
+        const char c = s[i];
+        const bool was_escaped = escaped;
+        escaped = c == '\\' && !was_escaped;
+        if (c == '"' && !was_escaped) { in_str = !in_str; continue; }
+        if (in_str || c == '"') continue;
+        if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            if (count_mode && depth == 0) return r;
+            if (--depth == 0 && !count_mode) { r.end = i + 1; return r; }
+        } else if (c == ',' && count_mode && depth == 0) {
+            ++r.count;
+        }
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(SkipValue, RandomizedAgainstReference) {
+    std::mt19937 rng(4242);
+    const char alphabet[] = "{}[]{}[],\"\"\\ ab1";
+    for (int iter = 0; iter < 3000; ++iter) {
+        std::string s(1 + rng() % 400, ' ');
+        for (auto& c : s) c = alphabet[rng() % (sizeof(alphabet) - 1)];
+        s[0] = (iter & 1) ? '[' : '{';
+        const char* begin = s.data();
+        const char* end = begin + s.size();
+
+        const ReferenceScan skip = reference_scan(s, 0, false);
+        const char* got = simd::skip_container(begin, end);
+        ASSERT_EQ(got ? static_cast<size_t>(got - begin) : std::string::npos, skip.end)
+            << "iter=" << iter;
+
+        const ReferenceScan count = reference_scan(s, 1, true);
+        ASSERT_EQ(simd::count_elements(begin + 1, end, s.size()), count.count)
+            << "iter=" << iter;
+    }
+}
+
+TEST(SkipValue, BackslashRunAcrossBlockBoundary) {
+    for (size_t pad = 50; pad < 70; ++pad) {
+        for (size_t run = 1; run <= 6; ++run) {
+            std::string s = "[\"" + std::string(pad, 'x') + std::string(run, '\\') +
+                            "\"]\", [1]] tail";
+            const ReferenceScan ref = reference_scan(s, 0, false);
+            const char* got = simd::skip_container(s.data(), s.data() + s.size());
+            ASSERT_EQ(got ? static_cast<size_t>(got - s.data()) : std::string::npos, ref.end)
+                << "pad=" << pad << " run=" << run;
+        }
+    }
+}
+
+TEST(SkipValue, PublicSkipValue) {
+    auto end_of = [](const std::string& s) -> long {
+        const char* p = yajson::skip_value(s.data(), s.data() + s.size());
+        return p ? static_cast<long>(p - s.data()) : -1;
+    };
+    EXPECT_EQ(end_of(R"(  {"a": [1, "]}"], "b": {}} , 2)"), 27);
+    EXPECT_EQ(end_of(R"("esc \" ] quote", 1)"), 16);
+    EXPECT_EQ(end_of("-12.5e3]"), 7);
+    EXPECT_EQ(end_of("true"), 4);
+    EXPECT_EQ(end_of("[[1, 2], [3]"), -1);
+    EXPECT_EQ(end_of(R"("open)"), -1);
+    EXPECT_EQ(end_of("  "), -1);
+    EXPECT_EQ(end_of(", 1"), -1);
+
+    // Large nested document: the end is the end of the input
+    std::string big = "[";
+    for (int i = 0; i < 2000; ++i) {
+        if (i) big += ",";
+        big += R"({"id":)" + std::to_string(i) + R"(,"s":"}]\"\\","n":[[],{}]})";
+    }
+    big += "]";
+    EXPECT_EQ(end_of(big + ", 1"), static_cast<long>(big.size()));
+}
+
+TEST(SkipValue, CountElementsStopsAtLimit) {
+    std::string s = "[";
+    for (int i = 0; i < 1000; ++i) s += (i ? ",1" : "1");
+    s += "]";
+    const char* first = s.data() + 1;
+    const char* end = s.data() + s.size();
+    EXPECT_EQ(simd::count_elements(first, end, s.size()), 1000u);
+    const size_t partial = simd::count_elements(first, end, 512);
+    EXPECT_GE(partial, 256u);
+    EXPECT_LT(partial, 1000u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// UTF-8 validation
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+size_t invalid_utf8_at(const std::string& s) {
+    return static_cast<size_t>(simd::validate_utf8(s.data(), s.data() + s.size()) - s.data());
+}
+
+} // namespace
+
+TEST(ValidateUtf8, EveryErrorClassAtEveryBlockOffset) {
+    struct Case {
+        const char* seq;
+        long bad;  ///< offset of the reported byte in seq, -1 if valid
+    };
+    const Case cases[] = {
+        {"\xC3\xA9", -1},         {"\xE4\xB8\xAD", -1},     {"\xF0\x9F\x98\x80", -1},
+        {"\xEF\xBF\xBF", -1},     {"\xF4\x8F\xBF\xBF", -1}, {"\xED\x9F\xBF", -1},
+        {"\x80", 0},               {"\xBF", 0},               {"\xC0\x80", 0},
+        {"\xC1\xBF", 0},           {"\xE0\x80\x80", 0},       {"\xE0\x9F\xBF", 0},
+        {"\xF0\x80\x80\x80", 0},   {"\xF0\x8F\xBF\xBF", 0},   {"\xED\xA0\x80", 0},
+        {"\xED\xBF\xBF", 0},       {"\xF4\x90\x80\x80", 0},   {"\xF5\x80\x80\x80", 0},
+        {"\xF8\x88\x80\x80\x80", 0}, {"\xFF", 0},              {"\xC3", 0},
+        {"\xE4\xB8", 0},           {"\xF0\x9F\x98", 0},       {"\xC3\xA9\xA9", 2},
+    };
+    for (const Case& c : cases) {
+        for (size_t at = 0; at < 70; ++at) {
+            for (const char* after : {"", "x", "\xC3\xA9"}) {
+                const std::string s = std::string(at, 'a') + c.seq + after;
+                const size_t want = c.bad < 0 ? s.size() : at + static_cast<size_t>(c.bad);
+                ASSERT_EQ(invalid_utf8_at(s), want) << "at=" << at << " after=" << after;
+            }
+        }
+    }
+}
+
+TEST(ValidateUtf8, RandomizedAgainstScalar) {
+    std::mt19937 rng(1717);
+    const char* const pieces[] = {
+        "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\xD0\xAF",   // valid
+        "\x80", "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xC3", "\xFE",
+    };
+    for (int iter = 0; iter < 20000; ++iter) {
+        std::string s;
+        const size_t n = rng() % 160;
+        const unsigned bad_rate = iter % 4 == 0 ? 0 : 3;
+        for (size_t i = 0; i < n; ++i) {
+            const unsigned r = rng() % 100;
+            if (r < 60) s += static_cast<char>('a' + rng() % 26);
+            else if (r < 100 - bad_rate) s += pieces[rng() % 4];
+            else s += pieces[4 + rng() % 6];
+        }
+        const char* want = yajson::detail::utf8::find_invalid(s.data(), s.data() + s.size());
+        ASSERT_EQ(simd::validate_utf8(s.data(), s.data() + s.size()), want) << "iter=" << iter;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Eight-digit SWAR
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(EightDigits, EveryByteValue) {
+    // A single non-digit byte at any position must be rejected
+    for (int pos = 0; pos < 8; ++pos) {
+        for (int b = 0; b < 256; ++b) {
+            char buf[8];
+            std::memcpy(buf, "12345678", 8);
+            buf[pos] = static_cast<char>(b);
+            const bool digit = b >= '0' && b <= '9';
+            ASSERT_EQ(simd::is_eight_digits(simd::load_digits8(buf)), digit)
+                << "pos=" << pos << " byte=" << b;
+        }
+    }
+}
+
+TEST(EightDigits, ParseMatchesScalar) {
+    std::mt19937 rng(88);
+    for (int iter = 0; iter < 100000; ++iter) {
+        const uint32_t v = iter < 10 ? (iter == 0 ? 0u : 99999999u - static_cast<uint32_t>(iter))
+                                     : rng() % 100000000u;
+        char buf[9];
+        std::snprintf(buf, sizeof(buf), "%08u", v);
+        const uint64_t w = simd::load_digits8(buf);
+        ASSERT_TRUE(simd::is_eight_digits(w)) << buf;
+        ASSERT_EQ(simd::parse_eight_digits(w), v) << buf;
+    }
+}
@@ -0,0 +1,199 @@
+/// @file test_tape.cpp
+/// @brief Unit tests for TapeDocument (tape-based immutable documents).
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace yajson;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Scalars
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(TapeDocument, Scalars) {
+    TapeDocument doc;
+    doc.parse("null");
+    EXPECT_TRUE(doc.root().is_null());
+    doc.parse("true");
+    EXPECT_TRUE(doc.root().as_bool());
+    doc.parse("false");
+    EXPECT_FALSE(doc.root().as_bool());
+    doc.parse("-42");
+    EXPECT_EQ(doc.root().as_integer(), -42);
+    EXPECT_EQ(doc.root().type(), Type::Integer);
+    doc.parse("18446744073709551615");
+    EXPECT_EQ(doc.root().type(), Type::UInteger);
+    EXPECT_EQ(doc.root().as_uinteger(), std::numeric_limits<uint64_t>::max());
+    doc.parse("3.25");
+    EXPECT_DOUBLE_EQ(doc.root().as_float(), 3.25);
+    doc.parse(R"("hello")");
+    EXPECT_EQ(doc.root().as_string_view(), "hello");
+}
+
+TEST(TapeDocument, EscapedStrings) {
+    auto doc = parse_tape(R"(["a\"b", "tab\there", "é", "😀"])");
+    auto arr = doc.root();
+    EXPECT_EQ(arr[0].as_string_view(), "a\"b");
+    EXPECT_EQ(arr[1].as_string_view(), "tab\there");
+    EXPECT_EQ(arr[2].as_string_view(), "\xC3\xA9");
+    EXPECT_EQ(arr[3].as_string_view(), "\xF0\x9F\x98\x80");
+}
+
+TEST(TapeDocument, NumbersConvertLikeJsonValue) {
+    auto doc = parse_tape("[1, -1, 9223372036854775808, 1.5]");
+    auto arr = doc.root();
+    EXPECT_DOUBLE_EQ(arr[0].as_float(), 1.0);
+    EXPECT_EQ(arr[0].as_uinteger(), 1u);
+    EXPECT_THROW((void)arr[1].as_uinteger(), TypeError);
+    EXPECT_THROW((void)arr[2].as_integer(), TypeError);
+    EXPECT_THROW((void)arr[3].as_integer(), TypeError);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Containers
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(TapeDocument, ObjectAccess) {
+    auto doc = parse_tape(R"({"route":"/api","n":3,"nested":{"x":[1,{"y":true}]}})");
+    auto root = doc.root();
+    ASSERT_TRUE(root.is_object());
+    EXPECT_EQ(root.size(), 3u);
+    EXPECT_EQ(root["route"].as_string_view(), "/api");
+    EXPECT_EQ(root["n"].as_integer(), 3);
+    EXPECT_TRUE(root["nested"]["x"][1]["y"].as_bool());
+    EXPECT_TRUE(root.contains("nested"));
+    EXPECT_FALSE(root.find("missing").has_value());
+    EXPECT_THROW((void)root["missing"], OutOfRangeError);
+    EXPECT_THROW((void)root[0], TypeError);
+}
+
+TEST(TapeDocument, ArrayIteration) {
+    auto doc = parse_tape(R"([1, [2, 3], {"a": 4}, "s", 5.5, null])");
+    auto arr = doc.root().as_array();
+    EXPECT_EQ(arr.size(), 6u);
+    std::vector<Type> types;
+    for (TapeValue v : arr) types.push_back(v.type());
+    EXPECT_EQ(types, (std::vector<Type>{Type::Integer, Type::Array, Type::Object,
+                                        Type::String, Type::Float, Type::Null}));
+    EXPECT_EQ(arr[1][1].as_integer(), 3);
+    EXPECT_THROW((void)arr[6], OutOfRangeError);
+}
+
+TEST(TapeDocument, ObjectIteration) {
+    auto doc = parse_tape(R"({"a":1,"b":[true],"c":{}})");
+    std::vector<std::string> keys;
+    for (auto [key, value] : doc.root().as_object()) {
+        keys.emplace_back(key);
+        if (key == "b") {
+            EXPECT_EQ(value.size(), 1u);
+        }
+        if (key == "c") {
+            EXPECT_TRUE(value.empty());
+        }
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(TapeDocument, DuplicateKeysLastWins) {
+    auto doc = parse_tape(R"({"k":1,"k":2})");
+    EXPECT_EQ(doc.root()["k"].as_integer(), 2);
+    EXPECT_EQ(doc.root().to_value(), parse(R"({"k":2})"));
+
+    // to_value() keeps the same entries, in the same order, as parse()
+    std::string big = "{";
+    for (int i = 0; i < 40; ++i) big += "\"k" + std::to_string(i % 25) + "\":" + std::to_string(i) + ",";
+    big.back() = '}';
+    for (const std::string& text : {std::string(R"({"k":1,"a":2,"k":3})"), big}) {
+        const JsonValue v = parse_tape(text).root().to_value();
+        EXPECT_EQ(v.dump(), parse(text).dump()) << text;
+        EXPECT_EQ(v, parse(text)) << text;
+    }
+    EXPECT_EQ(parse_tape(R"({"k":1,"a":2,"k":3})").root().to_value().dump(), R"({"a":2,"k":3})");
+    EXPECT_EQ(parse_tape(big).root().to_value()["k3"].as_integer(), 28);
+}
+
+TEST(TapeDocument, EmptyContainers) {
+    auto doc = parse_tape("[[], {}, [[]]]");
+    auto root = doc.root();
+    EXPECT_TRUE(root[0].empty());
+    EXPECT_TRUE(root[1].empty());
+    EXPECT_EQ(root[2].size(), 1u);
+    EXPECT_EQ(root[2].as_array().begin(), root[2].as_array().begin());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Equivalence with the DOM parser
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(TapeDocument, ToValueMatchesDom) {
+    std::string doc_text = "{";
+    for (int i = 0; i < 50; ++i) {
+        if (i) doc_text += ",";
+        doc_text += "\"k" + std::to_string(i) + "\":{\"id\":" + std::to_string(i) +
+                    ",\"name\":\"item \\\"" + std::to_string(i) + "\\\"\",\"v\":[" +
+                    std::to_string(i * 0.5) + ",-" + std::to_string(i) + ",false]}";
+    }
+    doc_text += "}";
+    auto tape = parse_tape(doc_text);
+    EXPECT_EQ(tape.root().to_value(), parse(doc_text));
+    EXPECT_EQ(tape.root().to_value().dump(), parse(doc_text).dump());
+}
+
+TEST(TapeDocument, ErrorsMatchDom) {
+    TapeDocument doc;
+    for (const char* bad : {"", "[1,", R"({"a" 1})", "[1] x", "tru", R"(["\x"])",
+                            "[01]", R"({"a":1,})"}) {
+        auto dom = try_parse(bad);
+        auto ec = doc.try_parse(bad);
+        EXPECT_TRUE(ec) << bad;
+        EXPECT_EQ(ec, dom.ec) << bad;
+        EXPECT_TRUE(doc.root().is_null());
+    }
+    EXPECT_THROW(doc.parse("[1, 2"), ParseError);
+}
+
+TEST(TapeDocument, RejectsInputBeyond32BitLimits) {
+    // The size is checked before any byte is read, so the view's bytes
+    // past the small buffer are never touched
+    const std::string small = "[1]";
+    const std::string_view huge(small.data(), TapeDocument::kMaxInputSize + 1);
+    TapeDocument doc;
+    doc.parse(small);
+    EXPECT_EQ(doc.try_parse(huge), make_error_code(errc::input_too_large));
+    EXPECT_TRUE(doc.root().is_null());
+    try {
+        doc.parse(huge);
+        FAIL() << "expected ParseError";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), make_error_code(errc::input_too_large));
+    }
+}
+
+TEST(TapeDocument, OptionsAreHonored) {
+    auto doc = parse_tape("{unquoted: 'single', /* c */ \"t\": [1,2,],}", ParseOptions::lenient());
+    EXPECT_EQ(doc.root()["unquoted"].as_string_view(), "single");
+    EXPECT_EQ(doc.root()["t"].size(), 2u);
+
+    ParseOptions no_dups;
+    no_dups.allow_duplicate_keys = false;
+    TapeDocument d2;
+    EXPECT_EQ(d2.try_parse(R"({"a":1,"a":2})", no_dups), make_error_code(errc::duplicate_key));
+}
+
+TEST(TapeDocument, ReuseKeepsCapacity) {
+    TapeDocument doc;
+    doc.parse(R"({"a":[1,2,3],"b":"some string value"})");
+    const size_t words = doc.tape_size();
+    EXPECT_GT(words, 0u);
+    EXPECT_GT(doc.string_bytes(), 0u);
+    doc.parse("[true]");
+    EXPECT_EQ(doc.tape_size(), 3u);  // '[' 't' ']'
+    EXPECT_TRUE(doc.root()[0].as_bool());
+    doc.clear();
+    EXPECT_TRUE(doc.root().is_null());
+}
@@ -7,6 +7,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace yajson;
 
@@ -230,6 +231,17 @@ TEST(JsonPtr, EqualityOp) {
     EXPECT_NE(JsonPointer("/a"), JsonPointer("/b"));
 }
 
+TEST(JsonPtr, MoveShortPointer) {
+    // Short pointer strings live in SSO storage, which does not move
+    auto v = parse(R"({"a":{"b":[1,2]},"c~":3})");
+    std::vector<JsonPointer> ptrs;
+    for (int i = 0; i < 20; ++i) ptrs.emplace_back(i % 2 ? "/a/b/1" : "/c~0");
+    JsonPointer moved = std::move(ptrs[1]);
+    EXPECT_EQ(moved.resolve(v).as_integer(), 2);
+    EXPECT_EQ(ptrs[18].resolve(v).as_integer(), 3);
+    EXPECT_EQ(ptrs[19].to_string(), "/a/b/1");
+}
+
 // === JsonWriter ===
 
 TEST(Writer, Null) {
@@ -268,6 +280,15 @@ TEST(Writer, Float) {
     EXPECT_NE(b.find("3.14"), std::string::npos);
 }
 
+TEST(Writer, FloatMatchesDump) {
+    for (const double d : {1.0, -0.5, 0.1, 1e-7, 6.02214076e23, 5e-324, -0.0}) {
+        std::string b;
+        JsonWriter w(b);
+        w.float_value(d);
+        EXPECT_EQ(b, JsonValue(d).dump());
+    }
+}
+
 TEST(Writer, NaN) {
     std::string b;
     JsonWriter w(b);
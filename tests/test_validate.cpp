@@ -0,0 +1,294 @@
+/// @file test_validate.cpp
+/// @brief Unit tests for validate() and ParseOptions::validate_utf8.
+
+#include <json/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+using namespace yajson;
+
+// Counts global allocations made by the current thread while enabled, and
+// fails them on request. The replacements are kept out of line so that GCC
+// does not pair an inlined free() with operator new at call sites
+// (-Wmismatched-new-delete).
+namespace {
+thread_local bool g_counting = false;
+thread_local size_t g_allocations = 0;
+thread_local bool g_fail_allocations = false;
+} // namespace
+
+JSON_NOINLINE void* operator new(std::size_t n) {
+    if (g_fail_allocations) throw std::bad_alloc();
+    if (g_counting) ++g_allocations;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+JSON_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+JSON_NOINLINE void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Over-aligned allocations (std::pmr::new_delete_resource() uses these): the
+// block start is stored just below the aligned pointer.
+JSON_NOINLINE void* operator new(std::size_t n, std::align_val_t al) {
+    if (g_fail_allocations) throw std::bad_alloc();
+    if (g_counting) ++g_allocations;
+    const auto a = static_cast<std::size_t>(al);
+    void* block = std::malloc(n + a + sizeof(void*));
+    if (!block) throw std::bad_alloc();
+    const auto start = reinterpret_cast<std::uintptr_t>(block) + sizeof(void*);
+    void* p = reinterpret_cast<void*>((start + a - 1) / a * a);
+    static_cast<void**>(p)[-1] = block;
+    return p;
+}
+JSON_NOINLINE void operator delete(void* p, std::align_val_t) noexcept {
+    if (p) std::free(static_cast<void**>(p)[-1]);
+}
+JSON_NOINLINE void operator delete(void* p, std::size_t, std::align_val_t al) noexcept {
+    operator delete(p, al);
+}
+
+namespace {
+
+const char* const kDoc = R"({
+  "id": 12345, "neg": -17, "pi": 3.25e-2, "big": 18446744073709551615,
+  "s": "plain", "esc": "a\"b\\cé\n", "t": true, "f": false, "n": null,
+  "long": "a string that is longer than any small-string buffer, with \\ escapes \t",
+  "arr": [1, 2.5, -3, "x", [], {}, [[0]]],
+  "key": {"k": {"k": [true, false, null, "café 😀"]}}
+})";
+
+/// validate() must agree with try_parse(): accepted, or the same error code
+/// at the same location as parse().
+void expect_same_as_parse(const std::string& doc, const ParseOptions& opts = {}) {
+    const result<void> r = validate(doc, opts);
+    try {
+        (void)parse(doc, opts);
+        EXPECT_TRUE(r) << doc << ": " << r.ec.message();
+    } catch (const ParseError& want) {
+        ASSERT_FALSE(r) << "accepted: " << doc;
+        EXPECT_EQ(r.ec, want.code()) << doc;
+        EXPECT_EQ(r.location.offset, want.location().offset) << doc;
+        EXPECT_EQ(r.location.line, want.location().line) << doc;
+        EXPECT_EQ(r.location.column, want.location().column) << doc;
+    }
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// validate() ≡ try_parse()
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(Validate, MatchesParse) {
+    expect_same_as_parse(kDoc);
+    for (const char* doc : {
+             "0", "-0", "1e5", "true", "null", "\"\"", "[]", "{}", "  [1, 2, 3]  \n",
+             "", "  ", "[1,]", "{\"a\":1,}", "[1 2]", "{} x", "[01]", "\"a\x01\"",
+             R"("\x")", R"("\ud800")", R"(["\u12G4"])", R"({"a" 1})", R"({1: 2})", "nul",
+             "[-]", "'s'", "// c\n1", "NaN", "0x1F",
+         }) {
+        expect_same_as_parse(doc);
+    }
+    // A control character before the first escape, or in a string that is
+    // never closed, is found by the same scan in both
+    for (const std::string& doc : {
+             std::string(" \"[:0123406789t\n"), std::string("\"a\tb"), std::string("[\"a\x01z\\n\"]"),
+             std::string("[\"a\0z\\n\"]", 9), std::string("{\"k\x01\\n\":1}"),
+             std::string("[\"") + std::string(70, 'a') + "\x1f" + std::string(70, 'b') + "\\t\"]",
+         }) {
+        expect_same_as_parse(doc);
+        ParseOptions ctl;
+        ctl.allow_control_chars = true;
+        expect_same_as_parse(doc, ctl);
+    }
+}
+
+TEST(Validate, RandomMutationsMatchParse) {
+    const std::string base = std::string(kDoc) + R"( ["a string with \ escapes and é", 'sq', [1e5]])";
+    const char bytes[] = {'\0', '\x01', '\n', '\t', '"', '\\', '\'', 'u', '{', '}', '[',
+                          ']', ',', ':', ' ', '/', '*', 'x', '0', 'e', '-'};
+    std::vector<ParseOptions> options(6);
+    options[1] = ParseOptions::json5();
+    options[2].structural_index = true;
+    options[3].allow_control_chars = true;
+    options[4].allow_duplicate_keys = false;
+    options[5].iterative = true;
+
+    std::mt19937 rng(17);
+    for (int i = 0; i < 3000; ++i) {
+        std::string doc = base;
+        for (int k = 1 + static_cast<int>(rng() % 3); k > 0; --k) {
+            const size_t pos = rng() % doc.size();
+            if (rng() % 2) doc[pos] = bytes[rng() % sizeof(bytes)];
+            else           doc.insert(doc.begin() + static_cast<std::ptrdiff_t>(pos), bytes[rng() % sizeof(bytes)]);
+        }
+        if (rng() % 4 == 0) doc.resize(rng() % doc.size());
+        for (const ParseOptions& opts : options) expect_same_as_parse(doc, opts);
+        if (::testing::Test::HasFailure()) break;
+    }
+}
+
+TEST(Validate, EveryTruncationMatchesParse) {
+    const std::string doc = kDoc;
+    for (size_t n = 0; n <= doc.size(); ++n) {
+        expect_same_as_parse(doc.substr(0, n));
+    }
+}
+
+TEST(Validate, HonoursOptions) {
+    const ParseOptions json5 = ParseOptions::json5();
+    expect_same_as_parse("{ // c\n a: 'x\\'y', b: [NaN, -Infinity, 0x1F,], }", json5);
+    expect_same_as_parse("[1, /* open", ParseOptions::lenient());
+
+    ParseOptions unique;
+    unique.allow_duplicate_keys = false;
+    expect_same_as_parse(R"({"a": 1, "b": {"a": 2}, "c": 3})", unique);
+    expect_same_as_parse(R"({"a": 1, "b": 2, "a": 3})", unique);
+    expect_same_as_parse(R"({"ab": 1, "ab": 2})", unique);
+    EXPECT_EQ(validate(R"({"a": 1, "a": 2})", unique).ec, make_error_code(errc::duplicate_key));
+
+    ParseOptions shallow;
+    shallow.max_depth = 3;
+    expect_same_as_parse("[[[1]]]", shallow);
+    expect_same_as_parse("[[[[1]]]]", shallow);
+}
+
+TEST(Validate, AllocationFailureIsNotEnoughMemory) {
+    ParseOptions unique;
+    unique.allow_duplicate_keys = false;
+    std::string doc = "{";  // more key copies than the stack buffer holds
+    for (int i = 0; i < 100; ++i) {
+        doc += (i ? ",\"" : "\"") + std::string(40, 'k') + std::to_string(i) + "\":1";
+    }
+    doc += "}";
+    g_fail_allocations = true;
+    const result<void> r = validate(doc, unique);
+    g_fail_allocations = false;
+    EXPECT_EQ(r.ec, std::make_error_code(std::errc::not_enough_memory));
+    EXPECT_TRUE(validate(doc, unique));
+}
+
+TEST(Validate, DoesNotAllocate) {
+    std::string big = "[";
+    for (int i = 0; i < 500; ++i) {
+        if (i) big += ",";
+        big += kDoc;
+    }
+    big += "]";
+    ParseOptions utf8;
+    utf8.validate_utf8 = true;
+
+    g_allocations = 0;
+    g_counting = true;
+    const bool ok = validate(big) && validate(big, utf8) &&
+                    validate(R"(["x\n", {"é": "😀"}])");
+    g_counting = false;
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(g_allocations, 0u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ParseOptions::validate_utf8
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(ValidateUtf8Option, RejectsMalformedInput) {
+    ParseOptions opts;
+    opts.validate_utf8 = true;
+    const std::string ok = R"({"café": "é 中文 😀"})";
+    EXPECT_EQ(parse(ok, opts), parse(ok));
+
+    for (const std::string& bad : {
+             std::string("[\"a\xC3\"]"),            // truncated sequence
+             std::string("[\"\xC0\xAF\"]"),         // overlong '/'
+             std::string("[\"\xED\xA0\x80\"]"),     // surrogate
+             std::string("[\"\xF4\x90\x80\x80\"]"), // beyond U+10FFFF
+             std::string("{\"k\xFF\": 1}"),         // invalid byte in a key
+         }) {
+        EXPECT_NO_THROW((void)parse(bad)) << "unchecked by default";
+        try {
+            (void)parse(bad, opts);
+            ADD_FAILURE() << "accepted: " << bad;
+        } catch (const ParseError& e) {
+            EXPECT_EQ(e.code(), make_error_code(errc::invalid_utf8));
+            EXPECT_EQ(e.location().offset, bad.find_first_of("\xC0\xC3\xED\xF4\xFF")) << bad;
+        }
+        expect_same_as_parse(bad, opts);
+    }
+}
+
+TEST(ValidateUtf8Option, CheckedBeforeSyntax) {
+    ParseOptions opts;
+    opts.validate_utf8 = true;
+    const std::string doc = std::string(100, ' ') + "[1,, \"\x80\"]";
+    auto r = try_parse(doc, opts);
+    EXPECT_EQ(r.ec, make_error_code(errc::invalid_utf8));
+    EXPECT_EQ(validate(doc, opts).location.offset, doc.find('\x80'));
+    EXPECT_EQ(try_parse(doc).ec, make_error_code(errc::unexpected_character));
+}
+
+TEST(ValidateUtf8Option, AllEntryPoints) {
+    ParseOptions opts;
+    opts.validate_utf8 = true;
+    std::string doc = "[";
+    for (int i = 0; i < 2000; ++i) doc += "\"\xC3\xA9t\xC3\xA9\",";
+    doc += "\"\xE2\x82\"]";
+    const auto invalid = make_error_code(errc::invalid_utf8);
+
+    EXPECT_EQ(try_parse(doc, opts).ec, invalid);
+    std::string buf = doc;
+    EXPECT_EQ(try_parse_insitu(buf.data(), buf.size(), opts).ec, invalid);
+    EXPECT_EQ(try_parse_padded(PaddedString(doc), opts).ec, invalid);
+    ParseOptions indexed = opts;
+    indexed.structural_index = true;
+    EXPECT_EQ(try_parse(doc, indexed).ec, invalid);
+    EXPECT_THROW((void)parse_tape(doc, opts), ParseError);
+    EXPECT_THROW((void)ondemand::Document(doc, opts), ParseError);
+    try {
+        (void)parse_parallel(doc, 4, opts);
+        ADD_FAILURE() << "parse_parallel accepted invalid UTF-8";
+    } catch (const ParseError& e) {
+        EXPECT_EQ(e.code(), invalid);
+    }
+
+    doc.replace(doc.size() - 4, 2, "ok");
+    EXPECT_TRUE(validate(doc, opts));
+    EXPECT_EQ(parse_parallel(doc, 4, opts), parse(doc));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Destruction allocates nothing (uses the allocation hook above)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(DeepValue, DestroyDoesNotAllocate) {
+    // Mixed arrays and objects far below YAJSON_MAX_DEPTH, with siblings at
+    // every level so the deep part is not just a single chain
+    constexpr int kDepth = 20000;
+    std::string doc;
+    for (int i = 0; i < kDepth; ++i) doc += i % 2 ? R"({"s":"a long string value here","k":[)" : "[1.5,[],{},";
+    doc += "[1,2,3]";
+    for (int i = kDepth - 1; i >= 0; --i) doc += i % 2 ? "]}" : "]";
+    ParseOptions opts;
+    opts.iterative = true;
+    opts.max_depth = 2 * kDepth;
+    opts.packed_arrays = true;
+
+    for (int round = 0; round < 2; ++round) {
+        JsonValue v = parse(doc, opts);
+        JsonValue copy = v;
+        g_fail_allocations = true;
+        v = JsonValue();
+        copy.clear();
+        g_fail_allocations = false;
+        EXPECT_TRUE(v.is_null());
+        EXPECT_TRUE(copy.empty());
+        opts.packed_arrays = false;
+    }
+}